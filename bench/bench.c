@@ -0,0 +1,840 @@
+#include <float.h>
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "math_utils.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define BENCH_CYCLES() __rdtsc()
+#define BENCH_CYCLE_SOURCE "tsc"
+#else
+#define BENCH_CYCLES() 0ULL
+#define BENCH_CYCLE_SOURCE NULL
+#endif
+
+/* Elements per pass; a power of two so that latency chains can mask. */
+#define BENCH_N 4096
+#define BENCH_TRIALS 5
+
+typedef void (*bench_fn)(void);
+
+typedef enum {
+  BENCH_I1,   /* long int f(int) */
+  BENCH_L1,   /* long int f(double) */
+  BENCH_LF1,  /* long int f(float) */
+  BENCH_E1,   /* int f(double) */
+  BENCH_EF1,  /* int f(float) */
+  BENCH_LD1,  /* long double f(double) */
+  BENCH_D1,   /* double f(double) */
+  BENCH_F1,   /* float f(float) */
+  BENCH_LD2,  /* long double f(double, double) */
+  BENCH_D2,   /* double f(double, double) */
+  BENCH_F2,   /* float f(float, float) */
+  BENCH_LDE2, /* long double f(double, int) */
+  BENCH_DE2,  /* double f(double, int) */
+  BENCH_FE2,  /* float f(float, int) */
+  BENCH_NI1,  /* void f(const int *, long int *, size_t) */
+  BENCH_NL1,  /* void f(const double *, long int *, size_t) */
+  BENCH_NE1,  /* void f(const double *, int *, size_t) */
+  BENCH_N1,   /* void f(const double *, double *, size_t) */
+  BENCH_NF1,  /* void f(const float *, float *, size_t) */
+  BENCH_N2,   /* void f(const double *, const double *, double *, size_t) */
+  BENCH_NF2,  /* void f(const float *, const float *, float *, size_t) */
+  BENCH_NE2,  /* void f(const double *, const int *, double *, size_t) */
+} bench_shape;
+
+typedef struct {
+  const char *name;
+  bench_shape shape;
+  bench_fn fn;
+} bench_impl;
+
+/* Inputs are uniform in [lo, hi], or log-uniform when `log_scale` is set. */
+typedef struct {
+  const char *name;
+  double lo, hi;
+  double lo2, hi2;
+  int log_scale;
+} bench_range;
+
+#define BENCH_MAX_RANGES 4
+#define BENCH_MAX_IMPLS 12
+
+typedef struct {
+  const char *name;
+  bench_range ranges[BENCH_MAX_RANGES];
+  bench_impl impls[BENCH_MAX_IMPLS];
+} bench_func;
+
+typedef struct {
+  double x[BENCH_N], y[BENCH_N], out[BENCH_N];
+  float xf[BENCH_N], yf[BENCH_N], outf[BENCH_N];
+  int xi[BENCH_N], ei[BENCH_N], oute[BENCH_N];
+  long int outi[BENCH_N];
+} bench_data;
+
+typedef struct {
+  double ns;
+  double cycles;
+} bench_sample;
+
+#define IMPL(shape, fn) {#fn, shape, (bench_fn)fn}
+
+/*
+ * Adapters for the functions whose shape has no slot of its own. Their call
+ * overhead is part of the measurement, the same on both sides.
+ */
+static double bench_scratch[BENCH_N];
+static float bench_scratchf[BENCH_N];
+static int bench_quo[BENCH_N];
+static mu_pow_plan bench_plan;
+
+static long int libc_abs(int x) { return abs(x); }
+
+static long double mu_sincos_sum(double x) {
+  long double s, c;
+  mu_sincos(x, &s, &c);
+  return s + c;
+}
+
+static double mu_sincos_d_sum(double x) {
+  double s, c;
+  mu_sincos_d(x, &s, &c);
+  return s + c;
+}
+
+static float mu_sincosf_sum(float x) {
+  float s, c;
+  mu_sincosf(x, &s, &c);
+  return s + c;
+}
+
+static double sincos_sum(double x) {
+  double s, c;
+  sincos(x, &s, &c);
+  return s + c;
+}
+
+static float sincosf_sum(float x) {
+  float s, c;
+  sincosf(x, &s, &c);
+  return s + c;
+}
+
+static long double mu_modf_sum(double x) {
+  long double ipart;
+  return mu_modf(x, &ipart) + ipart;
+}
+
+static double mu_modf_d_sum(double x) {
+  double ipart;
+  return mu_modf_d(x, &ipart) + ipart;
+}
+
+static float mu_modff_sum(float x) {
+  float ipart;
+  return mu_modff(x, &ipart) + ipart;
+}
+
+static long double mu_remquo_sum(double x, double y) {
+  int quo;
+  return mu_remquo(x, y, &quo) + quo;
+}
+
+static double mu_remquo_d_sum(double x, double y) {
+  int quo;
+  return mu_remquo_d(x, y, &quo) + quo;
+}
+
+static float mu_remquof_sum(float x, float y) {
+  int quo;
+  return mu_remquof(x, y, &quo) + (float)quo;
+}
+
+static double remquo_sum(double x, double y) {
+  int quo;
+  return remquo(x, y, &quo) + quo;
+}
+
+static float remquof_sum(float x, float y) {
+  int quo;
+  return remquof(x, y, &quo) + (float)quo;
+}
+
+static double modf_sum(double x) {
+  double ipart;
+  return modf(x, &ipart) + ipart;
+}
+
+static float modff_sum(float x) {
+  float ipart;
+  return modff(x, &ipart) + ipart;
+}
+
+static void mu_sincos_n_both(const double *in, double *out, size_t n) {
+  mu_sincos_n(in, out, bench_scratch, n);
+}
+
+static void mu_sincosf_n_both(const float *in, float *out, size_t n) {
+  mu_sincosf_n(in, out, bench_scratchf, n);
+}
+
+static void mu_modf_n_both(const double *in, double *out, size_t n) {
+  mu_modf_n(in, out, bench_scratch, n);
+}
+
+static void mu_modff_n_both(const float *in, float *out, size_t n) {
+  mu_modff_n(in, out, bench_scratchf, n);
+}
+
+static void mu_remquo_n_both(const double *x, const double *y, double *out,
+                             size_t n) {
+  mu_remquo_n(x, y, out, bench_quo, n);
+}
+
+static double rsqrt(double x) { return 1.0 / sqrt(x); }
+
+static float rsqrtf(float x) { return 1.0f / sqrtf(x); }
+
+static long double mu_pow_apply_2(double x) {
+  return mu_pow_apply(&bench_plan, x);
+}
+
+static double mu_pow_apply_d_2(double x) {
+  return mu_pow_apply_d(&bench_plan, x);
+}
+
+static void mu_pow_apply_n_2(const double *in, double *out, size_t n) {
+  mu_pow_apply_n(&bench_plan, in, out, n);
+}
+
+static double pow_2(double x) { return pow(2.0, x); }
+
+/*
+ * libm has no π-scaled or degree functions; its rows scale the argument
+ * first, as callers without them do.
+ */
+static double sin_pi(double x) { return sin(MU_PI * x); }
+static float sin_pif(float x) { return sinf((float)MU_PI * x); }
+static double cos_pi(double x) { return cos(MU_PI * x); }
+static float cos_pif(float x) { return cosf((float)MU_PI * x); }
+static double tan_pi(double x) { return tan(MU_PI * x); }
+static float tan_pif(float x) { return tanf((float)MU_PI * x); }
+static double sin_deg(double x) { return sin(MU_PI / 180.0 * x); }
+static float sin_degf(float x) { return sinf((float)(MU_PI / 180.0) * x); }
+static double cos_deg(double x) { return cos(MU_PI / 180.0 * x); }
+static float cos_degf(float x) { return cosf((float)(MU_PI / 180.0) * x); }
+
+static long double mu_sincospi_sum(double x) {
+  long double s, c;
+  mu_sincospi(x, &s, &c);
+  return s + c;
+}
+
+static double mu_sincospi_d_sum(double x) {
+  double s, c;
+  mu_sincospi_d(x, &s, &c);
+  return s + c;
+}
+
+static float mu_sincospif_sum(float x) {
+  float s, c;
+  mu_sincospif(x, &s, &c);
+  return s + c;
+}
+
+static void mu_sincospi_n_both(const double *in, double *out, size_t n) {
+  mu_sincospi_n(in, out, bench_scratch, n);
+}
+
+static void mu_sincospif_n_both(const float *in, float *out, size_t n) {
+  mu_sincospif_n(in, out, bench_scratchf, n);
+}
+
+static double sincos_pi_sum(double x) { return sincos_sum(MU_PI * x); }
+
+static long double mu_sincosd_sum(double x) {
+  long double s, c;
+  mu_sincosd(x, &s, &c);
+  return s + c;
+}
+
+static double mu_sincosd_d_sum(double x) {
+  double s, c;
+  mu_sincosd_d(x, &s, &c);
+  return s + c;
+}
+
+static float mu_sincosdf_sum(float x) {
+  float s, c;
+  mu_sincosdf(x, &s, &c);
+  return s + c;
+}
+
+static void mu_sincosd_n_both(const double *in, double *out, size_t n) {
+  mu_sincosd_n(in, out, bench_scratch, n);
+}
+
+static void mu_sincosdf_n_both(const float *in, float *out, size_t n) {
+  mu_sincosdf_n(in, out, bench_scratchf, n);
+}
+
+static double sincos_deg_sum(double x) {
+  return sincos_sum(MU_PI / 180.0 * x);
+}
+
+#define UNARY_IMPLS(name)                                                 \
+  IMPL(BENCH_LD1, mu_##name), IMPL(BENCH_D1, mu_##name##_d),              \
+      IMPL(BENCH_F1, mu_##name##f), IMPL(BENCH_N1, mu_##name##_n),        \
+      IMPL(BENCH_NF1, mu_##name##f_n), IMPL(BENCH_D1, name),              \
+      IMPL(BENCH_F1, name##f)
+
+#define BINARY_IMPLS(name)                                                \
+  IMPL(BENCH_LD2, mu_##name), IMPL(BENCH_D2, mu_##name##_d),              \
+      IMPL(BENCH_F2, mu_##name##f), IMPL(BENCH_N2, mu_##name##_n),        \
+      IMPL(BENCH_NF2, mu_##name##f_n), IMPL(BENCH_D2, name),              \
+      IMPL(BENCH_F2, name##f)
+
+/* UNARY_IMPLS() against a libm adapter `ref` and its float form. */
+#define SCALED_IMPLS(name, ref)                                           \
+  IMPL(BENCH_LD1, mu_##name), IMPL(BENCH_D1, mu_##name##_d),              \
+      IMPL(BENCH_F1, mu_##name##f), IMPL(BENCH_N1, mu_##name##_n),        \
+      IMPL(BENCH_NF1, mu_##name##f_n), IMPL(BENCH_D1, ref),               \
+      IMPL(BENCH_F1, ref##f)
+
+#define TIER_IMPLS(name)                                                  \
+  IMPL(BENCH_D1, mu_##name##_fast), IMPL(BENCH_D1, mu_##name##_medium),   \
+      IMPL(BENCH_N1, mu_##name##_fast_n),                                 \
+      IMPL(BENCH_N1, mu_##name##_medium_n)
+
+#define ROUNDING_RANGES                                           \
+  {"small", -100.0, 100.0, 0, 0, 0}, {"huge", 1e15, 1e300, 0, 0, 1}
+
+static const bench_func bench_funcs[] = {
+    {"abs",
+     {{"mixed", -1e6, 1e6, 0, 0, 0}},
+     {IMPL(BENCH_I1, mu_abs), IMPL(BENCH_NI1, mu_abs_n),
+      IMPL(BENCH_I1, libc_abs)}},
+    {"fabs", {{"mixed", -1e6, 1e6, 0, 0, 0}}, {UNARY_IMPLS(fabs)}},
+    {"trunc", {ROUNDING_RANGES}, {UNARY_IMPLS(trunc)}},
+    {"ceil", {ROUNDING_RANGES}, {UNARY_IMPLS(ceil)}},
+    {"floor", {ROUNDING_RANGES}, {UNARY_IMPLS(floor)}},
+    {"round", {ROUNDING_RANGES}, {UNARY_IMPLS(round)}},
+    {"nearbyint", {ROUNDING_RANGES}, {UNARY_IMPLS(nearbyint)}},
+    {"modf",
+     {ROUNDING_RANGES},
+     {IMPL(BENCH_LD1, mu_modf_sum), IMPL(BENCH_D1, mu_modf_d_sum),
+      IMPL(BENCH_F1, mu_modff_sum), IMPL(BENCH_N1, mu_modf_n_both),
+      IMPL(BENCH_NF1, mu_modff_n_both), IMPL(BENCH_D1, modf_sum),
+      IMPL(BENCH_F1, modff_sum)}},
+    {"lround",
+     {{"small", -100.0, 100.0, 0, 0, 0}, {"large", -1e15, 1e15, 0, 0, 0}},
+     {IMPL(BENCH_L1, mu_lround), IMPL(BENCH_LF1, mu_lroundf),
+      IMPL(BENCH_NL1, mu_lround_n), IMPL(BENCH_L1, lround),
+      IMPL(BENCH_LF1, lroundf)}},
+    {"fmod",
+     {{"small", -100.0, 100.0, 0.5, 10.0, 0},
+      {"huge_ratio", 1e10, 1e300, 0.5, 10.0, 1},
+      {"huge_gap", 1e200, 1e300, 1e-300, 1e-290, 1}},
+     {BINARY_IMPLS(fmod)}},
+    {"remainder",
+     {{"small", -100.0, 100.0, 0.5, 10.0, 0},
+      {"huge_ratio", 1e10, 1e300, 0.5, 10.0, 1}},
+     {BINARY_IMPLS(remainder)}},
+    {"remquo",
+     {{"small", -100.0, 100.0, 0.5, 10.0, 0},
+      {"huge_ratio", 1e10, 1e300, 0.5, 10.0, 1}},
+     {IMPL(BENCH_LD2, mu_remquo_sum), IMPL(BENCH_D2, mu_remquo_d_sum),
+      IMPL(BENCH_F2, mu_remquof_sum), IMPL(BENCH_N2, mu_remquo_n_both),
+      IMPL(BENCH_D2, remquo_sum), IMPL(BENCH_F2, remquof_sum)}},
+    {"sin",
+     {{"small", -0.78, 0.78, 0, 0, 0},
+      {"medium", -100.0, 100.0, 0, 0, 0},
+      {"huge", 1e6, 1e300, 0, 0, 1}},
+     {UNARY_IMPLS(sin), TIER_IMPLS(sin)}},
+    {"cos",
+     {{"small", -0.78, 0.78, 0, 0, 0},
+      {"medium", -100.0, 100.0, 0, 0, 0},
+      {"huge", 1e6, 1e300, 0, 0, 1}},
+     {UNARY_IMPLS(cos), TIER_IMPLS(cos)}},
+    {"tan",
+     {{"small", -0.78, 0.78, 0, 0, 0},
+      {"medium", -100.0, 100.0, 0, 0, 0},
+      {"near_pole", 1.5707, 1.5709, 0, 0, 0}},
+     {UNARY_IMPLS(tan)}},
+    {"sincos",
+     {{"small", -0.78, 0.78, 0, 0, 0},
+      {"medium", -100.0, 100.0, 0, 0, 0}},
+     {IMPL(BENCH_LD1, mu_sincos_sum), IMPL(BENCH_D1, mu_sincos_d_sum),
+      IMPL(BENCH_F1, mu_sincosf_sum), IMPL(BENCH_N1, mu_sincos_n_both),
+      IMPL(BENCH_NF1, mu_sincosf_n_both), IMPL(BENCH_D1, sincos_sum),
+      IMPL(BENCH_F1, sincosf_sum)}},
+    {"sinpi",
+     {{"small", -0.25, 0.25, 0, 0, 0},
+      {"medium", -100.0, 100.0, 0, 0, 0},
+      {"huge", 1e6, 1e300, 0, 0, 1}},
+     {SCALED_IMPLS(sinpi, sin_pi)}},
+    {"cospi",
+     {{"small", -0.25, 0.25, 0, 0, 0},
+      {"medium", -100.0, 100.0, 0, 0, 0},
+      {"huge", 1e6, 1e300, 0, 0, 1}},
+     {SCALED_IMPLS(cospi, cos_pi)}},
+    {"tanpi",
+     {{"small", -0.25, 0.25, 0, 0, 0},
+      {"medium", -100.0, 100.0, 0, 0, 0},
+      {"near_pole", 0.4999, 0.5001, 0, 0, 0}},
+     {SCALED_IMPLS(tanpi, tan_pi)}},
+    {"sincospi",
+     {{"small", -0.25, 0.25, 0, 0, 0},
+      {"medium", -100.0, 100.0, 0, 0, 0}},
+     {IMPL(BENCH_LD1, mu_sincospi_sum), IMPL(BENCH_D1, mu_sincospi_d_sum),
+      IMPL(BENCH_F1, mu_sincospif_sum), IMPL(BENCH_N1, mu_sincospi_n_both),
+      IMPL(BENCH_NF1, mu_sincospif_n_both), IMPL(BENCH_D1, sincos_pi_sum)}},
+    {"sind",
+     {{"small", -45.0, 45.0, 0, 0, 0},
+      {"medium", -36000.0, 36000.0, 0, 0, 0},
+      {"huge", 1e6, 1e300, 0, 0, 1}},
+     {SCALED_IMPLS(sind, sin_deg)}},
+    {"cosd",
+     {{"small", -45.0, 45.0, 0, 0, 0},
+      {"medium", -36000.0, 36000.0, 0, 0, 0},
+      {"huge", 1e6, 1e300, 0, 0, 1}},
+     {SCALED_IMPLS(cosd, cos_deg)}},
+    {"sincosd",
+     {{"small", -45.0, 45.0, 0, 0, 0},
+      {"medium", -36000.0, 36000.0, 0, 0, 0}},
+     {IMPL(BENCH_LD1, mu_sincosd_sum), IMPL(BENCH_D1, mu_sincosd_d_sum),
+      IMPL(BENCH_F1, mu_sincosdf_sum), IMPL(BENCH_N1, mu_sincosd_n_both),
+      IMPL(BENCH_NF1, mu_sincosdf_n_both), IMPL(BENCH_D1, sincos_deg_sum)}},
+    {"asin",
+     {{"small", -0.5, 0.5, 0, 0, 0}, {"near_one", 0.999, 1.0, 0, 0, 0}},
+     {UNARY_IMPLS(asin)}},
+    {"acos",
+     {{"small", -0.5, 0.5, 0, 0, 0}, {"near_one", 0.999, 1.0, 0, 0, 0}},
+     {UNARY_IMPLS(acos)}},
+    {"atan",
+     {{"small", -1.0, 1.0, 0, 0, 0}, {"huge", 1e3, 1e300, 0, 0, 1}},
+     {UNARY_IMPLS(atan)}},
+    {"atan2",
+     {{"mixed", -10.0, 10.0, -10.0, 10.0, 0},
+      {"steep", 1e5, 1e6, -1e-3, 1e-3, 0}},
+     {BINARY_IMPLS(atan2)}},
+    {"sqrt",
+     {{"normal", 0.01, 100.0, 0, 0, 0},
+      {"wide", 1e-300, 1e300, 0, 0, 1},
+      {"subnormal", 1e-320, 1e-310, 0, 0, 1}},
+     {UNARY_IMPLS(sqrt)}},
+    {"rsqrt",
+     {{"normal", 0.01, 100.0, 0, 0, 0},
+      {"wide", 1e-300, 1e300, 0, 0, 1},
+      {"subnormal", 1e-320, 1e-310, 0, 0, 1}},
+     {UNARY_IMPLS(rsqrt)}},
+    {"pow",
+     {{"small", 0.5, 2.0, -10.0, 10.0, 0},
+      {"large", 1.0, 1e10, -30.0, 30.0, 0}},
+     {BINARY_IMPLS(pow)}},
+    {"pow_apply",
+     {{"base2", -100.0, 100.0, 0, 0, 0}},
+     {IMPL(BENCH_LD1, mu_pow_apply_2), IMPL(BENCH_D1, mu_pow_apply_d_2),
+      IMPL(BENCH_N1, mu_pow_apply_n_2), IMPL(BENCH_D1, pow_2)}},
+    {"sinh",
+     {{"small", -1.0, 1.0, 0, 0, 0},
+      {"medium", -20.0, 20.0, 0, 0, 0},
+      {"large", -700.0, 700.0, 0, 0, 0}},
+     {UNARY_IMPLS(sinh)}},
+    {"cosh",
+     {{"small", -1.0, 1.0, 0, 0, 0},
+      {"medium", -20.0, 20.0, 0, 0, 0},
+      {"large", -700.0, 700.0, 0, 0, 0}},
+     {UNARY_IMPLS(cosh)}},
+    {"tanh",
+     {{"small", -1.0, 1.0, 0, 0, 0}, {"medium", -20.0, 20.0, 0, 0, 0}},
+     {UNARY_IMPLS(tanh)}},
+    {"asinh",
+     {{"small", -1.0, 1.0, 0, 0, 0}, {"wide", 1.0, 1e300, 0, 0, 1}},
+     {UNARY_IMPLS(asinh)}},
+    {"acosh",
+     {{"near_one", 1.0, 1.01, 0, 0, 0}, {"wide", 1.0, 1e300, 0, 0, 1}},
+     {UNARY_IMPLS(acosh)}},
+    {"atanh",
+     {{"small", -0.5, 0.5, 0, 0, 0}, {"near_one", 0.999, 1.0, 0, 0, 0}},
+     {UNARY_IMPLS(atanh)}},
+    {"exp",
+     {{"small", -1.0, 1.0, 0, 0, 0},
+      {"wide", -700.0, 700.0, 0, 0, 0},
+      {"near_overflow", 700.0, 709.7, 0, 0, 0}},
+     {UNARY_IMPLS(exp), TIER_IMPLS(exp)}},
+    {"log",
+     {{"near_one", 0.99, 1.01, 0, 0, 0},
+      {"wide", 1e-300, 1e300, 0, 0, 1},
+      {"subnormal", 1e-320, 1e-310, 0, 0, 1}},
+     {UNARY_IMPLS(log), TIER_IMPLS(log)}},
+    {"exp2",
+     {{"small", -1.0, 1.0, 0, 0, 0},
+      {"wide", -1000.0, 1000.0, 0, 0, 0},
+      {"subnormal", -1074.0, -1022.0, 0, 0, 0}},
+     {UNARY_IMPLS(exp2)}},
+    {"exp10",
+     {{"small", -1.0, 1.0, 0, 0, 0}, {"wide", -300.0, 300.0, 0, 0, 0}},
+     {UNARY_IMPLS(exp10)}},
+    {"expm1",
+     {{"tiny", -1e-3, 1e-3, 0, 0, 0},
+      {"small", -1.0, 1.0, 0, 0, 0},
+      {"wide", -700.0, 700.0, 0, 0, 0}},
+     {UNARY_IMPLS(expm1)}},
+    {"log2",
+     {{"near_one", 0.99, 1.01, 0, 0, 0}, {"wide", 1e-300, 1e300, 0, 0, 1}},
+     {UNARY_IMPLS(log2)}},
+    {"log10",
+     {{"near_one", 0.99, 1.01, 0, 0, 0}, {"wide", 1e-300, 1e300, 0, 0, 1}},
+     {UNARY_IMPLS(log10)}},
+    {"log1p",
+     {{"tiny", -1e-3, 1e-3, 0, 0, 0}, {"wide", 1e-3, 1e300, 0, 0, 1}},
+     {UNARY_IMPLS(log1p)}},
+    {"ilogb",
+     {{"wide", 1e-300, 1e300, 0, 0, 1},
+      {"subnormal", 1e-320, 1e-310, 0, 0, 1}},
+     {IMPL(BENCH_E1, mu_ilogb), IMPL(BENCH_EF1, mu_ilogbf),
+      IMPL(BENCH_NE1, mu_ilogb_n), IMPL(BENCH_E1, ilogb),
+      IMPL(BENCH_EF1, ilogbf)}},
+    {"ldexp",
+     {{"normal", 1.0, 2.0, -60.0, 60.0, 0},
+      {"subnormal", 1.0, 2.0, -1070.0, -1030.0, 0}},
+     {IMPL(BENCH_LDE2, mu_ldexp), IMPL(BENCH_DE2, mu_ldexp_d),
+      IMPL(BENCH_FE2, mu_ldexpf), IMPL(BENCH_NE2, mu_ldexp_n),
+      IMPL(BENCH_DE2, ldexp), IMPL(BENCH_FE2, ldexpf)}},
+};
+
+#define BENCH_FUNCS (sizeof(bench_funcs) / sizeof(bench_funcs[0]))
+
+static volatile uint64_t bench_zero;
+
+static int bench_is_float(bench_shape shape) {
+  return shape == BENCH_LF1 || shape == BENCH_EF1 || shape == BENCH_F1 ||
+         shape == BENCH_F2 || shape == BENCH_FE2 || shape == BENCH_NF1 ||
+         shape == BENCH_NF2;
+}
+
+static int bench_is_batch(bench_shape shape) { return shape >= BENCH_NI1; }
+
+/* Float runs are skipped for ranges that float cannot represent. */
+static int bench_fits_float(const bench_range *r) {
+  double m = fmax(fabs(r->lo), fabs(r->hi));
+  double m2 = fmax(fabs(r->lo2), fabs(r->hi2));
+  return m <= FLT_MAX && m2 <= FLT_MAX && !(r->lo > 0 && r->hi < FLT_MIN);
+}
+
+static uint64_t bench_rand(uint64_t *state) {
+  *state ^= *state << 13;
+  *state ^= *state >> 7;
+  *state ^= *state << 17;
+  return *state;
+}
+
+static double bench_uniform(uint64_t *state, double lo, double hi,
+                            int log_scale) {
+  double u = (double)(bench_rand(state) >> 11) * 0x1p-53;
+  if (log_scale) {
+    return exp(log(lo) + u * (log(hi) - log(lo)));
+  }
+  return lo + u * (hi - lo);
+}
+
+static void bench_fill(bench_data *d, const bench_range *r) {
+  uint64_t state = 0x9e3779b97f4a7c15ULL;
+  for (size_t i = 0; i < BENCH_N; ++i) {
+    d->x[i] = bench_uniform(&state, r->lo, r->hi, r->log_scale);
+    d->y[i] = bench_uniform(&state, r->lo2, r->hi2, 0);
+    d->xf[i] = (float)d->x[i];
+    d->yf[i] = (float)d->y[i];
+    d->xi[i] = (int)d->x[i];
+    d->ei[i] = (int)d->y[i];
+  }
+}
+
+static uint64_t bench_bits(double x) {
+  uint64_t b;
+  memcpy(&b, &x, sizeof(b));
+  return b;
+}
+
+/*
+ * Runs one pass over the inputs. Throughput passes make independent calls;
+ * latency passes feed each result into the index of the next input, through
+ * a mask that is zero at run time, so that every call waits for the last.
+ */
+static void bench_pass(const bench_impl *impl, bench_data *d, int latency) {
+  uint64_t mask = bench_zero;
+  uint64_t dep = 0;
+
+#define BENCH_LOOP(call)                                           \
+  for (size_t i = 0; i < BENCH_N; ++i) {                           \
+    size_t j = latency ? (i + (dep & mask)) & (BENCH_N - 1) : i;   \
+    double r = (double)(call);                                     \
+    dep = bench_bits(r);                                           \
+    d->out[i] = r;                                                 \
+  }
+
+  switch (impl->shape) {
+    case BENCH_I1: {
+      long int (*f)(int) = (long int (*)(int))impl->fn;
+      BENCH_LOOP(f(d->xi[j]));
+      break;
+    }
+    case BENCH_L1: {
+      long int (*f)(double) = (long int (*)(double))impl->fn;
+      BENCH_LOOP(f(d->x[j]));
+      break;
+    }
+    case BENCH_LF1: {
+      long int (*f)(float) = (long int (*)(float))impl->fn;
+      BENCH_LOOP(f(d->xf[j]));
+      break;
+    }
+    case BENCH_E1: {
+      int (*f)(double) = (int (*)(double))impl->fn;
+      BENCH_LOOP(f(d->x[j]));
+      break;
+    }
+    case BENCH_EF1: {
+      int (*f)(float) = (int (*)(float))impl->fn;
+      BENCH_LOOP(f(d->xf[j]));
+      break;
+    }
+    case BENCH_LD1: {
+      long double (*f)(double) = (long double (*)(double))impl->fn;
+      BENCH_LOOP(f(d->x[j]));
+      break;
+    }
+    case BENCH_D1: {
+      double (*f)(double) = (double (*)(double))impl->fn;
+      BENCH_LOOP(f(d->x[j]));
+      break;
+    }
+    case BENCH_F1: {
+      float (*f)(float) = (float (*)(float))impl->fn;
+      BENCH_LOOP(f(d->xf[j]));
+      break;
+    }
+    case BENCH_LD2: {
+      long double (*f)(double, double) =
+          (long double (*)(double, double))impl->fn;
+      BENCH_LOOP(f(d->x[j], d->y[j]));
+      break;
+    }
+    case BENCH_D2: {
+      double (*f)(double, double) = (double (*)(double, double))impl->fn;
+      BENCH_LOOP(f(d->x[j], d->y[j]));
+      break;
+    }
+    case BENCH_F2: {
+      float (*f)(float, float) = (float (*)(float, float))impl->fn;
+      BENCH_LOOP(f(d->xf[j], d->yf[j]));
+      break;
+    }
+    case BENCH_LDE2: {
+      long double (*f)(double, int) = (long double (*)(double, int))impl->fn;
+      BENCH_LOOP(f(d->x[j], d->ei[j]));
+      break;
+    }
+    case BENCH_DE2: {
+      double (*f)(double, int) = (double (*)(double, int))impl->fn;
+      BENCH_LOOP(f(d->x[j], d->ei[j]));
+      break;
+    }
+    case BENCH_FE2: {
+      float (*f)(float, int) = (float (*)(float, int))impl->fn;
+      BENCH_LOOP(f(d->xf[j], d->ei[j]));
+      break;
+    }
+    case BENCH_NI1:
+      ((void (*)(const int *, long int *, size_t))impl->fn)(d->xi, d->outi,
+                                                             BENCH_N);
+      break;
+    case BENCH_NL1:
+      ((void (*)(const double *, long int *, size_t))impl->fn)(d->x, d->outi,
+                                                               BENCH_N);
+      break;
+    case BENCH_NE1:
+      ((void (*)(const double *, int *, size_t))impl->fn)(d->x, d->oute,
+                                                          BENCH_N);
+      break;
+    case BENCH_N1:
+      ((void (*)(const double *, double *, size_t))impl->fn)(d->x, d->out,
+                                                             BENCH_N);
+      break;
+    case BENCH_NF1:
+      ((void (*)(const float *, float *, size_t))impl->fn)(d->xf, d->outf,
+                                                           BENCH_N);
+      break;
+    case BENCH_N2:
+      ((void (*)(const double *, const double *, double *, size_t))impl->fn)(
+          d->x, d->y, d->out, BENCH_N);
+      break;
+    case BENCH_NF2:
+      ((void (*)(const float *, const float *, float *, size_t))impl->fn)(
+          d->xf, d->yf, d->outf, BENCH_N);
+      break;
+    case BENCH_NE2:
+      ((void (*)(const double *, const int *, double *, size_t))impl->fn)(
+          d->x, d->ei, d->out, BENCH_N);
+      break;
+  }
+#undef BENCH_LOOP
+}
+
+static double bench_now(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+/* Best of BENCH_TRIALS runs of `reps` passes, per element. */
+static bench_sample bench_measure(const bench_impl *impl, bench_data *d,
+                                  int latency, long reps) {
+  bench_sample best = {INFINITY, INFINITY};
+  for (int t = 0; t < BENCH_TRIALS; ++t) {
+    double t0 = bench_now();
+    unsigned long long c0 = BENCH_CYCLES();
+    for (long r = 0; r < reps; ++r) {
+      bench_pass(impl, d, latency);
+    }
+    unsigned long long c1 = BENCH_CYCLES();
+    double t1 = bench_now();
+
+    double per = 1.0 / ((double)reps * BENCH_N);
+    if ((t1 - t0) * 1e9 * per < best.ns) {
+      best.ns = (t1 - t0) * 1e9 * per;
+      best.cycles = (double)(c1 - c0) * per;
+    }
+  }
+  return best;
+}
+
+/* Picks a repetition count that makes one trial last about `seconds`. */
+static long bench_calibrate(const bench_impl *impl, bench_data *d,
+                            double seconds) {
+  long reps = 1;
+  for (;;) {
+    double t0 = bench_now();
+    for (long r = 0; r < reps; ++r) {
+      bench_pass(impl, d, 0);
+    }
+    double dt = bench_now() - t0;
+    if (dt >= seconds / 4 || reps >= (1L << 24)) {
+      return (long)(reps * (seconds / (dt > 0 ? dt : 1e-9))) + 1;
+    }
+    reps *= 4;
+  }
+}
+
+static void bench_json_number(FILE *out, const char *key, double v, int last) {
+  if (isfinite(v)) {
+    fprintf(out, "\"%s\": %.4g%s", key, v, last ? "" : ", ");
+  } else {
+    fprintf(out, "\"%s\": null%s", key, last ? "" : ", ");
+  }
+}
+
+static void bench_usage(const char *prog) {
+  fprintf(stderr,
+          "usage: %s [-o FILE] [-t SECONDS] [-f FUNCTION]\n"
+          "  -o FILE      write the JSON report to FILE instead of stdout\n"
+          "  -t SECONDS   target duration of one trial (default 0.01)\n"
+          "  -f FUNCTION  only run the named function group\n",
+          prog);
+}
+
+int main(int argc, char **argv) {
+  const char *path = NULL;
+  const char *filter = NULL;
+  double seconds = 0.01;
+  for (int i = 1; i < argc; ++i) {
+    if (strcmp(argv[i], "-o") == 0 && i + 1 < argc) {
+      path = argv[++i];
+    } else if (strcmp(argv[i], "-t") == 0 && i + 1 < argc) {
+      seconds = atof(argv[++i]);
+    } else if (strcmp(argv[i], "-f") == 0 && i + 1 < argc) {
+      filter = argv[++i];
+    } else {
+      bench_usage(argv[0]);
+      return 2;
+    }
+  }
+
+  FILE *out = path ? fopen(path, "w") : stdout;
+  if (out == NULL) {
+    perror(path);
+    return 1;
+  }
+
+  static bench_data data;
+  bench_plan = mu_pow_plan_base(2.0);
+
+  fprintf(out, "{\n  \"batch_isa\": \"%s\",\n", mu_batch_isa());
+  if (BENCH_CYCLE_SOURCE) {
+    fprintf(out, "  \"cycle_source\": \"%s\",\n", BENCH_CYCLE_SOURCE);
+  } else {
+    fprintf(out, "  \"cycle_source\": null,\n");
+  }
+  fprintf(out, "  \"elements_per_pass\": %d,\n  \"results\": [", BENCH_N);
+  fprintf(stderr, "%-10s %-14s %-18s %10s %10s %12s %8s\n", "function",
+          "range", "impl", "lat ns", "ns/elem", "elem/s", "cyc/elem");
+
+  int first = 1;
+  for (size_t f = 0; f < BENCH_FUNCS; ++f) {
+    const bench_func *fn = &bench_funcs[f];
+    if (filter && strcmp(filter, fn->name) != 0) {
+      continue;
+    }
+
+    for (size_t r = 0; r < BENCH_MAX_RANGES && fn->ranges[r].name; ++r) {
+      const bench_range *range = &fn->ranges[r];
+      bench_fill(&data, range);
+
+      for (size_t k = 0; k < BENCH_MAX_IMPLS && fn->impls[k].name; ++k) {
+        const bench_impl *impl = &fn->impls[k];
+        if (bench_is_float(impl->shape) && !bench_fits_float(range)) {
+          continue;
+        }
+
+        long reps = bench_calibrate(impl, &data, seconds);
+        bench_sample thr = bench_measure(impl, &data, 0, reps);
+        bench_sample lat = {NAN, NAN};
+        if (!bench_is_batch(impl->shape)) {
+          lat = bench_measure(impl, &data, 1, reps);
+        }
+        if (!BENCH_CYCLE_SOURCE) {
+          thr.cycles = NAN;
+        }
+
+        fprintf(out, "%s\n    {\"function\": \"%s\", \"range\": \"%s\", ",
+                first ? "" : ",", fn->name, range->name);
+        fprintf(out, "\"impl\": \"%s\", \"libm\": %s, \"batch\": %s, ",
+                impl->name, strncmp(impl->name, "mu_", 3) ? "true" : "false",
+                bench_is_batch(impl->shape) ? "true" : "false");
+        bench_json_number(out, "ns_per_call", lat.ns, 0);
+        bench_json_number(out, "ns_per_element", thr.ns, 0);
+        bench_json_number(out, "elements_per_s", 1e9 / thr.ns, 0);
+        bench_json_number(out, "cycles_per_element", thr.cycles, 1);
+        fprintf(out, "}");
+        first = 0;
+
+        fprintf(stderr, "%-10s %-14s %-18s %10.2f %10.2f %12.4g %8.1f\n",
+                fn->name, range->name, impl->name, lat.ns, thr.ns,
+                1e9 / thr.ns, thr.cycles);
+      }
+    }
+  }
+
+  fprintf(out, "\n  ]\n}\n");
+  if (path) {
+    fclose(out);
+  }
+  return 0;
+}
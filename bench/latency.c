@@ -0,0 +1,466 @@
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "math_utils.h"
+
+/*
+ * Searches the domain of each scalar function for its slowest inputs. A
+ * uniform pass times random points in every cell of the domain; the slowest
+ * cells are then split and sampled again, several levels deep. Each point is
+ * timed LAT_REPS times and keeps its minimum, so one-off interruptions do not
+ * count as slow inputs.
+ */
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define LAT_UNIT "cycles"
+
+static inline uint64_t lat_begin(void) {
+  _mm_lfence();
+  uint64_t t = __rdtsc();
+  _mm_lfence();
+  return t;
+}
+
+static inline uint64_t lat_end(void) {
+  unsigned aux;
+  uint64_t t = __rdtscp(&aux);
+  _mm_lfence();
+  return t;
+}
+#else
+#define LAT_UNIT "ns"
+
+static inline uint64_t lat_begin(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+static inline uint64_t lat_end(void) { return lat_begin(); }
+#endif
+
+#define LAT_CELLS 256
+#define LAT_SAMPLES 16
+#define LAT_REPS 8
+#define LAT_LEVELS 4
+#define LAT_REFINE 8
+#define LAT_SPLIT 16
+#define LAT_WORST 5
+#define LAT_BUCKETS 16
+
+typedef enum { LAT_LD, LAT_D, LAT_F } lat_shape;
+
+/* The domain is linear, logarithmic, or logarithmic on both signs. */
+typedef enum { LAT_LIN, LAT_LOG, LAT_SYMLOG } lat_scale;
+
+typedef struct {
+  const char *name;
+  lat_shape shape;
+  void (*fn)(void);
+  double lo, hi;
+  lat_scale scale;
+} lat_func;
+
+typedef struct {
+  double x;
+  uint64_t time;
+} lat_point;
+
+typedef struct {
+  lat_point worst[LAT_WORST];
+  uint64_t buckets[LAT_BUCKETS];
+  uint64_t *samples;
+  size_t count;
+} lat_result;
+
+/* Binary functions are explored along one argument with the other fixed. */
+static long double mu_pow_half(double x) { return mu_pow(x, 0.5); }
+static double mu_pow_half_d(double x) { return mu_pow_d(x, 0.5); }
+static long double mu_pow_base(double y) { return mu_pow(1.5, y); }
+static double mu_pow_base_d(double y) { return mu_pow_d(1.5, y); }
+static long double mu_fmod_3(double x) { return mu_fmod(x, 3.0); }
+static double mu_fmod_3_d(double x) { return mu_fmod_d(x, 3.0); }
+static long double mu_remainder_3(double x) { return mu_remainder(x, 3.0); }
+static double mu_remainder_3_d(double x) { return mu_remainder_d(x, 3.0); }
+static long double mu_atan2_1(double y) { return mu_atan2(y, 1.0); }
+static double mu_atan2_1_d(double y) { return mu_atan2_d(y, 1.0); }
+static long double mu_ldexp_1(double x) { return mu_ldexp(1.5, (int)x); }
+static double mu_ldexp_1_d(double x) { return mu_ldexp_d(1.5, (int)x); }
+
+/* Functions with a second or an integer result return one double. */
+static long double mu_modf_sum(double x) {
+  long double ipart;
+  return mu_modf(x, &ipart) + ipart;
+}
+static double mu_modf_d_sum(double x) {
+  double ipart;
+  return mu_modf_d(x, &ipart) + ipart;
+}
+static float mu_modff_sum(float x) {
+  float ipart;
+  return mu_modff(x, &ipart) + ipart;
+}
+static double mu_lround_1(double x) { return (double)mu_lround(x); }
+static float mu_lroundf_1(float x) { return (float)mu_lroundf(x); }
+static double mu_ilogb_1(double x) { return mu_ilogb(x); }
+static float mu_ilogbf_1(float x) { return (float)mu_ilogbf(x); }
+static long double mu_remquo_3(double x) {
+  int quo;
+  return mu_remquo(x, 3.0, &quo) + quo;
+}
+static double mu_remquo_3_d(double x) {
+  int quo;
+  return mu_remquo_d(x, 3.0, &quo) + quo;
+}
+
+#define LAT(shape, fn, lo, hi, scale) \
+  { #fn, shape, (void (*)(void))fn, lo, hi, scale }
+
+#define LAT_UNARY(name, lo, hi, scale)                                   \
+  LAT(LAT_LD, mu_##name, lo, hi, scale),                                 \
+      LAT(LAT_D, mu_##name##_d, lo, hi, scale),                          \
+      LAT(LAT_F, mu_##name##f, (lo) < -3e38 ? -3e38 : (lo),              \
+          (hi) > 3e38 ? 3e38 : (hi), scale)
+
+#define LAT_TIERS(name, lo, hi, scale)                                   \
+  LAT(LAT_D, mu_##name##_fast, lo, hi, scale),                           \
+      LAT(LAT_D, mu_##name##_medium, lo, hi, scale)
+
+static const lat_func lat_funcs[] = {
+    LAT_UNARY(trunc, 1e-10, 1e300, LAT_SYMLOG),
+    LAT_UNARY(floor, 1e-10, 1e300, LAT_SYMLOG),
+    LAT_UNARY(ceil, 1e-10, 1e300, LAT_SYMLOG),
+    LAT_UNARY(round, 1e-10, 1e300, LAT_SYMLOG),
+    LAT_UNARY(nearbyint, 1e-10, 1e300, LAT_SYMLOG),
+    LAT(LAT_LD, mu_modf_sum, 1e-10, 1e300, LAT_SYMLOG),
+    LAT(LAT_D, mu_modf_d_sum, 1e-10, 1e300, LAT_SYMLOG),
+    LAT(LAT_F, mu_modff_sum, 1e-10, 3e38, LAT_SYMLOG),
+    LAT(LAT_D, mu_lround_1, 1e-10, 1e15, LAT_SYMLOG),
+    LAT(LAT_F, mu_lroundf_1, 1e-10, 1e15, LAT_SYMLOG),
+    LAT(LAT_LD, mu_fmod_3, 1e-10, 1e300, LAT_SYMLOG),
+    LAT(LAT_D, mu_fmod_3_d, 1e-10, 1e300, LAT_SYMLOG),
+    LAT(LAT_LD, mu_remainder_3, 1e-10, 1e300, LAT_SYMLOG),
+    LAT(LAT_D, mu_remainder_3_d, 1e-10, 1e300, LAT_SYMLOG),
+    LAT(LAT_LD, mu_remquo_3, 1e-10, 1e300, LAT_SYMLOG),
+    LAT(LAT_D, mu_remquo_3_d, 1e-10, 1e300, LAT_SYMLOG),
+    LAT_UNARY(sin, 1e-10, 1e300, LAT_SYMLOG),
+    LAT_TIERS(sin, 1e-10, 1e300, LAT_SYMLOG),
+    LAT_UNARY(cos, 1e-10, 1e300, LAT_SYMLOG),
+    LAT_TIERS(cos, 1e-10, 1e300, LAT_SYMLOG),
+    LAT_UNARY(tan, 1e-10, 1e300, LAT_SYMLOG),
+    LAT_UNARY(sinpi, 1e-10, 1e300, LAT_SYMLOG),
+    LAT_UNARY(cospi, 1e-10, 1e300, LAT_SYMLOG),
+    LAT_UNARY(tanpi, 1e-10, 1e300, LAT_SYMLOG),
+    LAT_UNARY(sind, 1e-10, 1e300, LAT_SYMLOG),
+    LAT_UNARY(cosd, 1e-10, 1e300, LAT_SYMLOG),
+    LAT_UNARY(asin, -1.0, 1.0, LAT_LIN),
+    LAT_UNARY(acos, -1.0, 1.0, LAT_LIN),
+    LAT_UNARY(atan, 1e-10, 1e300, LAT_SYMLOG),
+    LAT(LAT_LD, mu_atan2_1, 1e-10, 1e300, LAT_SYMLOG),
+    LAT(LAT_D, mu_atan2_1_d, 1e-10, 1e300, LAT_SYMLOG),
+    LAT_UNARY(sqrt, 4.9e-324, 1e308, LAT_LOG),
+    LAT_UNARY(rsqrt, 4.9e-324, 1e308, LAT_LOG),
+    LAT(LAT_LD, mu_pow_half, 4.9e-324, 1e308, LAT_LOG),
+    LAT(LAT_D, mu_pow_half_d, 4.9e-324, 1e308, LAT_LOG),
+    LAT(LAT_LD, mu_pow_base, -1850.0, 1800.0, LAT_LIN),
+    LAT(LAT_D, mu_pow_base_d, -1850.0, 1800.0, LAT_LIN),
+    LAT_UNARY(exp, -746.0, 710.0, LAT_LIN),
+    LAT_TIERS(exp, -746.0, 710.0, LAT_LIN),
+    LAT_UNARY(log, 4.9e-324, 1e308, LAT_LOG),
+    LAT_TIERS(log, 4.9e-324, 1e308, LAT_LOG),
+    LAT_UNARY(exp2, -1080.0, 1030.0, LAT_LIN),
+    LAT_UNARY(exp10, -330.0, 310.0, LAT_LIN),
+    LAT_UNARY(expm1, 1e-10, 710.0, LAT_SYMLOG),
+    LAT_UNARY(log2, 4.9e-324, 1e308, LAT_LOG),
+    LAT_UNARY(log10, 4.9e-324, 1e308, LAT_LOG),
+    LAT_UNARY(log1p, 1e-10, 1e308, LAT_LOG),
+    LAT(LAT_D, mu_ilogb_1, 4.9e-324, 1e308, LAT_LOG),
+    LAT(LAT_F, mu_ilogbf_1, 1e-45, 3e38, LAT_LOG),
+    LAT(LAT_LD, mu_ldexp_1, -1100.0, 1100.0, LAT_LIN),
+    LAT(LAT_D, mu_ldexp_1_d, -1100.0, 1100.0, LAT_LIN),
+    LAT_UNARY(sinh, 1e-10, 720.0, LAT_SYMLOG),
+    LAT_UNARY(cosh, 1e-10, 720.0, LAT_SYMLOG),
+    LAT_UNARY(tanh, 1e-10, 30.0, LAT_SYMLOG),
+    LAT_UNARY(asinh, 1e-10, 1e300, LAT_SYMLOG),
+    LAT_UNARY(acosh, 1.0, 1e308, LAT_LOG),
+    LAT_UNARY(atanh, -1.0, 1.0, LAT_LIN),
+};
+
+#define LAT_FUNCS (sizeof(lat_funcs) / sizeof(lat_funcs[0]))
+
+static uint64_t lat_overhead;
+
+static uint64_t lat_rand(uint64_t *state) {
+  *state ^= *state << 13;
+  *state ^= *state >> 7;
+  *state ^= *state << 17;
+  return *state;
+}
+
+static double lat_unit(uint64_t *state) {
+  return (double)(lat_rand(state) >> 11) * 0x1p-53;
+}
+
+/* Maps t in [0, 1] to the function's domain. */
+static double lat_map(const lat_func *f, double t) {
+  if (f->scale == LAT_LIN) {
+    return f->lo + t * (f->hi - f->lo);
+  }
+
+  double u = f->scale == LAT_LOG ? t : fabs(2.0 * t - 1.0);
+  double x = exp(log(f->lo) + u * (log(f->hi) - log(f->lo)));
+  return (f->scale == LAT_SYMLOG && t < 0.5) ? -x : x;
+}
+
+static volatile double lat_sink;
+
+static uint64_t lat_time(const lat_func *f, double x) {
+  uint64_t best = UINT64_MAX;
+  for (int r = 0; r < LAT_REPS; ++r) {
+    uint64_t t0 = 0, t1 = 0;
+    switch (f->shape) {
+      case LAT_LD: {
+        long double (*fn)(double) = (long double (*)(double))f->fn;
+        t0 = lat_begin();
+        lat_sink = (double)fn(x);
+        t1 = lat_end();
+        break;
+      }
+      case LAT_D: {
+        double (*fn)(double) = (double (*)(double))f->fn;
+        t0 = lat_begin();
+        lat_sink = fn(x);
+        t1 = lat_end();
+        break;
+      }
+      case LAT_F: {
+        float (*fn)(float) = (float (*)(float))f->fn;
+        t0 = lat_begin();
+        lat_sink = fn((float)x);
+        t1 = lat_end();
+        break;
+      }
+    }
+    if (t1 - t0 < best) {
+      best = t1 - t0;
+    }
+  }
+  return best > lat_overhead ? best - lat_overhead : 0;
+}
+
+static double lat_identity(double x) { return x; }
+
+/* Time of an empty call through the same path, subtracted from every run. */
+static void lat_calibrate(void) {
+  lat_func id = {"identity", LAT_D, (void (*)(void))lat_identity, 0, 1, 0};
+  uint64_t best = UINT64_MAX;
+  lat_overhead = 0;
+  for (int i = 0; i < 1000; ++i) {
+    uint64_t t = lat_time(&id, 1.0);
+    best = t < best ? t : best;
+  }
+  lat_overhead = best;
+}
+
+static void lat_record(lat_result *res, double x, uint64_t time) {
+  for (int i = 0; i < LAT_WORST; ++i) {
+    if (res->worst[i].time > 0 && res->worst[i].x == x) {
+      return;
+    }
+  }
+  int slot = LAT_WORST - 1;
+  if (time <= res->worst[slot].time) {
+    return;
+  }
+  while (slot > 0 && res->worst[slot - 1].time < time) {
+    res->worst[slot] = res->worst[slot - 1];
+    --slot;
+  }
+  res->worst[slot].x = x;
+  res->worst[slot].time = time;
+}
+
+/* Samples `n` points of [t0, t1) and returns the slowest time seen. */
+static uint64_t lat_probe(const lat_func *f, lat_result *res, double t0,
+                          double t1, int n, int uniform, uint64_t *state) {
+  uint64_t slowest = 0;
+  for (int i = 0; i < n; ++i) {
+    double x = lat_map(f, t0 + (t1 - t0) * lat_unit(state));
+    uint64_t time = lat_time(f, x);
+    lat_record(res, x, time);
+    if (uniform) {
+      int b = 0;
+      while (b < LAT_BUCKETS - 1 && (time >> (b + 1)) > 0) {
+        ++b;
+      }
+      res->buckets[b]++;
+      res->samples[res->count++] = time;
+    }
+    slowest = time > slowest ? time : slowest;
+  }
+  return slowest;
+}
+
+typedef struct {
+  double t0, t1;
+  uint64_t slowest;
+} lat_cell;
+
+static int lat_cell_cmp(const void *a, const void *b) {
+  uint64_t sa = ((const lat_cell *)a)->slowest;
+  uint64_t sb = ((const lat_cell *)b)->slowest;
+  return (sa < sb) - (sa > sb);
+}
+
+static int lat_u64_cmp(const void *a, const void *b) {
+  uint64_t ua = *(const uint64_t *)a;
+  uint64_t ub = *(const uint64_t *)b;
+  return (ua > ub) - (ua < ub);
+}
+
+static void lat_explore(const lat_func *f, lat_result *res) {
+  uint64_t state = 0x9e3779b97f4a7c15ULL;
+  static lat_cell cells[LAT_CELLS], next[LAT_REFINE * LAT_SPLIT];
+
+  for (int c = 0; c < LAT_CELLS; ++c) {
+    cells[c].t0 = (double)c / LAT_CELLS;
+    cells[c].t1 = (double)(c + 1) / LAT_CELLS;
+    cells[c].slowest = lat_probe(f, res, cells[c].t0, cells[c].t1,
+                                 LAT_SAMPLES, 1, &state);
+  }
+
+  size_t live = LAT_CELLS;
+  for (int level = 0; level < LAT_LEVELS; ++level) {
+    qsort(cells, live, sizeof(cells[0]), lat_cell_cmp);
+    size_t n = 0;
+    for (int c = 0; c < LAT_REFINE && (size_t)c < live; ++c) {
+      double w = (cells[c].t1 - cells[c].t0) / LAT_SPLIT;
+      for (int s = 0; s < LAT_SPLIT; ++s) {
+        next[n].t0 = cells[c].t0 + w * s;
+        next[n].t1 = next[n].t0 + w;
+        next[n].slowest =
+            lat_probe(f, res, next[n].t0, next[n].t1, LAT_SAMPLES, 0, &state);
+        ++n;
+      }
+    }
+    memcpy(cells, next, n * sizeof(cells[0]));
+    live = n;
+  }
+
+  qsort(res->samples, res->count, sizeof(res->samples[0]), lat_u64_cmp);
+}
+
+static uint64_t lat_percentile(const lat_result *res, double p) {
+  size_t i = (size_t)(p * (double)(res->count - 1));
+  return res->samples[i];
+}
+
+static void lat_print(const lat_func *f, const lat_result *res) {
+  printf("%s\n", f->name);
+  printf("  p50 %llu  p99 %llu  p99.9 %llu  max %llu " LAT_UNIT "\n",
+         (unsigned long long)lat_percentile(res, 0.5),
+         (unsigned long long)lat_percentile(res, 0.99),
+         (unsigned long long)lat_percentile(res, 0.999),
+         (unsigned long long)res->worst[0].time);
+  printf("  worst inputs:");
+  for (int i = 0; i < LAT_WORST && res->worst[i].time; ++i) {
+    printf(" %.17g (%llu)", res->worst[i].x,
+           (unsigned long long)res->worst[i].time);
+  }
+  printf("\n");
+
+  uint64_t peak = 1;
+  for (int b = 0; b < LAT_BUCKETS; ++b) {
+    peak = res->buckets[b] > peak ? res->buckets[b] : peak;
+  }
+  for (int b = 0; b < LAT_BUCKETS; ++b) {
+    if (res->buckets[b] == 0) {
+      continue;
+    }
+    int bar = (int)(40 * res->buckets[b] / peak);
+    printf("  %6llu-%-6llu %7llu %.*s\n", b ? 1ULL << b : 0ULL,
+           (2ULL << b) - 1, (unsigned long long)res->buckets[b], bar,
+           "########################################");
+  }
+}
+
+static void lat_json(FILE *out, const lat_func *f, const lat_result *res,
+                     int first) {
+  fprintf(out, "%s\n    {\"function\": \"%s\", \"p50\": %llu, ",
+          first ? "" : ",", f->name,
+          (unsigned long long)lat_percentile(res, 0.5));
+  fprintf(out, "\"p99\": %llu, \"p999\": %llu, \"max\": %llu, ",
+          (unsigned long long)lat_percentile(res, 0.99),
+          (unsigned long long)lat_percentile(res, 0.999),
+          (unsigned long long)res->worst[0].time);
+  fprintf(out, "\"worst\": [");
+  for (int i = 0; i < LAT_WORST && res->worst[i].time; ++i) {
+    fprintf(out, "%s{\"x\": %.17g, \"time\": %llu}", i ? ", " : "",
+            res->worst[i].x, (unsigned long long)res->worst[i].time);
+  }
+  fprintf(out, "], \"histogram\": [");
+  for (int b = 0; b < LAT_BUCKETS; ++b) {
+    fprintf(out, "%s%llu", b ? ", " : "",
+            (unsigned long long)res->buckets[b]);
+  }
+  fprintf(out, "]}");
+}
+
+int main(int argc, char **argv) {
+  const char *path = NULL;
+  const char *filter = NULL;
+  for (int i = 1; i < argc; ++i) {
+    if (strcmp(argv[i], "-o") == 0 && i + 1 < argc) {
+      path = argv[++i];
+    } else if (strcmp(argv[i], "-f") == 0 && i + 1 < argc) {
+      filter = argv[++i];
+    } else {
+      fprintf(stderr, "usage: %s [-o FILE] [-f FUNCTION]\n", argv[0]);
+      return 2;
+    }
+  }
+
+  FILE *out = NULL;
+  if (path) {
+    out = fopen(path, "w");
+    if (out == NULL) {
+      perror(path);
+      return 1;
+    }
+    fprintf(out, "{\n  \"unit\": \"" LAT_UNIT "\",\n  \"results\": [");
+  }
+
+  static uint64_t samples[LAT_CELLS * LAT_SAMPLES];
+  lat_calibrate();
+  printf("call overhead %llu " LAT_UNIT " (subtracted)\n\n",
+         (unsigned long long)lat_overhead);
+
+  int first = 1;
+  for (size_t i = 0; i < LAT_FUNCS; ++i) {
+    const lat_func *f = &lat_funcs[i];
+    if (filter && strstr(f->name, filter) == NULL) {
+      continue;
+    }
+
+    lat_result res;
+    memset(&res, 0, sizeof(res));
+    res.samples = samples;
+    lat_explore(f, &res);
+    lat_print(f, &res);
+    if (out) {
+      lat_json(out, f, &res, first);
+    }
+    first = 0;
+  }
+
+  if (out) {
+    fprintf(out, "\n  ]\n}\n");
+    fclose(out);
+  }
+  return 0;
+}
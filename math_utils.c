@@ -1,254 +1,184 @@
 #include "math_utils.h"
+#include "math_utils_internal.h"
 
 long int mu_abs(int x) { return x > 0 ? x : -x; }
 
-long double mu_fabs(double x) { return x > 0 ? x : -x; }
+long double mu_fabs(double x) { return mu_fabs_d(x); }
 
-long double mu_trunc(double x) { return (x >= 0.0) ? mu_floor(x) : mu_ceil(x); }
+long double mu_trunc(double x) { return mu_trunc_d(x); }
 
-long double mu_ceil(double x) {
-  if (x >= LLONG_MAX || x <= LLONG_MIN || x != x) {
-    return (long double)x;
-  }
-  long long int_part = (long long)x;
-  return (x > int_part) ? (long double)(int_part + 1) : (long double)int_part;
-}
+long double mu_ceil(double x) { return mu_ceil_d(x); }
 
-long double mu_floor(double x) {
-  if (x >= LLONG_MAX || x <= LLONG_MIN || x != x) {
-    return (long double)x;
-  }
-  long long int_part = (long long)x;
-  return (x < int_part) ? (long double)(int_part - 1) : (long double)int_part;
+long double mu_floor(double x) { return mu_floor_d(x); }
+
+long double mu_round(double x) { return mu_round_d(x); }
+
+long double mu_nearbyint(double x) { return mu_nearbyint_d(x); }
+
+long double mu_modf(double x, long double *iptr) {
+  double t;
+  long double frac = mu_modf_d(x, &t);
+  *iptr = t;
+  return frac;
 }
 
-long double mu_fmod(double x, double y) {
-  if (mu_fabs(x) == MU_INF) {
-    return MU_NAN;
-  } else if (mu_fabs(y) == MU_INF) {
-    return x;
-  }
-  return (long double)(x - mu_trunc(x / y) * y);
+long int mu_lround(double x) {
+  double r = mu_round_d(x);
+  /* NaN and out-of-range inputs give LONG_MIN, like cvtsd2si. */
+  return (r >= (double)LONG_MIN && r < -(double)LONG_MIN) ? (long int)r
+                                                          : LONG_MIN;
 }
 
-long double mu_sin(double x) {
-  if (x != x || mu_fabs(x) == MU_INF) {
-    return MU_NAN;
-  }
+long double mu_fmod(double x, double y) { return mu_fmod_d(x, y); }
 
-  x = mu_fmod(x, 2.0 * MU_PI);
-  long double res = 0.0;
-  long double arg = x;
-  unsigned int k = 1;
-  int sign = 1;
-
-  while (mu_fabs(arg) > MU_EPS20) {
-    res += sign * arg;
-    k += 2;
-    sign = -sign;
-    arg *= (x * x) / (k * (k - 1));
-  }
+long double mu_remainder(double x, double y) { return mu_remainder_d(x, y); }
 
-  return res;
+long double mu_remquo(double x, double y, int *quo) {
+  return mu_remquo_d(x, y, quo);
 }
 
-long double mu_cos(double x) {
-  if (x != x || mu_fabs(x) == MU_INF) {
-    return MU_NAN;
-  }
+long double mu_sin(double x) { return mu_sin_d(x); }
 
-  x = mu_fmod(x, 2.0 * MU_PI);
-  long double res = 0.0;
-  long double arg = 1.0;
-  unsigned int k = 0;
-  int sign = 1;
-
-  while (mu_fabs(arg) > MU_EPS20) {
-    res += sign * arg;
-    k += 2;
-    sign = -sign;
-    arg *= (x * x) / (k * (k - 1));
-  }
+long double mu_cos(double x) { return mu_cos_d(x); }
 
-  return res;
+void mu_sincos(double x, long double *s, long double *c) {
+  double sin_r, cos_r;
+  mu_sincos_d(x, &sin_r, &cos_r);
+  *s = sin_r;
+  *c = cos_r;
 }
 
-long double mu_tan(double x) { return mu_sin(x) / mu_cos(x); }
+long double mu_tan(double x) { return mu_tan_d(x); }
 
-long double mu_asin(double x) {
-  if (x != x || mu_fabs(x) > 1.0) {
-    return MU_NAN;
-  } else if (mu_fabs(x) == 1.0) {
-    return MU_PI / 2 * x;
-  }
+long double mu_sinpi(double x) { return mu_sinpi_d(x); }
 
-  long double res = x;
-  long double arg = x;
-  unsigned int k = 1;
+long double mu_cospi(double x) { return mu_cospi_d(x); }
 
-  while (mu_fabs(arg) > MU_EPS20) {
-    arg *= x * x * (2 * k - 1) * (2 * k - 1) / ((2 * k + 1) * 2 * k);
-    res += arg;
-    k++;
-  }
-
-  return res;
+void mu_sincospi(double x, long double *s, long double *c) {
+  double sin_r, cos_r;
+  mu_sincospi_d(x, &sin_r, &cos_r);
+  *s = sin_r;
+  *c = cos_r;
 }
 
-long double mu_acos(double x) {
-  if (x != x || mu_fabs(x) > 1.0) {
-    return MU_NAN;
-  }
+long double mu_tanpi(double x) { return mu_tanpi_d(x); }
 
-  return MU_PI / 2 - mu_asin(x);
-}
+long double mu_sind(double x) { return mu_sind_d(x); }
 
-long double mu_atan(double x) {
-  if (mu_fabs(x) == MU_INF) {
-    return (x > 0) ? MU_PI / 2 : -MU_PI / 2;
-  }
+long double mu_cosd(double x) { return mu_cosd_d(x); }
 
-  return mu_asin(x / mu_sqrt(1.0 + x * x));
+void mu_sincosd(double x, long double *s, long double *c) {
+  double sin_r, cos_r;
+  mu_sincosd_d(x, &sin_r, &cos_r);
+  *s = sin_r;
+  *c = cos_r;
 }
 
-long double mu_sqrt(double x) {
-  if (x < 0 || x != x || mu_fabs(x) == MU_INF) {
-    return MU_NAN;
-  }
+long double mu_asin(double x) { return mu_asin_d(x); }
 
-  long double res = 4.0;
-  long double arg = 0.0;
+long double mu_acos(double x) { return mu_acos_d(x); }
 
-  while (mu_fabs(res - arg) > MU_EPS20) {
-    arg = res;
-    res = 0.5 * (arg + x / arg);
+long double mu_atan(double x) { return mu_atan_d(x); }
+
+long double mu_atan2(double y, double x) { return mu_atan2_d(y, x); }
+
+long double mu_sqrt(double x) {
+  long double s = mu_sqrt_d(x);
+  if (x == 0.0 || s != s) {
+    return s;
   }
 
-  return res;
+  /* One Newton step in extended precision refines the double root. */
+  return s + ((long double)x - s * s) / (2 * s);
 }
 
-long double mu_pow(double base, double exp) {
-  if (exp == 0.0 || base == 1.0) {
-    return 1.0;
+long double mu_rsqrt(double x) {
+  if (x < 0 || x != x) {
+    return MU_NAN;
   }
 
-  if (base == 0.0) {
-    return (exp != exp) ? MU_NAN : (exp > 0) ? 0.0 : MU_INF;
+  if (x == 0.0) {
+    return 1.0 / x;
   }
 
-  if (exp == 1.0) {
-    return base;
+  if (x == MU_INF) {
+    return 0.0;
   }
 
-  if (exp == -1.0) {
-    return 1.0 / base;
-  }
+  return 1.0L / mu_sqrt(x);
+}
 
-  if (mu_fabs(base) == MU_INF && (long long)exp != exp) {
-    return (exp != exp) ? MU_NAN : (exp > 0) ? MU_INF : 0.0;
-  }
+long double mu_pow(double base, double exp) { return mu_pow_d(base, exp); }
 
-  if (base < 0 && (long long)exp != exp) {
-    if (mu_fabs(exp) == MU_INF) {
-      if (base > -1.0) {
-        if (exp == -MU_INF) {
-          return MU_INF;
-        }
-        return 0.0;
-      }
-      if (base == -1.0) {
-        return 1.0;
-      }
-      if (exp == -MU_INF) {
-        return 0.0;
-      }
-      return MU_INF;
-    }
-    return MU_NAN;
-  }
+mu_pow_plan mu_pow_plan_base(double base) {
+  mu_pow_plan plan = {base, 0.0, 0.0, MU_POW_PLAN_GENERIC, MU_POW_NONINT};
+  double abs_base = mu_fabs_d(base);
 
-  if (base != base || exp != exp) {
-    return MU_NAN;
+  if (abs_base > 0.0 && abs_base < MU_INF && abs_base != 1.0) {
+    plan.log_hi = mu_log_dd(abs_base, &plan.log_lo);
+    plan.kind = MU_POW_PLAN_BASE;
   }
 
-  if ((long long)exp == exp) {
-    long long int_exp = (long long)exp;
-    long double res = 1.0;
-    int negative = (int_exp < 0) ? 1 : 0;
-    int_exp = mu_fabs(int_exp);
-
-    while (int_exp > 0) {
-      if (int_exp & 1) {
-        res *= base;
-      }
-      base *= base;
-      int_exp >>= 1;
-    }
-
-    return (negative) ? 1.0 / res : res;
-  }
+  return plan;
+}
 
-  return mu_exp(exp * mu_log(base));
+mu_pow_plan mu_pow_plan_exp(double exp) {
+  mu_pow_plan plan = {exp, 0.0, 0.0, MU_POW_PLAN_EXP, mu_pow_int_class(exp)};
+  return plan;
 }
 
-long double mu_exp(double x) {
-  if (x != x) {
-    return MU_NAN;
-  }
-  if (x == MU_INF) {
-    return MU_INF;
-  }
-  if (x == -MU_INF) {
-    return 0.0;
-  }
+long double mu_pow_apply(const mu_pow_plan *plan, double x) {
+  return mu_pow_apply_d(plan, x);
+}
 
-  int negative = 0;
-  if (x < 0) {
-    x = -x;
-    negative = 1;
-  }
+long double mu_exp(double x) { return mu_exp_d(x); }
 
-  long double res = 1.0;
-  long double arg = 1.0;
-  unsigned int k = 1;
+long double mu_exp2(double x) { return mu_exp2_d(x); }
 
-  while (mu_fabs(arg) > MU_EPS20) {
-    arg *= x / k;
-    res += arg;
-    k++;
-  }
+long double mu_exp10(double x) { return mu_exp10_d(x); }
 
-  res = (negative) ? 1.0 / res : res;
+long double mu_expm1(double x) { return mu_expm1_d(x); }
 
-  return res;
-}
+long double mu_log(double x) { return mu_log_d(x); }
 
-long double mu_log(double x) {
-  if (x == 0.0) {
-    return -MU_INF;
+long double mu_log2(double x) { return mu_log2_d(x); }
+
+long double mu_log10(double x) { return mu_log10_d(x); }
+
+long double mu_log1p(double x) { return mu_log1p_d(x); }
+
+int mu_ilogb(double x) {
+  uint64_t ax = mu_as_u64(x) & 0x7fffffffffffffffULL;
+  if (ax >= 0x7ff0000000000000ULL) {
+    return ax == 0x7ff0000000000000ULL ? INT_MAX : MU_FP_ILOGBNAN;
   }
-  if (x < 0 || x != x) {
-    return MU_NAN;
+  if (ax == 0) {
+    return MU_FP_ILOGB0;
   }
-  if (x == MU_INF) {
-    return MU_INF;
+  /* Subnormals are scaled into the normal range first. */
+  if (ax < 0x0010000000000000ULL) {
+    return (int)(mu_as_u64(mu_fabs_d(x) * 0x1p64) >> 52) - 1023 - 64;
   }
+  return (int)(ax >> 52) - 1023;
+}
 
-  long double res = 0.0;
-  while (x >= 2.0) {
-    x /= 2.0;
-    res += MU_LN2;
-  }
+long double mu_ldexp(double x, int n) { return mu_ldexp_d(x, n); }
 
-  x -= 1.0;
-  long double arg = x;
-  unsigned int k = 1;
+long double mu_sinh(double x) { return mu_sinh_d(x); }
 
-  while (mu_fabs(arg) > MU_EPS20) {
-    res += arg;
-    k++;
-    arg *= -x * (k - 1) / k;
-  }
+long double mu_cosh(double x) { return mu_cosh_d(x); }
 
-  return res;
+void mu_sinhcosh(double x, long double *s, long double *c) {
+  double sinh_r, cosh_r;
+  mu_sinhcosh_d(x, &sinh_r, &cosh_r);
+  *s = sinh_r;
+  *c = cosh_r;
 }
+
+long double mu_tanh(double x) { return mu_tanh_d(x); }
+
+long double mu_asinh(double x) { return mu_asinh_d(x); }
+
+long double mu_acosh(double x) { return mu_acosh_d(x); }
+
+long double mu_atanh(double x) { return mu_atanh_d(x); }
@@ -2,6 +2,7 @@
 #define MATH_MATH_UTILS_H_
 
 #include <limits.h>
+#include <stddef.h>
 
 /**
  * @brief Represents a small positive floating-point epsilon value, 1e-6 (1 ×
@@ -77,6 +78,43 @@
  * @brief Represents a Not-a-Number (NaN) value.
  */
 #define MU_NAN 0.0 / 0.0
+/**
+ * @brief Fast accuracy tier: relative error below MU_EPS6.
+ */
+#define MU_ACCURACY_FAST 0
+/**
+ * @brief Medium accuracy tier: relative error below MU_EPS10.
+ */
+#define MU_ACCURACY_MEDIUM 1
+/**
+ * @brief Full accuracy tier: the `_d` and batch functions, within about 1 ULP.
+ */
+#define MU_ACCURACY_FULL 2
+/**
+ * @brief Compile-time default tier used by MU_TIER() and MU_TIER_N().
+ *
+ * Define it to MU_ACCURACY_FAST or MU_ACCURACY_MEDIUM before including this
+ * header to switch every tiered call site of a translation unit at once.
+ */
+#ifndef MU_ACCURACY
+#define MU_ACCURACY MU_ACCURACY_FULL
+#endif
+/**
+ * @brief MU_TIER() and MU_TIER_N() select the scalar and the batch function of
+ * a tiered family for MU_ACCURACY, e.g. `MU_TIER(mu_sin)(x)` or
+ * `MU_TIER_N(mu_exp)(in, out, n)`. Tiered families are mu_sin, mu_cos, mu_exp
+ * and mu_log.
+ */
+#if MU_ACCURACY == MU_ACCURACY_FAST
+#define MU_TIER(name) name##_fast
+#define MU_TIER_N(name) name##_fast_n
+#elif MU_ACCURACY == MU_ACCURACY_MEDIUM
+#define MU_TIER(name) name##_medium
+#define MU_TIER_N(name) name##_medium_n
+#else
+#define MU_TIER(name) name##_d
+#define MU_TIER_N(name) name##_n
+#endif
 
 /**
  * @brief Computes the absolute value of an integer.
@@ -95,6 +133,12 @@ long int mu_abs(int x);
  * This function calculates the absolute value of the given double-precision
  * floating-point number.
  *
+ * The `long double` functions return the result of their `_d` form widened to
+ * `long double`, so they carry double precision only: the extra bits of the
+ * x87 format are zero. Only mu_sqrt() and mu_rsqrt() refine their result in
+ * extended precision. Earlier releases evaluated every function in
+ * `long double` arithmetic.
+ *
  * @param x Double-precision floating-point number for which absolute value is
  * calculated.
  * @return Absolute value of the input double-precision floating-point number.
@@ -139,12 +183,59 @@ long double mu_ceil(double x);
  */
 long double mu_floor(double x);
 
+/**
+ * @brief Rounds a double-precision floating-point number to the nearest
+ * integer, with halfway cases rounded away from zero.
+ *
+ * Unlike `floor(x + 0.5)`, the rounding is exact for every input, including
+ * 0.49999999999999994 and odd integers above 2^52.
+ *
+ * @param x Double-precision floating-point number to be rounded.
+ * @return Nearest integer to `x`, halfway cases away from zero.
+ */
+long double mu_round(double x);
+
+/**
+ * @brief Rounds a double-precision floating-point number to an integer in the
+ * current rounding direction.
+ *
+ * In the default direction halfway cases go to the even integer, as with
+ * banker's rounding.
+ *
+ * @param x Double-precision floating-point number to be rounded.
+ * @return `x` rounded in the current rounding direction.
+ */
+long double mu_nearbyint(double x);
+
+/**
+ * @brief Splits a double-precision floating-point number into its integral
+ * and fractional parts.
+ *
+ * Both parts carry the sign of `x`. Infinities have a zero fractional part.
+ *
+ * @param x Double-precision floating-point number to be split.
+ * @param iptr Receives `x` rounded toward zero.
+ * @return Fractional part of `x`, exact.
+ */
+long double mu_modf(double x, long double *iptr);
+
+/**
+ * @brief Rounds a double-precision floating-point number to the nearest
+ * `long int`, with halfway cases rounded away from zero.
+ *
+ * @param x Double-precision floating-point number to be rounded.
+ * @return Nearest integer to `x`, or LONG_MIN if `x` is NaN or the result does
+ * not fit in `long int`.
+ */
+long int mu_lround(double x);
+
 /**
  * @brief Computes the remainder of dividing two double-precision floating-point
  * numbers.
  *
  * This function calculates the remainder of dividing the absolute values of `x`
- * by `y`, preserving the sign of the dividend.
+ * by `y`, preserving the sign of the dividend. The result is exact for every
+ * finite `x` and nonzero `y`.
  *
  * @param x Double-precision floating-point dividend.
  * @param y Double-precision floating-point divisor.
@@ -152,11 +243,42 @@ long double mu_floor(double x);
  */
 long double mu_fmod(double x, double y);
 
+/**
+ * @brief Computes the IEEE remainder of dividing two double-precision
+ * floating-point numbers.
+ *
+ * This function calculates `x - n * y`, where `n` is `x / y` rounded to the
+ * nearest integer, ties to even. The result is exact and lies in
+ * [-|y| / 2, |y| / 2].
+ *
+ * @param x Double-precision floating-point dividend.
+ * @param y Double-precision floating-point divisor.
+ * @return Remainder of `x / y`, or NaN if `x` is infinite or `y` is zero.
+ */
+long double mu_remainder(double x, double y);
+
+/**
+ * @brief Computes the IEEE remainder of dividing two double-precision
+ * floating-point numbers, and the low bits of the quotient.
+ *
+ * The remainder is the one of mu_remainder(). `*quo` receives the rounded
+ * quotient `n` reduced modulo 2^31, with the sign of `x / y`, so its low bits
+ * give the octant or quadrant of a reduction by a fraction of a period.
+ *
+ * @param x Double-precision floating-point dividend.
+ * @param y Double-precision floating-point divisor.
+ * @param quo Output for the low 31 bits of the quotient; 0 for NaN results.
+ * @return Remainder of `x / y`, or NaN if `x` is infinite or `y` is zero.
+ */
+long double mu_remquo(double x, double y, int *quo);
+
 /**
  * @brief Computes the sine of a double-precision floating-point number.
  *
- * This function calculates the sine of the given angle `x` in radians using the
- * Taylor series expansion.
+ * This function calculates the sine of the given angle `x` in radians. The
+ * argument is reduced to [-π/4, π/4] and a quadrant (Cody-Waite for moderate
+ * angles, Payne-Hanek for huge ones) and then evaluated with fixed-degree
+ * minimax polynomials, so the cost does not depend on the magnitude of `x`.
  *
  * @param x Double-precision floating-point angle in radians.
  * @return Sine of the input angle `x`.
@@ -166,8 +288,8 @@ long double mu_sin(double x);
 /**
  * @brief Computes the cosine of a double-precision floating-point number.
  *
- * This function calculates the cosine of the given angle `x` in radians using
- * the Taylor series expansion.
+ * This function calculates the cosine of the given angle `x` in radians with
+ * the same argument reduction and polynomial kernels as mu_sin().
  *
  * @param x Double-precision floating-point angle in radians.
  * @return Cosine of the input angle `x`.
@@ -177,20 +299,111 @@ long double mu_cos(double x);
 /**
  * @brief Computes the tangent of a double-precision floating-point number.
  *
- * This function calculates the tangent of the given angle `x` in radians by
- * the sine and the cosine Taylor series expansion.
+ * This function calculates the tangent of the given angle `x` in radians. It
+ * shares the argument reduction of mu_sin() and evaluates a rational
+ * approximation of tan, or of -cot in odd quadrants, directly.
  *
  * @param x Double-precision floating-point angle in radians.
  * @return Tangent of the input angle `x`.
  */
 long double mu_tan(double x);
 
+/**
+ * @brief Computes the sine and the cosine of a double-precision floating-point
+ * number at once.
+ *
+ * This function performs a single argument reduction for both results, which
+ * is about half the cost of calling mu_sin() and mu_cos() separately.
+ *
+ * @param x Double-precision floating-point angle in radians.
+ * @param s Receives the sine of `x`.
+ * @param c Receives the cosine of `x`.
+ */
+void mu_sincos(double x, long double *s, long double *c);
+
+/**
+ * @brief Computes sin(πx) of a double-precision floating-point number.
+ *
+ * For angles given in turns or half-turns. Reducing `x` modulo 2 is exact in
+ * binary floating point, so unlike mu_sin(x * π) there is no rounding of the
+ * angle and no reduction by an inexact π: sin(πx) is exactly 0 at integers
+ * and ±1 at half-integers, and every finite `x` costs the same.
+ *
+ * @param x Double-precision floating-point angle in half-turns.
+ * @return sin(πx): +0 at positive integers and -0 at negative ones, NaN for
+ * infinite or NaN `x`.
+ */
+long double mu_sinpi(double x);
+
+/**
+ * @brief Computes cos(πx) of a double-precision floating-point number.
+ *
+ * Uses the exact reduction of mu_sinpi().
+ *
+ * @param x Double-precision floating-point angle in half-turns.
+ * @return cos(πx): +0 at every half-integer, NaN for infinite or NaN `x`.
+ */
+long double mu_cospi(double x);
+
+/**
+ * @brief Computes sin(πx) and cos(πx) at once.
+ *
+ * @param x Double-precision floating-point angle in half-turns.
+ * @param s Receives sin(πx), as mu_sinpi().
+ * @param c Receives cos(πx), as mu_cospi().
+ */
+void mu_sincospi(double x, long double *s, long double *c);
+
+/**
+ * @brief Computes tan(πx) of a double-precision floating-point number.
+ *
+ * Uses the exact reduction of mu_sinpi().
+ *
+ * @param x Double-precision floating-point angle in half-turns.
+ * @return tan(πx). For an integer n, n + 1/2 gives +Inf when n is even and
+ * -Inf when n is odd; n gives a zero of the sign of tan on its right.
+ */
+long double mu_tanpi(double x);
+
+/**
+ * @brief Computes the sine of an angle in degrees.
+ *
+ * The angle is reduced modulo 90 exactly, so sind(180 * k) is exactly 0 and
+ * sind(90 + 180 * k) exactly ±1, and only the final scaling to radians
+ * rounds.
+ *
+ * @param x Double-precision floating-point angle in degrees.
+ * @return Sine of `x` degrees, with the zero signs of mu_sinpi().
+ */
+long double mu_sind(double x);
+
+/**
+ * @brief Computes the cosine of an angle in degrees.
+ *
+ * Uses the exact reduction of mu_sind().
+ *
+ * @param x Double-precision floating-point angle in degrees.
+ * @return Cosine of `x` degrees: +0 at 90 + 180 * k.
+ */
+long double mu_cosd(double x);
+
+/**
+ * @brief Computes the sine and the cosine of an angle in degrees at once.
+ *
+ * @param x Double-precision floating-point angle in degrees.
+ * @param s Receives the sine, as mu_sind().
+ * @param c Receives the cosine, as mu_cosd().
+ */
+void mu_sincosd(double x, long double *s, long double *c);
+
 /**
  * @brief Computes the arcsine (inverse sine) of a double-precision
  * floating-point number.
  *
  * This function calculates the arcsine of the input `x`, returning the result
- * in radians using the Taylor series expansion.
+ * in radians. Arguments below 0.5 in magnitude use a rational minimax
+ * approximation directly; larger ones are reduced with
+ * asin(x) = π/2 - 2 asin(sqrt((1 - |x|) / 2)).
  *
  * @param x Double-precision floating-point number for which the arcsine is
  * calculated.
@@ -203,7 +416,7 @@ long double mu_asin(double x);
  * floating-point number.
  *
  * This function calculates the arccosine of the input `x`, returning the result
- * in radians using the Taylor series expansion.
+ * in radians, on the same reductions and approximation as mu_asin().
  *
  * @param x Double-precision floating-point number for which the arccosine is
  * calculated.
@@ -216,7 +429,9 @@ long double mu_acos(double x);
  * floating-point number.
  *
  * This function calculates the arctangent of the input `x`, returning the
- * result in radians using the Taylor series expansion.
+ * result in radians. The argument is reduced against the nearest of 0, 1/2, 1,
+ * 3/2 and infinity (atan(x) = π/2 - atan(1/x) for the last) and finished with
+ * a minimax polynomial.
  *
  * @param x Double-precision floating-point number for which the arctangent is
  * calculated.
@@ -224,12 +439,28 @@ long double mu_acos(double x);
  */
 long double mu_atan(double x);
 
+/**
+ * @brief Computes the arctangent of `y / x` using the signs of both arguments
+ * to determine the quadrant.
+ *
+ * This function calculates the angle of the point (`x`, `y`) in radians, in
+ * the range [-π, π]. Signed zeros and infinities follow the C standard
+ * conventions, e.g. mu_atan2(0.0, -0.0) is π and mu_atan2(inf, inf) is π/4.
+ *
+ * @param y Double-precision floating-point ordinate.
+ * @param x Double-precision floating-point abscissa.
+ * @return Angle of the point (`x`, `y`) in radians.
+ */
+long double mu_atan2(double y, double x);
+
 /**
  * @brief Computes the square root of a non-negative double-precision
  * floating-point number.
  *
- * This function calculates the square root of the input `x` using the Taylor
- * series expansion.
+ * This function calculates the square root of the input `x` with the hardware
+ * square root instruction where available, or from a seed built by halving
+ * the exponent bits followed by a fixed number of Newton steps. The double
+ * result is then refined by one Newton step in extended precision.
  *
  * @param x Non-negative double-precision floating-point number for which the
  * square root is calculated.
@@ -237,11 +468,27 @@ long double mu_atan(double x);
  */
 long double mu_sqrt(double x);
 
+/**
+ * @brief Computes the reciprocal square root of a non-negative
+ * double-precision floating-point number.
+ *
+ * This function calculates 1 / sqrt(`x`) on top of mu_sqrt(). Positive
+ * infinity gives zero and a zero argument gives an infinity of the same sign.
+ *
+ * @param x Non-negative double-precision floating-point number for which the
+ * reciprocal square root is calculated.
+ * @return Reciprocal square root of the input `x`.
+ */
+long double mu_rsqrt(double x);
+
 /**
  * @brief Computes the power of a double-precision floating-point number.
  *
- * This function calculates `base` raised to the power of `exp` using the Taylor
- * series expansion.
+ * This function calculates `base` raised to the power of `exp` as
+ * exp(`exp` * log(|`base`|)). The logarithm is carried with about 68 bits of
+ * precision and the product is kept as a double-double, so the result stays
+ * within one ULP even when it is very large or very small. Special values
+ * follow the C standard, including the sign of odd integer powers.
  *
  * @param base Base value.
  * @param exp Exponent value.
@@ -249,12 +496,62 @@ long double mu_sqrt(double x);
  */
 long double mu_pow(double base, double exp);
 
+/**
+ * @brief Prepared operand of mu_pow() for loops where the base or the
+ * exponent is fixed.
+ *
+ * Created by mu_pow_plan_base() or mu_pow_plan_exp() and evaluated with
+ * mu_pow_apply() or mu_pow_apply_n(). The fields are internal.
+ */
+typedef struct {
+  double value;
+  double log_hi;
+  double log_lo;
+  int kind;
+  int cls;
+} mu_pow_plan;
+
+/**
+ * @brief Prepares mu_pow() calls with a fixed base.
+ *
+ * This function computes the extended-precision logarithm of `base` once,
+ * so that every later mu_pow_apply() costs a single exponential.
+ *
+ * @param base Base value shared by all calls.
+ * @return Plan to pass to mu_pow_apply() with the exponent.
+ */
+mu_pow_plan mu_pow_plan_base(double base);
+
+/**
+ * @brief Prepares mu_pow() calls with a fixed exponent.
+ *
+ * This function classifies `exp` (non-integral, even or odd integer) once,
+ * so that later calls skip the per-element special-case analysis.
+ *
+ * @param exp Exponent value shared by all calls.
+ * @return Plan to pass to mu_pow_apply() with the base.
+ */
+mu_pow_plan mu_pow_plan_exp(double exp);
+
+/**
+ * @brief Evaluates a prepared power.
+ *
+ * @param plan Plan created by mu_pow_plan_base() or mu_pow_plan_exp().
+ * @param x Exponent for a base plan, or base for an exponent plan.
+ * @return The same value as the corresponding mu_pow() call.
+ */
+long double mu_pow_apply(const mu_pow_plan *plan, double x);
+
 /**
  * @brief Computes the exponential of a double-precision floating-point
  * number.
  *
  * This function calculates the exponential (e^x) of the given double-precision
- * floating-point number.
+ * floating-point number. The argument is split as x = (k + j/128) * ln2 + r,
+ * e^r is evaluated with a short polynomial, 2^(j/128) is read from a table and
+ * 2^k is applied directly to the exponent bits, so the cost is the same over
+ * the whole finite domain. Results beyond the double range overflow to
+ * infinity or round to zero.
  *
  * @param x Double-precision floating-point number for which the exponential is
  * calculated.
@@ -262,12 +559,52 @@ long double mu_pow(double base, double exp);
  */
 long double mu_exp(double x);
 
+/**
+ * @brief Computes 2 raised to a double-precision floating-point number.
+ *
+ * Uses the table of mu_exp() with the split x = k + j/128 + r taken directly,
+ * which is exact, so only 2^r = e^(r ln2) comes from the polynomial and
+ * integral `x` gives an exact power of two.
+ *
+ * @param x Double-precision floating-point number.
+ * @return 2^x: +Inf from 1024 on, 0 from -1075 down, NaN for NaN.
+ */
+long double mu_exp2(double x);
+
+/**
+ * @brief Computes 10 raised to a double-precision floating-point number.
+ *
+ * Evaluates e^(x ln10) with the product carried as a double-double into the
+ * reduction of mu_exp(), as mu_pow() does for y log(x), so large |x| keeps
+ * full precision.
+ *
+ * @param x Double-precision floating-point number.
+ * @return 10^x: +Inf above log10(DBL_MAX), 0 below about -323.6, NaN for NaN.
+ */
+long double mu_exp10(double x);
+
+/**
+ * @brief Computes e^x - 1 without the cancellation of mu_exp(x) - 1.
+ *
+ * Below 1/16 in magnitude the result is the Taylor polynomial of e^x - 1;
+ * above, the table value 2^k 2^(j/128) of mu_exp() is kept apart from the
+ * polynomial term so that the 1 is subtracted exactly.
+ *
+ * @param x Double-precision floating-point number.
+ * @return e^x - 1: `x` itself for tiny `x`, -1 for large negative `x`, +Inf
+ * above about 709.78, NaN for NaN.
+ */
+long double mu_expm1(double x);
+
 /**
  * @brief Computes the natural logarithm of a positive double-precision
  * floating-point number.
  *
  * This function calculates the natural (base e) logarithm of the given positive
- * double-precision floating-point number.
+ * double-precision floating-point number. The exponent is read from the IEEE
+ * bits, the top mantissa bits select a reciprocal and a logarithm from a table
+ * and a short polynomial finishes the evaluation, so the cost is the same for
+ * every positive finite input.
  *
  * @param x Positive double-precision floating-point number for which the
  * natural logarithm is calculated.
@@ -275,4 +612,2625 @@ long double mu_exp(double x);
  */
 long double mu_log(double x);
 
+/**
+ * @brief Computes the base-2 logarithm of a positive double-precision
+ * floating-point number.
+ *
+ * Runs the reduction of mu_log(), keeps log(c) + r as a double-double and
+ * scales it by a two-part 1/ln2 before adding the exponent, so the cost is
+ * about that of one logarithm and exact powers of two give exact results.
+ *
+ * @param x Positive double-precision floating-point number.
+ * @return Base-2 logarithm of `x`: -Inf for ±0, NaN below 0 and for NaN.
+ */
+long double mu_log2(double x);
+
+/**
+ * @brief Computes the base-10 logarithm of a positive double-precision
+ * floating-point number.
+ *
+ * As mu_log2(), with the scale 1/ln10 and the exponent weighted by a two-part
+ * log10(2).
+ *
+ * @param x Positive double-precision floating-point number.
+ * @return Base-10 logarithm of `x`: -Inf for ±0, NaN below 0 and for NaN.
+ */
+long double mu_log10(double x);
+
+/**
+ * @brief Computes log(1 + x) without the rounding of 1 + x.
+ *
+ * Below 2^-5 in magnitude it takes the series of mu_log() near 1 directly on
+ * `x`. Elsewhere 1 + x is rounded and the part of `x` the rounding lost is
+ * added back to the logarithm as its first-order term.
+ *
+ * @param x Double-precision floating-point number, at least -1.
+ * @return log(1 + x): -Inf at -1, NaN below -1 and for NaN.
+ */
+long double mu_log1p(double x);
+
+/**
+ * @brief Value of mu_ilogb() for zero, as FP_ILOGB0 on x86.
+ */
+#define MU_FP_ILOGB0 INT_MIN
+/**
+ * @brief Value of mu_ilogb() for NaN, as FP_ILOGBNAN on x86.
+ */
+#define MU_FP_ILOGBNAN INT_MIN
+
+/**
+ * @brief Extracts the binary exponent of a double-precision floating-point
+ * number.
+ *
+ * Reads the exponent bits; subnormals are scaled into the normal range first,
+ * so the result is exact for every finite nonzero `x`.
+ *
+ * @param x Double-precision floating-point number.
+ * @return floor(log2|x|) as an `int`: MU_FP_ILOGB0 for ±0, MU_FP_ILOGBNAN for
+ * NaN and INT_MAX for ±Inf.
+ */
+int mu_ilogb(double x);
+
+/**
+ * @brief Multiplies a double-precision floating-point number by 2^n.
+ *
+ * Scales in at most three exact power-of-two products, arranged so that only
+ * the last one can round; the result is exact unless it overflows or is
+ * subnormal, and then it is correctly rounded.
+ *
+ * @param x Double-precision floating-point number.
+ * @param n Power of two to scale by.
+ * @return x * 2^n, correctly rounded.
+ */
+long double mu_ldexp(double x, int n);
+
+/**
+ * @brief Computes the hyperbolic sine of a double-precision floating-point
+ * number.
+ *
+ * Below 1 in magnitude the result is the odd Taylor polynomial of sinh.
+ * Above, it takes a single exponential: (E + E / (E + 1)) / 2 with
+ * E = e^|x| - 1 from an expm1 form of the exp kernel below 22, which avoids
+ * the cancellation of (e^|x| - e^-|x|) / 2, and e^(|x| - ln2) from 22 on,
+ * which stays finite up to log(2 * DBL_MAX) although e^|x| overflows before.
+ *
+ * @param x Double-precision floating-point number.
+ * @return Hyperbolic sine of `x`: ±Inf beyond ±710.4758, NaN for NaN.
+ */
+long double mu_sinh(double x);
+
+/**
+ * @brief Computes the hyperbolic cosine of a double-precision floating-point
+ * number.
+ *
+ * Takes a single exponential like mu_sinh(): 1 + E^2 / (2 (1 + E)) below
+ * ln2 / 2 in magnitude, (T + 1 / T) / 2 with T = E + 1 kept as an exact sum
+ * below 22 and e^(|x| - ln2) from there on.
+ *
+ * @param x Double-precision floating-point number.
+ * @return Hyperbolic cosine of `x`: at least 1, +Inf beyond ±710.4758, NaN
+ * for NaN.
+ */
+long double mu_cosh(double x);
+
+/**
+ * @brief Computes the hyperbolic sine and cosine at once.
+ *
+ * Both results come from the same exponential, so the pair costs about as
+ * much as one of mu_sinh() and mu_cosh(), and they are bit-identical to the
+ * results of those two.
+ *
+ * @param x Double-precision floating-point number.
+ * @param s Receives the hyperbolic sine, as mu_sinh().
+ * @param c Receives the hyperbolic cosine, as mu_cosh().
+ */
+void mu_sinhcosh(double x, long double *s, long double *c);
+
+/**
+ * @brief Computes the hyperbolic tangent of a double-precision floating-point
+ * number.
+ *
+ * Takes a single expm1: -E / (E + 2) with E = e^(-2|x|) - 1 below 1 in
+ * magnitude, 1 - 2 / (e^(2|x|) + 1) below 22 and ±1 from there on.
+ *
+ * @param x Double-precision floating-point number.
+ * @return Hyperbolic tangent of `x`, in [-1, 1]; NaN for NaN.
+ */
+long double mu_tanh(double x);
+
+/**
+ * @brief Computes the inverse hyperbolic sine of a double-precision
+ * floating-point number.
+ *
+ * Takes a single logarithm: log1p(|x| + x^2 / (1 + sqrt(1 + x^2))) up to 2,
+ * log(2|x| + 1 / (|x| + sqrt(x^2 + 1))) up to 2^28 and log|x| + ln2 beyond,
+ * so neither cancellation nor the overflow of x^2 shows.
+ *
+ * @param x Double-precision floating-point number.
+ * @return Inverse hyperbolic sine of `x`: ±Inf for ±Inf, NaN for NaN.
+ */
+long double mu_asinh(double x);
+
+/**
+ * @brief Computes the inverse hyperbolic cosine of a double-precision
+ * floating-point number.
+ *
+ * Uses the forms of mu_asinh(), with log1p(t + sqrt(2t + t^2)) and
+ * t = x - 1 up to 2.
+ *
+ * @param x Double-precision floating-point number, at least 1.
+ * @return Inverse hyperbolic cosine of `x`: +0 at 1, NaN below 1 and for NaN.
+ */
+long double mu_acosh(double x);
+
+/**
+ * @brief Computes the inverse hyperbolic tangent of a double-precision
+ * floating-point number.
+ *
+ * Takes a single log1p: log1p(2|x| / (1 - |x|)) / 2, with the argument
+ * rearranged below 0.5 to keep its low bits.
+ *
+ * @param x Double-precision floating-point number in [-1, 1].
+ * @return Inverse hyperbolic tangent of `x`: ±Inf at ±1, NaN beyond and for
+ * NaN.
+ */
+long double mu_atanh(double x);
+
+/**
+ * @brief Double-precision form of mu_fabs().
+ *
+ * The functions with a `_d` suffix take and return `double` and run entirely
+ * in SSE/AVX double arithmetic, so results stay in vector registers instead of
+ * passing through the x87 stack. They share the special-value behaviour of
+ * their `long double` counterparts, which widen these results and so carry
+ * no more precision than them.
+ *
+ * @param x Double-precision floating-point number.
+ * @return Absolute value of `x`, exact.
+ */
+double mu_fabs_d(double x);
+
+/**
+ * @brief Double-precision form of mu_trunc().
+ *
+ * @param x Double-precision floating-point number.
+ * @return `x` rounded toward zero, exact. The sign of zero is kept.
+ */
+double mu_trunc_d(double x);
+
+/**
+ * @brief Double-precision form of mu_ceil().
+ *
+ * @param x Double-precision floating-point number.
+ * @return Smallest integral value not less than `x`, exact.
+ */
+double mu_ceil_d(double x);
+
+/**
+ * @brief Double-precision form of mu_floor().
+ *
+ * @param x Double-precision floating-point number.
+ * @return Largest integral value not greater than `x`, exact.
+ */
+double mu_floor_d(double x);
+
+/**
+ * @brief Double-precision form of mu_round().
+ *
+ * @param x Double-precision floating-point number.
+ * @return Nearest integer to `x`, halfway cases away from zero, exact.
+ */
+double mu_round_d(double x);
+
+/**
+ * @brief Double-precision form of mu_nearbyint().
+ *
+ * @param x Double-precision floating-point number.
+ * @return `x` rounded in the current rounding direction, exact.
+ */
+double mu_nearbyint_d(double x);
+
+/**
+ * @brief Double-precision form of mu_modf().
+ *
+ * @param x Double-precision floating-point number.
+ * @param iptr Receives `x` rounded toward zero.
+ * @return Fractional part of `x`, exact.
+ */
+double mu_modf_d(double x, double *iptr);
+
+/**
+ * @brief Double-precision form of mu_fmod().
+ *
+ * The mantissas are divided as integers, 11 bits of the exponent difference
+ * at a time, so the result is exact for any quotient and operands whose
+ * exponents are close take a single integer division.
+ *
+ * @param x Dividend.
+ * @param y Divisor.
+ * @return Remainder of `x / y` with the sign of `x`, exact.
+ */
+double mu_fmod_d(double x, double y);
+
+/**
+ * @brief Double-precision form of mu_remainder().
+ *
+ * @param x Dividend.
+ * @param y Divisor.
+ * @return Remainder of `x / y` for the quotient rounded to nearest, exact.
+ */
+double mu_remainder_d(double x, double y);
+
+/**
+ * @brief Double-precision form of mu_remquo().
+ *
+ * @param x Dividend.
+ * @param y Divisor.
+ * @param quo Output for the low 31 bits of the quotient, signed.
+ * @return Remainder of `x / y` for the quotient rounded to nearest, exact.
+ */
+double mu_remquo_d(double x, double y, int *quo);
+
+/**
+ * @brief Double-precision form of mu_sin().
+ *
+ * @param x Angle in radians.
+ * @return Sine of `x`, within 0.8 ULP for every finite `x`. A zero `x` is
+ * returned as is, so sin(-0) is -0.
+ */
+double mu_sin_d(double x);
+
+/**
+ * @brief Double-precision form of mu_cos().
+ *
+ * @param x Angle in radians.
+ * @return Cosine of `x`, within 0.8 ULP for every finite `x`.
+ */
+double mu_cos_d(double x);
+
+/**
+ * @brief Double-precision form of mu_sincos().
+ *
+ * @param x Angle in radians.
+ * @param s Receives the sine of `x`, within 0.8 ULP.
+ * @param c Receives the cosine of `x`, within 0.8 ULP.
+ */
+void mu_sincos_d(double x, double *s, double *c);
+
+/**
+ * @brief Double-precision form of mu_tan().
+ *
+ * @param x Angle in radians.
+ * @return Tangent of `x`, within 1.5 ULP for every finite `x`. A zero `x` is
+ * returned as is, so tan(-0) is -0.
+ */
+double mu_tan_d(double x);
+
+/**
+ * @brief Double-precision form of mu_sinpi().
+ *
+ * @param x Angle in half-turns.
+ * @return sin(πx), within 0.8 ULP for every finite `x`.
+ */
+double mu_sinpi_d(double x);
+
+/**
+ * @brief Double-precision form of mu_cospi().
+ *
+ * @param x Angle in half-turns.
+ * @return cos(πx), within 0.8 ULP for every finite `x`.
+ */
+double mu_cospi_d(double x);
+
+/**
+ * @brief Double-precision form of mu_sincospi().
+ *
+ * @param x Angle in half-turns.
+ * @param s Receives sin(πx), as mu_sinpi_d().
+ * @param c Receives cos(πx), as mu_cospi_d().
+ */
+void mu_sincospi_d(double x, double *s, double *c);
+
+/**
+ * @brief Double-precision form of mu_tanpi().
+ *
+ * @param x Angle in half-turns.
+ * @return tan(πx), within 1.5 ULP for every finite `x`.
+ */
+double mu_tanpi_d(double x);
+
+/**
+ * @brief Double-precision form of mu_sind().
+ *
+ * @param x Angle in degrees.
+ * @return Sine of `x` degrees, within 0.8 ULP for every finite `x`.
+ */
+double mu_sind_d(double x);
+
+/**
+ * @brief Double-precision form of mu_cosd().
+ *
+ * @param x Angle in degrees.
+ * @return Cosine of `x` degrees, within 0.8 ULP for every finite `x`.
+ */
+double mu_cosd_d(double x);
+
+/**
+ * @brief Double-precision form of mu_sincosd().
+ *
+ * @param x Angle in degrees.
+ * @param s Receives the sine, as mu_sind_d().
+ * @param c Receives the cosine, as mu_cosd_d().
+ */
+void mu_sincosd_d(double x, double *s, double *c);
+
+/**
+ * @brief Double-precision form of mu_asin().
+ *
+ * @param x Value in [-1, 1].
+ * @return Arcsine of `x` in radians, within 0.9 ULP.
+ */
+double mu_asin_d(double x);
+
+/**
+ * @brief Double-precision form of mu_acos().
+ *
+ * @param x Value in [-1, 1].
+ * @return Arccosine of `x` in radians, within 0.9 ULP.
+ */
+double mu_acos_d(double x);
+
+/**
+ * @brief Double-precision form of mu_atan().
+ *
+ * @param x Double-precision floating-point number.
+ * @return Arctangent of `x` in radians, within 0.8 ULP.
+ */
+double mu_atan_d(double x);
+
+/**
+ * @brief Double-precision form of mu_atan2().
+ *
+ * @param y Ordinate.
+ * @param x Abscissa.
+ * @return Angle of the point (`x`, `y`) in radians, within 1.5 ULP.
+ */
+double mu_atan2_d(double y, double x);
+
+/**
+ * @brief Double-precision form of mu_sqrt().
+ *
+ * @param x Non-negative double-precision floating-point number.
+ * @return Square root of `x`, correctly rounded on targets with SSE2 and
+ * within 1 ULP elsewhere.
+ */
+double mu_sqrt_d(double x);
+
+/**
+ * @brief Double-precision form of mu_rsqrt().
+ *
+ * @param x Non-negative double-precision floating-point number.
+ * @return Reciprocal square root of `x`, within 0.51 ULP.
+ */
+double mu_rsqrt_d(double x);
+
+/**
+ * @brief Double-precision form of mu_pow().
+ *
+ * @param base Base value.
+ * @param exp Exponent value.
+ * @return `base` raised to the power of `exp`, within 0.52 ULP for normal
+ * results and 1 ULP for subnormal ones. An `exp` of -1 gives the correctly
+ * rounded 1 / `base`.
+ */
+double mu_pow_d(double base, double exp);
+
+/**
+ * @brief Double-precision form of mu_pow_apply().
+ *
+ * @param plan Plan created by mu_pow_plan_base() or mu_pow_plan_exp().
+ * @param x Exponent for a base plan, or base for an exponent plan.
+ * @return The same value as the corresponding mu_pow_d() call.
+ */
+double mu_pow_apply_d(const mu_pow_plan *plan, double x);
+
+/**
+ * @brief Double-precision form of mu_exp().
+ *
+ * @param x Double-precision floating-point number.
+ * @return Exponential of `x`, within 0.52 ULP for normal results and 1 ULP for
+ * subnormal ones.
+ */
+double mu_exp_d(double x);
+
+/**
+ * @brief Double-precision form of mu_exp2().
+ *
+ * @param x Double-precision floating-point number.
+ * @return 2^x, within 0.52 ULP for normal results and 1 ULP for subnormal
+ * ones; exact for integral `x`.
+ */
+double mu_exp2_d(double x);
+
+/**
+ * @brief Double-precision form of mu_exp10().
+ *
+ * @param x Double-precision floating-point number.
+ * @return 10^x, within 0.52 ULP for normal results and 1 ULP for subnormal
+ * ones.
+ */
+double mu_exp10_d(double x);
+
+/**
+ * @brief Double-precision form of mu_expm1().
+ *
+ * @param x Double-precision floating-point number.
+ * @return e^x - 1, within 0.6 ULP.
+ */
+double mu_expm1_d(double x);
+
+/**
+ * @brief Double-precision form of mu_log().
+ *
+ * @param x Positive double-precision floating-point number.
+ * @return Natural logarithm of `x`, within 0.6 ULP.
+ */
+double mu_log_d(double x);
+
+/**
+ * @brief Double-precision form of mu_log2().
+ *
+ * @param x Positive double-precision floating-point number.
+ * @return Base-2 logarithm of `x`, within 0.6 ULP.
+ */
+double mu_log2_d(double x);
+
+/**
+ * @brief Double-precision form of mu_log10().
+ *
+ * @param x Positive double-precision floating-point number.
+ * @return Base-10 logarithm of `x`, within 0.6 ULP.
+ */
+double mu_log10_d(double x);
+
+/**
+ * @brief Double-precision form of mu_log1p().
+ *
+ * @param x Double-precision floating-point number, at least -1.
+ * @return log(1 + x), within 0.6 ULP.
+ */
+double mu_log1p_d(double x);
+
+/**
+ * @brief Double-precision form of mu_ldexp().
+ *
+ * @param x Double-precision floating-point number.
+ * @param n Power of two to scale by.
+ * @return x * 2^n, correctly rounded.
+ */
+double mu_ldexp_d(double x, int n);
+
+/**
+ * @brief Double-precision form of mu_sinh().
+ *
+ * @param x Double-precision floating-point number.
+ * @return Hyperbolic sine of `x`, within 1.5 ULP.
+ */
+double mu_sinh_d(double x);
+
+/**
+ * @brief Double-precision form of mu_cosh().
+ *
+ * @param x Double-precision floating-point number.
+ * @return Hyperbolic cosine of `x`, within 1.1 ULP.
+ */
+double mu_cosh_d(double x);
+
+/**
+ * @brief Double-precision form of mu_sinhcosh().
+ *
+ * @param x Double-precision floating-point number.
+ * @param s Receives the hyperbolic sine, as mu_sinh_d().
+ * @param c Receives the hyperbolic cosine, as mu_cosh_d().
+ */
+void mu_sinhcosh_d(double x, double *s, double *c);
+
+/**
+ * @brief Double-precision form of mu_tanh().
+ *
+ * @param x Double-precision floating-point number.
+ * @return Hyperbolic tangent of `x`, within 2.5 ULP.
+ */
+double mu_tanh_d(double x);
+
+/**
+ * @brief Double-precision form of mu_asinh().
+ *
+ * @param x Double-precision floating-point number.
+ * @return Inverse hyperbolic sine of `x`, within 1.6 ULP.
+ */
+double mu_asinh_d(double x);
+
+/**
+ * @brief Double-precision form of mu_acosh().
+ *
+ * @param x Double-precision floating-point number, at least 1.
+ * @return Inverse hyperbolic cosine of `x`, within 2.5 ULP.
+ */
+double mu_acosh_d(double x);
+
+/**
+ * @brief Double-precision form of mu_atanh().
+ *
+ * @param x Double-precision floating-point number in [-1, 1].
+ * @return Inverse hyperbolic tangent of `x`, within 1.6 ULP.
+ */
+double mu_atanh_d(double x);
+
+/**
+ * @brief Single-precision form of mu_fabs().
+ *
+ * The functions with an `f` suffix take and return `float`. Their kernels
+ * evaluate in single precision with polynomials sized for a 24-bit mantissa;
+ * the trigonometric argument reduction and mu_powf() run in double. Special
+ * values behave as in the `long double` API.
+ *
+ * @param x Single-precision floating-point number.
+ * @return Absolute value of `x`, exact.
+ */
+float mu_fabsf(float x);
+
+/**
+ * @brief Single-precision form of mu_trunc().
+ *
+ * @param x Single-precision floating-point number.
+ * @return `x` rounded toward zero, exact. The sign of zero is kept.
+ */
+float mu_truncf(float x);
+
+/**
+ * @brief Single-precision form of mu_ceil().
+ *
+ * @param x Single-precision floating-point number.
+ * @return Smallest integral value not less than `x`, exact.
+ */
+float mu_ceilf(float x);
+
+/**
+ * @brief Single-precision form of mu_floor().
+ *
+ * @param x Single-precision floating-point number.
+ * @return Largest integral value not greater than `x`, exact.
+ */
+float mu_floorf(float x);
+
+/**
+ * @brief Single-precision form of mu_round().
+ *
+ * @param x Single-precision floating-point number.
+ * @return Nearest integer to `x`, halfway cases away from zero, exact.
+ */
+float mu_roundf(float x);
+
+/**
+ * @brief Single-precision form of mu_nearbyint().
+ *
+ * @param x Single-precision floating-point number.
+ * @return `x` rounded in the current rounding direction, exact.
+ */
+float mu_nearbyintf(float x);
+
+/**
+ * @brief Single-precision form of mu_modf().
+ *
+ * @param x Single-precision floating-point number.
+ * @param iptr Receives `x` rounded toward zero.
+ * @return Fractional part of `x`, exact.
+ */
+float mu_modff(float x, float *iptr);
+
+/**
+ * @brief Single-precision form of mu_lround().
+ *
+ * @param x Single-precision floating-point number.
+ * @return Nearest integer to `x`, or LONG_MIN if `x` is NaN or the result does
+ * not fit in `long int`.
+ */
+long int mu_lroundf(float x);
+
+/**
+ * @brief Single-precision form of mu_fmod().
+ *
+ * @param x Dividend.
+ * @param y Divisor.
+ * @return Remainder of `x / y` with the sign of `x`, exact.
+ */
+float mu_fmodf(float x, float y);
+
+/**
+ * @brief Single-precision form of mu_remainder().
+ *
+ * @param x Dividend.
+ * @param y Divisor.
+ * @return Remainder of `x / y` for the quotient rounded to nearest, exact.
+ */
+float mu_remainderf(float x, float y);
+
+/**
+ * @brief Single-precision form of mu_remquo().
+ *
+ * @param x Dividend.
+ * @param y Divisor.
+ * @param quo Output for the low 31 bits of the quotient, signed.
+ * @return Remainder of `x / y` for the quotient rounded to nearest, exact.
+ */
+float mu_remquof(float x, float y, int *quo);
+
+/**
+ * @brief Single-precision form of mu_sin().
+ *
+ * @param x Angle in radians.
+ * @return Sine of `x`, within 1.6 ULP for every finite `x`.
+ */
+float mu_sinf(float x);
+
+/**
+ * @brief Single-precision form of mu_cos().
+ *
+ * @param x Angle in radians.
+ * @return Cosine of `x`, within 1.6 ULP for every finite `x`.
+ */
+float mu_cosf(float x);
+
+/**
+ * @brief Single-precision form of mu_sincos().
+ *
+ * @param x Angle in radians.
+ * @param s Receives the sine of `x`, as mu_sinf().
+ * @param c Receives the cosine of `x`, as mu_cosf().
+ */
+void mu_sincosf(float x, float *s, float *c);
+
+/**
+ * @brief Single-precision form of mu_tan().
+ *
+ * @param x Angle in radians.
+ * @return Tangent of `x`, within 2.7 ULP for every finite `x`.
+ */
+float mu_tanf(float x);
+
+/**
+ * @brief Single-precision form of mu_sinpi(), computed in double and
+ * correctly rounded in practice.
+ *
+ * @param x Angle in half-turns.
+ * @return sin(πx), within 0.5 ULP for every finite `x`.
+ */
+float mu_sinpif(float x);
+
+/**
+ * @brief Single-precision form of mu_cospi().
+ *
+ * @param x Angle in half-turns.
+ * @return cos(πx), within 0.5 ULP for every finite `x`.
+ */
+float mu_cospif(float x);
+
+/**
+ * @brief Single-precision form of mu_sincospi().
+ *
+ * @param x Angle in half-turns.
+ * @param s Receives sin(πx), as mu_sinpif().
+ * @param c Receives cos(πx), as mu_cospif().
+ */
+void mu_sincospif(float x, float *s, float *c);
+
+/**
+ * @brief Single-precision form of mu_tanpi().
+ *
+ * @param x Angle in half-turns.
+ * @return tan(πx), within 0.5 ULP for every finite `x`.
+ */
+float mu_tanpif(float x);
+
+/**
+ * @brief Single-precision form of mu_sind().
+ *
+ * @param x Angle in degrees.
+ * @return Sine of `x` degrees, within 0.5 ULP for every finite `x`.
+ */
+float mu_sindf(float x);
+
+/**
+ * @brief Single-precision form of mu_cosd().
+ *
+ * @param x Angle in degrees.
+ * @return Cosine of `x` degrees, within 0.5 ULP for every finite `x`.
+ */
+float mu_cosdf(float x);
+
+/**
+ * @brief Single-precision form of mu_sincosd().
+ *
+ * @param x Angle in degrees.
+ * @param s Receives the sine, as mu_sindf().
+ * @param c Receives the cosine, as mu_cosdf().
+ */
+void mu_sincosdf(float x, float *s, float *c);
+
+/**
+ * @brief Single-precision form of mu_asin().
+ *
+ * @param x Value in [-1, 1].
+ * @return Arcsine of `x` in radians, within 1.9 ULP.
+ */
+float mu_asinf(float x);
+
+/**
+ * @brief Single-precision form of mu_acos().
+ *
+ * @param x Value in [-1, 1].
+ * @return Arccosine of `x` in radians, within 1.2 ULP.
+ */
+float mu_acosf(float x);
+
+/**
+ * @brief Single-precision form of mu_atan().
+ *
+ * @param x Single-precision floating-point number.
+ * @return Arctangent of `x` in radians, within 2.1 ULP.
+ */
+float mu_atanf(float x);
+
+/**
+ * @brief Single-precision form of mu_atan2().
+ *
+ * @param y Ordinate.
+ * @param x Abscissa.
+ * @return Angle of the point (`x`, `y`) in radians, within 2.3 ULP.
+ */
+float mu_atan2f(float y, float x);
+
+/**
+ * @brief Single-precision form of mu_sqrt().
+ *
+ * @param x Non-negative single-precision floating-point number.
+ * @return Square root of `x`, correctly rounded.
+ */
+float mu_sqrtf(float x);
+
+/**
+ * @brief Single-precision form of mu_rsqrt().
+ *
+ * @param x Non-negative single-precision floating-point number.
+ * @return Reciprocal square root of `x`, within 1.5 ULP.
+ */
+float mu_rsqrtf(float x);
+
+/**
+ * @brief Single-precision form of mu_pow().
+ *
+ * Evaluated with the double-precision kernel of mu_pow_d().
+ *
+ * @param base Base value.
+ * @param exp Exponent value.
+ * @return `base` raised to the power of `exp`, within 0.51 ULP.
+ */
+float mu_powf(float base, float exp);
+
+/**
+ * @brief Single-precision form of mu_exp().
+ *
+ * @param x Single-precision floating-point number.
+ * @return Exponential of `x`, within 1.0 ULP.
+ */
+float mu_expf(float x);
+
+/**
+ * @brief Single-precision form of mu_log().
+ *
+ * @param x Positive single-precision floating-point number.
+ * @return Natural logarithm of `x`, within 0.9 ULP.
+ */
+float mu_logf(float x);
+
+/**
+ * @brief Single-precision form of mu_exp2(), computed in double and correctly
+ * rounded in practice.
+ *
+ * @param x Single-precision floating-point number.
+ * @return 2^x, within 0.5 ULP.
+ */
+float mu_exp2f(float x);
+
+/**
+ * @brief Single-precision form of mu_exp10().
+ *
+ * @param x Single-precision floating-point number.
+ * @return 10^x, within 0.5 ULP.
+ */
+float mu_exp10f(float x);
+
+/**
+ * @brief Single-precision form of mu_expm1().
+ *
+ * @param x Single-precision floating-point number.
+ * @return e^x - 1, within 0.5 ULP.
+ */
+float mu_expm1f(float x);
+
+/**
+ * @brief Single-precision form of mu_log2().
+ *
+ * @param x Positive single-precision floating-point number.
+ * @return Base-2 logarithm of `x`, within 0.5 ULP.
+ */
+float mu_log2f(float x);
+
+/**
+ * @brief Single-precision form of mu_log10().
+ *
+ * @param x Positive single-precision floating-point number.
+ * @return Base-10 logarithm of `x`, within 0.5 ULP.
+ */
+float mu_log10f(float x);
+
+/**
+ * @brief Single-precision form of mu_log1p().
+ *
+ * @param x Single-precision floating-point number, at least -1.
+ * @return log(1 + x), within 0.5 ULP.
+ */
+float mu_log1pf(float x);
+
+/**
+ * @brief Single-precision form of mu_ilogb().
+ *
+ * @param x Single-precision floating-point number.
+ * @return floor(log2|x|), with the special values of mu_ilogb().
+ */
+int mu_ilogbf(float x);
+
+/**
+ * @brief Single-precision form of mu_ldexp().
+ *
+ * @param x Single-precision floating-point number.
+ * @param n Power of two to scale by.
+ * @return x * 2^n, correctly rounded.
+ */
+float mu_ldexpf(float x, int n);
+
+/**
+ * @brief Single-precision form of mu_sinh(), computed in double and correctly
+ * rounded in practice.
+ *
+ * @param x Single-precision floating-point number.
+ * @return Hyperbolic sine of `x`, within 0.5 ULP.
+ */
+float mu_sinhf(float x);
+
+/**
+ * @brief Single-precision form of mu_cosh().
+ *
+ * @param x Single-precision floating-point number.
+ * @return Hyperbolic cosine of `x`, within 0.5 ULP.
+ */
+float mu_coshf(float x);
+
+/**
+ * @brief Single-precision form of mu_sinhcosh().
+ *
+ * @param x Single-precision floating-point number.
+ * @param s Receives the hyperbolic sine, as mu_sinhf().
+ * @param c Receives the hyperbolic cosine, as mu_coshf().
+ */
+void mu_sinhcoshf(float x, float *s, float *c);
+
+/**
+ * @brief Single-precision form of mu_tanh().
+ *
+ * @param x Single-precision floating-point number.
+ * @return Hyperbolic tangent of `x`, within 0.5 ULP.
+ */
+float mu_tanhf(float x);
+
+/**
+ * @brief Single-precision form of mu_asinh().
+ *
+ * @param x Single-precision floating-point number.
+ * @return Inverse hyperbolic sine of `x`, within 0.5 ULP.
+ */
+float mu_asinhf(float x);
+
+/**
+ * @brief Single-precision form of mu_acosh().
+ *
+ * @param x Single-precision floating-point number, at least 1.
+ * @return Inverse hyperbolic cosine of `x`, within 0.5 ULP.
+ */
+float mu_acoshf(float x);
+
+/**
+ * @brief Single-precision form of mu_atanh().
+ *
+ * @param x Single-precision floating-point number in [-1, 1].
+ * @return Inverse hyperbolic tangent of `x`, within 0.5 ULP.
+ */
+float mu_atanhf(float x);
+
+/**
+ * @brief Fast-tier sine.
+ *
+ * The `_fast` and `_medium` functions trade digits for throughput: each tier
+ * runs a shorter fixed-degree polynomial than the `_d` function, on the same
+ * argument reduction for exp and log. The fast tier keeps the error below
+ * MU_EPS6 and the medium tier below MU_EPS10, relative to max(1, |result|)
+ * for normal results. Special values behave as in the full-accuracy `_d`
+ * functions.
+ *
+ * @param x Angle in radians.
+ * @return Sine of `x`.
+ */
+double mu_sin_fast(double x);
+
+/**
+ * @brief Medium-tier sine.
+ *
+ * @param x Angle in radians.
+ * @return Sine of `x`.
+ */
+double mu_sin_medium(double x);
+
+/**
+ * @brief Fast-tier cosine.
+ *
+ * @param x Angle in radians.
+ * @return Cosine of `x`.
+ */
+double mu_cos_fast(double x);
+
+/**
+ * @brief Medium-tier cosine.
+ *
+ * @param x Angle in radians.
+ * @return Cosine of `x`.
+ */
+double mu_cos_medium(double x);
+
+/**
+ * @brief Fast-tier exponential.
+ *
+ * @param x Double-precision floating-point number.
+ * @return Exponential of `x`.
+ */
+double mu_exp_fast(double x);
+
+/**
+ * @brief Medium-tier exponential.
+ *
+ * @param x Double-precision floating-point number.
+ * @return Exponential of `x`.
+ */
+double mu_exp_medium(double x);
+
+/**
+ * @brief Fast-tier natural logarithm.
+ *
+ * @param x Positive double-precision floating-point number.
+ * @return Natural logarithm of `x`.
+ */
+double mu_log_fast(double x);
+
+/**
+ * @brief Medium-tier natural logarithm.
+ *
+ * @param x Positive double-precision floating-point number.
+ * @return Natural logarithm of `x`.
+ */
+double mu_log_medium(double x);
+
+/**
+ * @brief Sine without special-value handling.
+ *
+ * The `_unchecked` functions run the kernels of the `_d` functions without
+ * the tests for NaN, infinite and out-of-domain inputs, for loops that
+ * already guarantee clean inputs. Inside their domain they return exactly
+ * what the `_d` functions return; outside it the result is unspecified.
+ *
+ * @param x Finite angle in radians.
+ * @return Sine of `x`.
+ */
+double mu_sin_unchecked(double x);
+
+/**
+ * @brief Cosine without special-value handling.
+ *
+ * @param x Finite angle in radians.
+ * @return Cosine of `x`.
+ */
+double mu_cos_unchecked(double x);
+
+/**
+ * @brief Sine and cosine without special-value handling.
+ *
+ * @param x Finite angle in radians.
+ * @param s Receives the sine of `x`.
+ * @param c Receives the cosine of `x`.
+ */
+void mu_sincos_unchecked(double x, double *s, double *c);
+
+/**
+ * @brief Tangent without special-value handling.
+ *
+ * @param x Finite angle in radians.
+ * @return Tangent of `x`.
+ */
+double mu_tan_unchecked(double x);
+
+/**
+ * @brief Arcsine without special-value handling.
+ *
+ * @param x Number in [-1, 1].
+ * @return Arcsine of `x`.
+ */
+double mu_asin_unchecked(double x);
+
+/**
+ * @brief Arccosine without special-value handling.
+ *
+ * @param x Number in [-1, 1].
+ * @return Arccosine of `x`.
+ */
+double mu_acos_unchecked(double x);
+
+/**
+ * @brief Square root without special-value handling.
+ *
+ * @param x Finite number, zero or positive.
+ * @return Square root of `x`.
+ */
+double mu_sqrt_unchecked(double x);
+
+/**
+ * @brief Exponential without special-value handling.
+ *
+ * @param x Number from -745.133 to 709.782, where the result neither
+ * overflows nor rounds to zero.
+ * @return Exponential of `x`.
+ */
+double mu_exp_unchecked(double x);
+
+/**
+ * @brief Natural logarithm without special-value handling.
+ *
+ * @param x Positive finite number, subnormals included.
+ * @return Natural logarithm of `x`.
+ */
+double mu_log_unchecked(double x);
+
+/**
+ * @brief Computes the absolute values of an array of integers.
+ *
+ * Batch form of mu_abs(): `out[i] = mu_abs(in[i])` for every `i < n`.
+ *
+ * @param in Input array of `n` integers.
+ * @param out Output array of `n` elements.
+ * @param n Number of elements.
+ */
+void mu_abs_n(const int *in, long int *out, size_t n);
+
+/**
+ * @brief Computes the absolute values of an array of double-precision
+ * floating-point numbers.
+ *
+ * Batch form of mu_fabs(): `out[i]` receives the result for `in[i]` for every
+ * `i < n`. The array is processed with vector kernels and special values are
+ * handled with lane masks. `out` may be the same array as `in`.
+ *
+ * @param in Input array of `n` elements.
+ * @param out Output array of `n` elements.
+ * @param n Number of elements.
+ */
+void mu_fabs_n(const double *in, double *out, size_t n);
+
+/**
+ * @brief Computes the values truncated toward zero of an array of
+ * double-precision floating-point numbers.
+ *
+ * Batch form of mu_trunc(): `out[i]` receives the result for `in[i]` for every
+ * `i < n`. The array is processed with vector kernels and special values are
+ * handled with lane masks. `out` may be the same array as `in`.
+ *
+ * @param in Input array of `n` elements.
+ * @param out Output array of `n` elements.
+ * @param n Number of elements.
+ */
+void mu_trunc_n(const double *in, double *out, size_t n);
+
+/**
+ * @brief Computes the values rounded up of an array of double-precision
+ * floating-point numbers.
+ *
+ * Batch form of mu_ceil(): `out[i]` receives the result for `in[i]` for every
+ * `i < n`. The array is processed with vector kernels and special values are
+ * handled with lane masks. `out` may be the same array as `in`.
+ *
+ * @param in Input array of `n` elements.
+ * @param out Output array of `n` elements.
+ * @param n Number of elements.
+ */
+void mu_ceil_n(const double *in, double *out, size_t n);
+
+/**
+ * @brief Computes the values rounded down of an array of double-precision
+ * floating-point numbers.
+ *
+ * Batch form of mu_floor(): `out[i]` receives the result for `in[i]` for every
+ * `i < n`. The array is processed with vector kernels and special values are
+ * handled with lane masks. `out` may be the same array as `in`.
+ *
+ * @param in Input array of `n` elements.
+ * @param out Output array of `n` elements.
+ * @param n Number of elements.
+ */
+void mu_floor_n(const double *in, double *out, size_t n);
+
+/**
+ * @brief Rounds an array of double-precision floating-point numbers to the
+ * nearest integers, with halfway cases rounded away from zero.
+ *
+ * Batch form of mu_round(). `out` may be the same array as `in`.
+ *
+ * @param in Input array of `n` elements.
+ * @param out Output array of `n` elements.
+ * @param n Number of elements.
+ */
+void mu_round_n(const double *in, double *out, size_t n);
+
+/**
+ * @brief Rounds an array of double-precision floating-point numbers to
+ * integers in the current rounding direction.
+ *
+ * Batch form of mu_nearbyint(). `out` may be the same array as `in`.
+ *
+ * @param in Input array of `n` elements.
+ * @param out Output array of `n` elements.
+ * @param n Number of elements.
+ */
+void mu_nearbyint_n(const double *in, double *out, size_t n);
+
+/**
+ * @brief Splits an array of double-precision floating-point numbers into
+ * integral and fractional parts.
+ *
+ * Batch form of mu_modf(): `frac[i]` and `ipart[i]` receive the parts of
+ * `in[i]` for every `i < n`. `in` may be the same array as `frac` or `ipart`.
+ *
+ * @param in Input array of `n` elements.
+ * @param frac Output array of `n` fractional parts.
+ * @param ipart Output array of `n` integral parts.
+ * @param n Number of elements.
+ */
+void mu_modf_n(const double *in, double *frac, double *ipart, size_t n);
+
+/**
+ * @brief Rounds an array of double-precision floating-point numbers to the
+ * nearest `long int` values.
+ *
+ * Batch form of mu_lround(): `out[i] = mu_lround(in[i])` for every `i < n`.
+ *
+ * @param in Input array of `n` elements.
+ * @param out Output array of `n` integers.
+ * @param n Number of elements.
+ */
+void mu_lround_n(const double *in, long int *out, size_t n);
+
+/**
+ * @brief Computes the remainders of dividing two arrays of double-precision
+ * floating-point numbers.
+ *
+ * Batch form of mu_fmod(): `out[i] = mu_fmod(x[i], y[i])` for every `i < n`.
+ * `out` may be the same array as `x` or `y`.
+ *
+ * @param x Input array of `n` dividends.
+ * @param y Input array of `n` divisors.
+ * @param out Output array of `n` elements.
+ * @param n Number of elements.
+ */
+void mu_fmod_n(const double *x, const double *y, double *out, size_t n);
+
+/**
+ * @brief Computes the IEEE remainders of dividing two arrays of
+ * double-precision floating-point numbers.
+ *
+ * Batch form of mu_remainder(). `out` may be the same array as `x` or `y`.
+ *
+ * @param x Input array of `n` dividends.
+ * @param y Input array of `n` divisors.
+ * @param out Output array of `n` elements.
+ * @param n Number of elements.
+ */
+void mu_remainder_n(const double *x, const double *y, double *out, size_t n);
+
+/**
+ * @brief Computes the IEEE remainders and quotient bits of dividing two
+ * arrays of double-precision floating-point numbers.
+ *
+ * Batch form of mu_remquo(). `out` may be the same array as `x` or `y`.
+ *
+ * @param x Input array of `n` dividends.
+ * @param y Input array of `n` divisors.
+ * @param out Output array of `n` remainders.
+ * @param quo Output array of `n` quotients, as for mu_remquo().
+ * @param n Number of elements.
+ */
+void mu_remquo_n(const double *x, const double *y, double *out, int *quo,
+                 size_t n);
+
+/**
+ * @brief Computes the sines of angles in radians of an array of
+ * double-precision floating-point numbers.
+ *
+ * Batch form of mu_sin(): `out[i]` receives the result for `in[i]` for every
+ * `i < n`. The array is processed with vector kernels and special values are
+ * handled with lane masks. `out` may be the same array as `in`.
+ *
+ * @param in Input array of `n` elements.
+ * @param out Output array of `n` elements.
+ * @param n Number of elements.
+ */
+void mu_sin_n(const double *in, double *out, size_t n);
+
+/**
+ * @brief Computes the cosines of angles in radians of an array of
+ * double-precision floating-point numbers.
+ *
+ * Batch form of mu_cos(): `out[i]` receives the result for `in[i]` for every
+ * `i < n`. The array is processed with vector kernels and special values are
+ * handled with lane masks. `out` may be the same array as `in`.
+ *
+ * @param in Input array of `n` elements.
+ * @param out Output array of `n` elements.
+ * @param n Number of elements.
+ */
+void mu_cos_n(const double *in, double *out, size_t n);
+
+/**
+ * @brief Computes the tangents of angles in radians of an array of
+ * double-precision floating-point numbers.
+ *
+ * Batch form of mu_tan(): `out[i]` receives the result for `in[i]` for every
+ * `i < n`. The array is processed with vector kernels and special values are
+ * handled with lane masks. `out` may be the same array as `in`.
+ *
+ * @param in Input array of `n` elements.
+ * @param out Output array of `n` elements.
+ * @param n Number of elements.
+ */
+void mu_tan_n(const double *in, double *out, size_t n);
+
+/**
+ * @brief Computes the sines and the cosines of an array of angles in radians.
+ *
+ * Batch form of mu_sincos(): `s[i]` and `c[i]` receive the sine and the
+ * cosine of `in[i]` for every `i < n`. `in` may be the same array as `s` or
+ * `c`.
+ *
+ * @param in Input array of `n` angles.
+ * @param s Output array of `n` sines.
+ * @param c Output array of `n` cosines.
+ * @param n Number of elements.
+ */
+void mu_sincos_n(const double *in, double *s, double *c, size_t n);
+
+/**
+ * @brief Computes sin(πx) for an array of double-precision floating-point
+ * numbers.
+ *
+ * Batch form of mu_sinpi(): `out[i]` receives the result for `in[i]` for
+ * every `i < n`. The exact reduction has no slow path, so every vector costs
+ * the same. `out` may be the same array as `in`.
+ *
+ * @param in Input array of `n` angles in half-turns.
+ * @param out Output array of `n` elements.
+ * @param n Number of elements.
+ */
+void mu_sinpi_n(const double *in, double *out, size_t n);
+
+/**
+ * @brief Computes cos(πx) for an array of double-precision floating-point
+ * numbers.
+ *
+ * Batch form of mu_cospi(). `out` may be the same array as `in`.
+ *
+ * @param in Input array of `n` angles in half-turns.
+ * @param out Output array of `n` elements.
+ * @param n Number of elements.
+ */
+void mu_cospi_n(const double *in, double *out, size_t n);
+
+/**
+ * @brief Computes sin(πx) and cos(πx) for an array of double-precision
+ * floating-point numbers.
+ *
+ * Batch form of mu_sincospi(). `in` may be the same array as `s` or `c`.
+ *
+ * @param in Input array of `n` angles in half-turns.
+ * @param s Output array of `n` sines.
+ * @param c Output array of `n` cosines.
+ * @param n Number of elements.
+ */
+void mu_sincospi_n(const double *in, double *s, double *c, size_t n);
+
+/**
+ * @brief Computes tan(πx) for an array of double-precision floating-point
+ * numbers.
+ *
+ * Batch form of mu_tanpi(). `out` may be the same array as `in`.
+ *
+ * @param in Input array of `n` angles in half-turns.
+ * @param out Output array of `n` elements.
+ * @param n Number of elements.
+ */
+void mu_tanpi_n(const double *in, double *out, size_t n);
+
+/**
+ * @brief Computes the sines of an array of angles in degrees.
+ *
+ * Batch form of mu_sind(). Angles of 2^46 degrees and more are reduced one
+ * lane at a time. `out` may be the same array as `in`.
+ *
+ * @param in Input array of `n` angles in degrees.
+ * @param out Output array of `n` elements.
+ * @param n Number of elements.
+ */
+void mu_sind_n(const double *in, double *out, size_t n);
+
+/**
+ * @brief Computes the cosines of an array of angles in degrees.
+ *
+ * Batch form of mu_cosd(). `out` may be the same array as `in`.
+ *
+ * @param in Input array of `n` angles in degrees.
+ * @param out Output array of `n` elements.
+ * @param n Number of elements.
+ */
+void mu_cosd_n(const double *in, double *out, size_t n);
+
+/**
+ * @brief Computes the sines and the cosines of an array of angles in degrees.
+ *
+ * Batch form of mu_sincosd(). `in` may be the same array as `s` or `c`.
+ *
+ * @param in Input array of `n` angles in degrees.
+ * @param s Output array of `n` sines.
+ * @param c Output array of `n` cosines.
+ * @param n Number of elements.
+ */
+void mu_sincosd_n(const double *in, double *s, double *c, size_t n);
+
+/**
+ * @brief Computes the arcsines of an array of double-precision
+ * floating-point numbers.
+ *
+ * Batch form of mu_asin(): `out[i]` receives the result for `in[i]` for every
+ * `i < n`. The array is processed with vector kernels and special values are
+ * handled with lane masks. `out` may be the same array as `in`.
+ *
+ * @param in Input array of `n` elements.
+ * @param out Output array of `n` elements.
+ * @param n Number of elements.
+ */
+void mu_asin_n(const double *in, double *out, size_t n);
+
+/**
+ * @brief Computes the arccosines of an array of double-precision
+ * floating-point numbers.
+ *
+ * Batch form of mu_acos(): `out[i]` receives the result for `in[i]` for every
+ * `i < n`. The array is processed with vector kernels and special values are
+ * handled with lane masks. `out` may be the same array as `in`.
+ *
+ * @param in Input array of `n` elements.
+ * @param out Output array of `n` elements.
+ * @param n Number of elements.
+ */
+void mu_acos_n(const double *in, double *out, size_t n);
+
+/**
+ * @brief Computes the arctangents of an array of double-precision
+ * floating-point numbers.
+ *
+ * Batch form of mu_atan(): `out[i]` receives the result for `in[i]` for every
+ * `i < n`. The array is processed with vector kernels and special values are
+ * handled with lane masks. `out` may be the same array as `in`.
+ *
+ * @param in Input array of `n` elements.
+ * @param out Output array of `n` elements.
+ * @param n Number of elements.
+ */
+void mu_atan_n(const double *in, double *out, size_t n);
+
+/**
+ * @brief Computes the quadrant-aware arctangents of two arrays of
+ * double-precision floating-point numbers.
+ *
+ * Batch form of mu_atan2(): `out[i] = mu_atan2(y[i], x[i])` for every
+ * `i < n`. `out` may be the same array as `y` or `x`.
+ *
+ * @param y Input array of `n` ordinates.
+ * @param x Input array of `n` abscissas.
+ * @param out Output array of `n` elements.
+ * @param n Number of elements.
+ */
+void mu_atan2_n(const double *y, const double *x, double *out, size_t n);
+
+/**
+ * @brief Computes the square roots of an array of double-precision
+ * floating-point numbers.
+ *
+ * Batch form of mu_sqrt(): `out[i]` receives the result for `in[i]` for every
+ * `i < n`. The array is processed with vector kernels and special values are
+ * handled with lane masks. `out` may be the same array as `in`.
+ *
+ * @param in Input array of `n` elements.
+ * @param out Output array of `n` elements.
+ * @param n Number of elements.
+ */
+void mu_sqrt_n(const double *in, double *out, size_t n);
+
+/**
+ * @brief Computes the reciprocal square roots of an array of double-precision
+ * floating-point numbers.
+ *
+ * Batch form of mu_rsqrt(): `out[i]` receives the result for `in[i]` for every
+ * `i < n`. The array is processed with vector kernels and special values are
+ * handled with lane masks. `out` may be the same array as `in`.
+ *
+ * @param in Input array of `n` elements.
+ * @param out Output array of `n` elements.
+ * @param n Number of elements.
+ */
+void mu_rsqrt_n(const double *in, double *out, size_t n);
+
+/**
+ * @brief Computes the powers of two arrays of double-precision floating-point
+ * numbers.
+ *
+ * Batch form of mu_pow(): `out[i] = mu_pow(base[i], exp[i])` for every
+ * `i < n`. `out` may be the same array as `base` or `exp`.
+ *
+ * @param base Input array of `n` base values.
+ * @param exp Input array of `n` exponent values.
+ * @param out Output array of `n` elements.
+ * @param n Number of elements.
+ */
+void mu_pow_n(const double *base, const double *exp, double *out, size_t n);
+
+/**
+ * @brief Evaluates a prepared power over an array of double-precision
+ * floating-point numbers.
+ *
+ * Batch form of mu_pow_apply(): `out[i] = mu_pow_apply(plan, in[i])` for every
+ * `i < n`. A base plan computes scalar^vector and an exponent plan computes
+ * vector^scalar. `out` may be the same array as `in`.
+ *
+ * @param plan Plan created by mu_pow_plan_base() or mu_pow_plan_exp().
+ * @param in Input array of `n` exponents (base plan) or bases (exponent plan).
+ * @param out Output array of `n` elements.
+ * @param n Number of elements.
+ */
+void mu_pow_apply_n(const mu_pow_plan *plan, const double *in, double *out,
+                    size_t n);
+
+/**
+ * @brief Computes the exponentials of an array of double-precision
+ * floating-point numbers.
+ *
+ * Batch form of mu_exp(): `out[i]` receives the result for `in[i]` for every
+ * `i < n`. The array is processed with vector kernels and special values are
+ * handled with lane masks. `out` may be the same array as `in`.
+ *
+ * @param in Input array of `n` elements.
+ * @param out Output array of `n` elements.
+ * @param n Number of elements.
+ */
+void mu_exp_n(const double *in, double *out, size_t n);
+
+/**
+ * @brief Computes 2 raised to each element of an array of double-precision
+ * floating-point numbers.
+ *
+ * Batch form of mu_exp2(): `out[i]` receives the result for `in[i]` for every
+ * `i < n`. Integral elements give exact powers of two. `out` may be the same
+ * array as `in`.
+ *
+ * @param in Input array of `n` elements.
+ * @param out Output array of `n` elements.
+ * @param n Number of elements.
+ */
+void mu_exp2_n(const double *in, double *out, size_t n);
+
+/**
+ * @brief Computes 10 raised to each element of an array of double-precision
+ * floating-point numbers.
+ *
+ * Batch form of mu_exp10(): `out[i]` receives the result for `in[i]` for every
+ * `i < n`. `out` may be the same array as `in`.
+ *
+ * @param in Input array of `n` elements.
+ * @param out Output array of `n` elements.
+ * @param n Number of elements.
+ */
+void mu_exp10_n(const double *in, double *out, size_t n);
+
+/**
+ * @brief Computes e^x - 1 for each element of an array of double-precision
+ * floating-point numbers.
+ *
+ * Batch form of mu_expm1(): `out[i]` receives the result for `in[i]` for every
+ * `i < n`. `out` may be the same array as `in`.
+ *
+ * @param in Input array of `n` elements.
+ * @param out Output array of `n` elements.
+ * @param n Number of elements.
+ */
+void mu_expm1_n(const double *in, double *out, size_t n);
+
+/**
+ * @brief Computes the natural logarithms of an array of double-precision
+ * floating-point numbers.
+ *
+ * Batch form of mu_log(): `out[i]` receives the result for `in[i]` for every
+ * `i < n`. The array is processed with vector kernels and special values are
+ * handled with lane masks. `out` may be the same array as `in`.
+ *
+ * @param in Input array of `n` elements.
+ * @param out Output array of `n` elements.
+ * @param n Number of elements.
+ */
+void mu_log_n(const double *in, double *out, size_t n);
+
+/**
+ * @brief Computes the base-2 logarithms of an array of double-precision
+ * floating-point numbers.
+ *
+ * Batch form of mu_log2(): `out[i]` receives the result for `in[i]` for every
+ * `i < n`. `out` may be the same array as `in`.
+ *
+ * @param in Input array of `n` elements.
+ * @param out Output array of `n` elements.
+ * @param n Number of elements.
+ */
+void mu_log2_n(const double *in, double *out, size_t n);
+
+/**
+ * @brief Computes the base-10 logarithms of an array of double-precision
+ * floating-point numbers.
+ *
+ * Batch form of mu_log10(): `out[i]` receives the result for `in[i]` for every
+ * `i < n`. `out` may be the same array as `in`.
+ *
+ * @param in Input array of `n` elements.
+ * @param out Output array of `n` elements.
+ * @param n Number of elements.
+ */
+void mu_log10_n(const double *in, double *out, size_t n);
+
+/**
+ * @brief Computes log(1 + x) for each element of an array of double-precision
+ * floating-point numbers.
+ *
+ * Batch form of mu_log1p(): `out[i]` receives the result for `in[i]` for every
+ * `i < n`. `out` may be the same array as `in`.
+ *
+ * @param in Input array of `n` elements.
+ * @param out Output array of `n` elements.
+ * @param n Number of elements.
+ */
+void mu_log1p_n(const double *in, double *out, size_t n);
+
+/**
+ * @brief Extracts the binary exponents of an array of double-precision
+ * floating-point numbers.
+ *
+ * Batch form of mu_ilogb(): `out[i] = mu_ilogb(in[i])` for every `i < n`.
+ *
+ * @param in Input array of `n` elements.
+ * @param out Output array of `n` integers.
+ * @param n Number of elements.
+ */
+void mu_ilogb_n(const double *in, int *out, size_t n);
+
+/**
+ * @brief Multiplies an array of double-precision floating-point numbers by
+ * powers of two.
+ *
+ * Batch form of mu_ldexp(): `out[i] = mu_ldexp(x[i], e[i])` for every
+ * `i < n`. `out` may be the same array as `x`.
+ *
+ * @param x Input array of `n` elements.
+ * @param e Input array of `n` powers of two.
+ * @param out Output array of `n` elements.
+ * @param n Number of elements.
+ */
+void mu_ldexp_n(const double *x, const int *e, double *out, size_t n);
+
+/**
+ * @brief Computes the hyperbolic sines of an array of double-precision
+ * floating-point numbers.
+ *
+ * Batch form of mu_sinh(). Every lane takes the same single exponential,
+ * whichever of the three forms of mu_sinh() it selects. `out` may be the same
+ * array as `in`.
+ *
+ * @param in Input array of `n` elements.
+ * @param out Output array of `n` elements.
+ * @param n Number of elements.
+ */
+void mu_sinh_n(const double *in, double *out, size_t n);
+
+/**
+ * @brief Computes the hyperbolic cosines of an array of double-precision
+ * floating-point numbers.
+ *
+ * Batch form of mu_cosh(). `out` may be the same array as `in`.
+ *
+ * @param in Input array of `n` elements.
+ * @param out Output array of `n` elements.
+ * @param n Number of elements.
+ */
+void mu_cosh_n(const double *in, double *out, size_t n);
+
+/**
+ * @brief Computes the hyperbolic sines and cosines of an array of
+ * double-precision floating-point numbers.
+ *
+ * Batch form of mu_sinhcosh(). `in` may be the same array as `s` or `c`.
+ *
+ * @param in Input array of `n` elements.
+ * @param s Output array of `n` hyperbolic sines.
+ * @param c Output array of `n` hyperbolic cosines.
+ * @param n Number of elements.
+ */
+void mu_sinhcosh_n(const double *in, double *s, double *c, size_t n);
+
+/**
+ * @brief Computes the hyperbolic tangents of an array of double-precision
+ * floating-point numbers.
+ *
+ * Batch form of mu_tanh(). `out` may be the same array as `in`.
+ *
+ * @param in Input array of `n` elements.
+ * @param out Output array of `n` elements.
+ * @param n Number of elements.
+ */
+void mu_tanh_n(const double *in, double *out, size_t n);
+
+/**
+ * @brief Computes the inverse hyperbolic sines of an array of
+ * double-precision floating-point numbers.
+ *
+ * Batch form of mu_asinh(). `out` may be the same array as `in`.
+ *
+ * @param in Input array of `n` elements.
+ * @param out Output array of `n` elements.
+ * @param n Number of elements.
+ */
+void mu_asinh_n(const double *in, double *out, size_t n);
+
+/**
+ * @brief Computes the inverse hyperbolic cosines of an array of
+ * double-precision floating-point numbers.
+ *
+ * Batch form of mu_acosh(). `out` may be the same array as `in`.
+ *
+ * @param in Input array of `n` elements.
+ * @param out Output array of `n` elements.
+ * @param n Number of elements.
+ */
+void mu_acosh_n(const double *in, double *out, size_t n);
+
+/**
+ * @brief Computes the inverse hyperbolic tangents of an array of
+ * double-precision floating-point numbers.
+ *
+ * Batch form of mu_atanh(). `out` may be the same array as `in`.
+ *
+ * @param in Input array of `n` elements.
+ * @param out Output array of `n` elements.
+ * @param n Number of elements.
+ */
+void mu_atanh_n(const double *in, double *out, size_t n);
+
+/**
+ * @brief Computes the sines and the cosines of an arithmetic progression of
+ * angles in radians.
+ *
+ * `s[k]` and `c[k]` receive the sine and the cosine of `x0 + k * dx` for every
+ * `k < n`, without an array of angles. The progression runs in blocks of a
+ * few hundred elements split into rows of vector lanes: the first row of a
+ * block comes from the accurate kernel and every later row from one angle
+ * addition to it, a few multiply-adds per element. The angles are taken
+ * exactly rather than rounded to doubles, so every value is within 6e-16 of
+ * the exact sine or cosine however large `k` grows, where mu_sincos_n() on
+ * the rounded angles is off by up to |x0 + k * dx| * 2^-53. Blocks that reach
+ * non-finite angles are evaluated directly.
+ *
+ * @param x0 First angle.
+ * @param dx Difference between consecutive angles.
+ * @param s Output array of `n` sines.
+ * @param c Output array of `n` cosines.
+ * @param n Number of elements.
+ */
+void mu_sincos_progression(double x0, double dx, double *s, double *c,
+                           size_t n);
+
+/**
+ * @brief Computes the exponentials of an arithmetic progression.
+ *
+ * `out[k]` receives the exponential of `x0 + k * dx` for every `k < n`. Like
+ * mu_sincos_progression(), the first row of each block comes from the
+ * accurate kernel and every later row from one product with a table of
+ * exponentials of the steps. Every value is within 2 ULP of the exponential
+ * of the exact `x0 + k * dx`. Blocks whose results leave the normal range, and
+ * progressions with very large steps, are evaluated directly.
+ *
+ * @param x0 First exponent.
+ * @param dx Difference between consecutive exponents.
+ * @param out Output array of `n` elements.
+ * @param n Number of elements.
+ */
+void mu_exp_progression(double x0, double dx, double *out, size_t n);
+
+/**
+ * @brief Computes the absolute values of an array of single-precision
+ * floating-point numbers.
+ *
+ * Batch form of mu_fabsf(). Like every `f_n` function, it runs on vector
+ * kernels with twice as many lanes as the double ones: 16 with AVX-512, 8 with
+ * AVX2 and 4 with SSE2. `out` may be the same array as `in`.
+ *
+ * @param in Input array of `n` elements.
+ * @param out Output array of `n` elements.
+ * @param n Number of elements.
+ */
+void mu_fabsf_n(const float *in, float *out, size_t n);
+
+/**
+ * @brief Computes the values truncated toward zero of an array of
+ * single-precision floating-point numbers.
+ *
+ * Batch form of mu_truncf(). `out` may be the same array as `in`.
+ *
+ * @param in Input array of `n` elements.
+ * @param out Output array of `n` elements.
+ * @param n Number of elements.
+ */
+void mu_truncf_n(const float *in, float *out, size_t n);
+
+/**
+ * @brief Computes the values rounded up of an array of single-precision
+ * floating-point numbers.
+ *
+ * Batch form of mu_ceilf(). `out` may be the same array as `in`.
+ *
+ * @param in Input array of `n` elements.
+ * @param out Output array of `n` elements.
+ * @param n Number of elements.
+ */
+void mu_ceilf_n(const float *in, float *out, size_t n);
+
+/**
+ * @brief Computes the values rounded down of an array of single-precision
+ * floating-point numbers.
+ *
+ * Batch form of mu_floorf(). `out` may be the same array as `in`.
+ *
+ * @param in Input array of `n` elements.
+ * @param out Output array of `n` elements.
+ * @param n Number of elements.
+ */
+void mu_floorf_n(const float *in, float *out, size_t n);
+
+/**
+ * @brief Rounds an array of single-precision floating-point numbers to the
+ * nearest integers, with halfway cases rounded away from zero.
+ *
+ * Batch form of mu_roundf(). `out` may be the same array as `in`.
+ *
+ * @param in Input array of `n` elements.
+ * @param out Output array of `n` elements.
+ * @param n Number of elements.
+ */
+void mu_roundf_n(const float *in, float *out, size_t n);
+
+/**
+ * @brief Rounds an array of single-precision floating-point numbers to
+ * integers in the current rounding direction.
+ *
+ * Batch form of mu_nearbyintf(). `out` may be the same array as `in`.
+ *
+ * @param in Input array of `n` elements.
+ * @param out Output array of `n` elements.
+ * @param n Number of elements.
+ */
+void mu_nearbyintf_n(const float *in, float *out, size_t n);
+
+/**
+ * @brief Splits an array of single-precision floating-point numbers into
+ * integral and fractional parts.
+ *
+ * Batch form of mu_modff(). `in` may be the same array as `frac` or `ipart`.
+ *
+ * @param in Input array of `n` elements.
+ * @param frac Output array of `n` fractional parts.
+ * @param ipart Output array of `n` integral parts.
+ * @param n Number of elements.
+ */
+void mu_modff_n(const float *in, float *frac, float *ipart, size_t n);
+
+/**
+ * @brief Computes the remainders of dividing two arrays of single-precision
+ * floating-point numbers.
+ *
+ * Batch form of mu_fmodf(). `out` may be the same array as `x` or `y`.
+ *
+ * @param x Input array of `n` dividends.
+ * @param y Input array of `n` divisors.
+ * @param out Output array of `n` elements.
+ * @param n Number of elements.
+ */
+void mu_fmodf_n(const float *x, const float *y, float *out, size_t n);
+
+/**
+ * @brief Computes the IEEE remainders of dividing two arrays of
+ * single-precision floating-point numbers.
+ *
+ * Batch form of mu_remainderf(). `out` may be the same array as `x` or `y`.
+ *
+ * @param x Input array of `n` dividends.
+ * @param y Input array of `n` divisors.
+ * @param out Output array of `n` elements.
+ * @param n Number of elements.
+ */
+void mu_remainderf_n(const float *x, const float *y, float *out, size_t n);
+
+/**
+ * @brief Computes the sines of an array of single-precision
+ * floating-point numbers.
+ *
+ * Batch form of mu_sinf(). `out` may be the same array as `in`.
+ *
+ * @param in Input array of `n` elements.
+ * @param out Output array of `n` elements.
+ * @param n Number of elements.
+ */
+void mu_sinf_n(const float *in, float *out, size_t n);
+
+/**
+ * @brief Computes the cosines of an array of single-precision
+ * floating-point numbers.
+ *
+ * Batch form of mu_cosf(). `out` may be the same array as `in`.
+ *
+ * @param in Input array of `n` elements.
+ * @param out Output array of `n` elements.
+ * @param n Number of elements.
+ */
+void mu_cosf_n(const float *in, float *out, size_t n);
+
+/**
+ * @brief Computes the tangents of an array of single-precision
+ * floating-point numbers.
+ *
+ * Batch form of mu_tanf(). `out` may be the same array as `in`.
+ *
+ * @param in Input array of `n` elements.
+ * @param out Output array of `n` elements.
+ * @param n Number of elements.
+ */
+void mu_tanf_n(const float *in, float *out, size_t n);
+
+/**
+ * @brief Computes the sines and the cosines of an array of single-precision
+ * angles in radians.
+ *
+ * Batch form of mu_sincosf(). `in` may be the same array as `s` or `c`.
+ *
+ * @param in Input array of `n` angles.
+ * @param s Output array of `n` sines.
+ * @param c Output array of `n` cosines.
+ * @param n Number of elements.
+ */
+void mu_sincosf_n(const float *in, float *s, float *c, size_t n);
+
+/**
+ * @brief Computes sin(πx) for an array of single-precision floating-point
+ * numbers.
+ *
+ * Batch form of mu_sinpif(). `out` may be the same array as `in`.
+ *
+ * @param in Input array of `n` angles in half-turns.
+ * @param out Output array of `n` elements.
+ * @param n Number of elements.
+ */
+void mu_sinpif_n(const float *in, float *out, size_t n);
+
+/**
+ * @brief Computes cos(πx) for an array of single-precision floating-point
+ * numbers.
+ *
+ * Batch form of mu_cospif(). `out` may be the same array as `in`.
+ *
+ * @param in Input array of `n` angles in half-turns.
+ * @param out Output array of `n` elements.
+ * @param n Number of elements.
+ */
+void mu_cospif_n(const float *in, float *out, size_t n);
+
+/**
+ * @brief Computes sin(πx) and cos(πx) for an array of single-precision
+ * floating-point numbers.
+ *
+ * Batch form of mu_sincospif(). `in` may be the same array as `s` or `c`.
+ *
+ * @param in Input array of `n` angles in half-turns.
+ * @param s Output array of `n` sines.
+ * @param c Output array of `n` cosines.
+ * @param n Number of elements.
+ */
+void mu_sincospif_n(const float *in, float *s, float *c, size_t n);
+
+/**
+ * @brief Computes tan(πx) for an array of single-precision floating-point
+ * numbers.
+ *
+ * Batch form of mu_tanpif(). `out` may be the same array as `in`.
+ *
+ * @param in Input array of `n` angles in half-turns.
+ * @param out Output array of `n` elements.
+ * @param n Number of elements.
+ */
+void mu_tanpif_n(const float *in, float *out, size_t n);
+
+/**
+ * @brief Computes the sines of an array of single-precision angles in
+ * degrees.
+ *
+ * Batch form of mu_sindf(). `out` may be the same array as `in`.
+ *
+ * @param in Input array of `n` angles in degrees.
+ * @param out Output array of `n` elements.
+ * @param n Number of elements.
+ */
+void mu_sindf_n(const float *in, float *out, size_t n);
+
+/**
+ * @brief Computes the cosines of an array of single-precision angles in
+ * degrees.
+ *
+ * Batch form of mu_cosdf(). `out` may be the same array as `in`.
+ *
+ * @param in Input array of `n` angles in degrees.
+ * @param out Output array of `n` elements.
+ * @param n Number of elements.
+ */
+void mu_cosdf_n(const float *in, float *out, size_t n);
+
+/**
+ * @brief Computes the sines and the cosines of an array of single-precision
+ * angles in degrees.
+ *
+ * Batch form of mu_sincosdf(). `in` may be the same array as `s` or `c`.
+ *
+ * @param in Input array of `n` angles in degrees.
+ * @param s Output array of `n` sines.
+ * @param c Output array of `n` cosines.
+ * @param n Number of elements.
+ */
+void mu_sincosdf_n(const float *in, float *s, float *c, size_t n);
+
+/**
+ * @brief Computes the arcsines of an array of single-precision
+ * floating-point numbers.
+ *
+ * Batch form of mu_asinf(). `out` may be the same array as `in`.
+ *
+ * @param in Input array of `n` elements.
+ * @param out Output array of `n` elements.
+ * @param n Number of elements.
+ */
+void mu_asinf_n(const float *in, float *out, size_t n);
+
+/**
+ * @brief Computes the arccosines of an array of single-precision
+ * floating-point numbers.
+ *
+ * Batch form of mu_acosf(). `out` may be the same array as `in`.
+ *
+ * @param in Input array of `n` elements.
+ * @param out Output array of `n` elements.
+ * @param n Number of elements.
+ */
+void mu_acosf_n(const float *in, float *out, size_t n);
+
+/**
+ * @brief Computes the arctangents of an array of single-precision
+ * floating-point numbers.
+ *
+ * Batch form of mu_atanf(). `out` may be the same array as `in`.
+ *
+ * @param in Input array of `n` elements.
+ * @param out Output array of `n` elements.
+ * @param n Number of elements.
+ */
+void mu_atanf_n(const float *in, float *out, size_t n);
+
+/**
+ * @brief Computes the quadrant-aware arctangents of two arrays of
+ * single-precision floating-point numbers.
+ *
+ * Batch form of mu_atan2f(). `out` may be the same array as `y` or `x`.
+ *
+ * @param y Input array of `n` ordinates.
+ * @param x Input array of `n` abscissas.
+ * @param out Output array of `n` elements.
+ * @param n Number of elements.
+ */
+void mu_atan2f_n(const float *y, const float *x, float *out, size_t n);
+
+/**
+ * @brief Computes the square roots of an array of single-precision
+ * floating-point numbers.
+ *
+ * Batch form of mu_sqrtf(). `out` may be the same array as `in`.
+ *
+ * @param in Input array of `n` elements.
+ * @param out Output array of `n` elements.
+ * @param n Number of elements.
+ */
+void mu_sqrtf_n(const float *in, float *out, size_t n);
+
+/**
+ * @brief Computes the reciprocal square roots of an array of single-precision
+ * floating-point numbers.
+ *
+ * Batch form of mu_rsqrtf(). `out` may be the same array as `in`.
+ *
+ * @param in Input array of `n` elements.
+ * @param out Output array of `n` elements.
+ * @param n Number of elements.
+ */
+void mu_rsqrtf_n(const float *in, float *out, size_t n);
+
+/**
+ * @brief Computes the powers of two arrays of single-precision floating-point
+ * numbers.
+ *
+ * Batch form of mu_powf(). `out` may be the same array as `base` or `exp`.
+ *
+ * @param base Input array of `n` base values.
+ * @param exp Input array of `n` exponent values.
+ * @param out Output array of `n` elements.
+ * @param n Number of elements.
+ */
+void mu_powf_n(const float *base, const float *exp, float *out, size_t n);
+
+/**
+ * @brief Computes the exponentials of an array of single-precision
+ * floating-point numbers.
+ *
+ * Batch form of mu_expf(). `out` may be the same array as `in`.
+ *
+ * @param in Input array of `n` elements.
+ * @param out Output array of `n` elements.
+ * @param n Number of elements.
+ */
+void mu_expf_n(const float *in, float *out, size_t n);
+
+/**
+ * @brief Computes 2 raised to each element of an array of single-precision
+ * floating-point numbers.
+ *
+ * Batch form of mu_exp2f(). `out` may be the same array as `in`.
+ *
+ * @param in Input array of `n` elements.
+ * @param out Output array of `n` elements.
+ * @param n Number of elements.
+ */
+void mu_exp2f_n(const float *in, float *out, size_t n);
+
+/**
+ * @brief Computes 10 raised to each element of an array of single-precision
+ * floating-point numbers.
+ *
+ * Batch form of mu_exp10f(). `out` may be the same array as `in`.
+ *
+ * @param in Input array of `n` elements.
+ * @param out Output array of `n` elements.
+ * @param n Number of elements.
+ */
+void mu_exp10f_n(const float *in, float *out, size_t n);
+
+/**
+ * @brief Computes e^x - 1 for each element of an array of single-precision
+ * floating-point numbers.
+ *
+ * Batch form of mu_expm1f(). `out` may be the same array as `in`.
+ *
+ * @param in Input array of `n` elements.
+ * @param out Output array of `n` elements.
+ * @param n Number of elements.
+ */
+void mu_expm1f_n(const float *in, float *out, size_t n);
+
+/**
+ * @brief Computes the natural logarithms of an array of single-precision
+ * floating-point numbers.
+ *
+ * Batch form of mu_logf(). `out` may be the same array as `in`.
+ *
+ * @param in Input array of `n` elements.
+ * @param out Output array of `n` elements.
+ * @param n Number of elements.
+ */
+void mu_logf_n(const float *in, float *out, size_t n);
+
+/**
+ * @brief Computes the base-2 logarithms of an array of single-precision
+ * floating-point numbers.
+ *
+ * Batch form of mu_log2f(). `out` may be the same array as `in`.
+ *
+ * @param in Input array of `n` elements.
+ * @param out Output array of `n` elements.
+ * @param n Number of elements.
+ */
+void mu_log2f_n(const float *in, float *out, size_t n);
+
+/**
+ * @brief Computes the base-10 logarithms of an array of single-precision
+ * floating-point numbers.
+ *
+ * Batch form of mu_log10f(). `out` may be the same array as `in`.
+ *
+ * @param in Input array of `n` elements.
+ * @param out Output array of `n` elements.
+ * @param n Number of elements.
+ */
+void mu_log10f_n(const float *in, float *out, size_t n);
+
+/**
+ * @brief Computes log(1 + x) for each element of an array of single-precision
+ * floating-point numbers.
+ *
+ * Batch form of mu_log1pf(). `out` may be the same array as `in`.
+ *
+ * @param in Input array of `n` elements.
+ * @param out Output array of `n` elements.
+ * @param n Number of elements.
+ */
+void mu_log1pf_n(const float *in, float *out, size_t n);
+
+/**
+ * @brief Computes the hyperbolic sines of an array of single-precision
+ * floating-point numbers.
+ *
+ * Batch form of mu_sinhf(). `out` may be the same array as `in`.
+ *
+ * @param in Input array of `n` elements.
+ * @param out Output array of `n` elements.
+ * @param n Number of elements.
+ */
+void mu_sinhf_n(const float *in, float *out, size_t n);
+
+/**
+ * @brief Computes the hyperbolic cosines of an array of single-precision
+ * floating-point numbers.
+ *
+ * Batch form of mu_coshf(). `out` may be the same array as `in`.
+ *
+ * @param in Input array of `n` elements.
+ * @param out Output array of `n` elements.
+ * @param n Number of elements.
+ */
+void mu_coshf_n(const float *in, float *out, size_t n);
+
+/**
+ * @brief Computes the hyperbolic sines and cosines of an array of
+ * single-precision floating-point numbers.
+ *
+ * Batch form of mu_sinhcoshf(). `in` may be the same array as `s` or `c`.
+ *
+ * @param in Input array of `n` elements.
+ * @param s Output array of `n` hyperbolic sines.
+ * @param c Output array of `n` hyperbolic cosines.
+ * @param n Number of elements.
+ */
+void mu_sinhcoshf_n(const float *in, float *s, float *c, size_t n);
+
+/**
+ * @brief Computes the hyperbolic tangents of an array of single-precision
+ * floating-point numbers.
+ *
+ * Batch form of mu_tanhf(). `out` may be the same array as `in`.
+ *
+ * @param in Input array of `n` elements.
+ * @param out Output array of `n` elements.
+ * @param n Number of elements.
+ */
+void mu_tanhf_n(const float *in, float *out, size_t n);
+
+/**
+ * @brief Computes the inverse hyperbolic sines of an array of
+ * single-precision floating-point numbers.
+ *
+ * Batch form of mu_asinhf(). `out` may be the same array as `in`.
+ *
+ * @param in Input array of `n` elements.
+ * @param out Output array of `n` elements.
+ * @param n Number of elements.
+ */
+void mu_asinhf_n(const float *in, float *out, size_t n);
+
+/**
+ * @brief Computes the inverse hyperbolic cosines of an array of
+ * single-precision floating-point numbers.
+ *
+ * Batch form of mu_acoshf(). `out` may be the same array as `in`.
+ *
+ * @param in Input array of `n` elements.
+ * @param out Output array of `n` elements.
+ * @param n Number of elements.
+ */
+void mu_acoshf_n(const float *in, float *out, size_t n);
+
+/**
+ * @brief Computes the inverse hyperbolic tangents of an array of
+ * single-precision floating-point numbers.
+ *
+ * Batch form of mu_atanhf(). `out` may be the same array as `in`.
+ *
+ * @param in Input array of `n` elements.
+ * @param out Output array of `n` elements.
+ * @param n Number of elements.
+ */
+void mu_atanhf_n(const float *in, float *out, size_t n);
+
+/**
+ * @brief Computes the fast-tier sines of an array of double-precision
+ * floating-point numbers.
+ *
+ * Batch form of mu_sin_fast(). `out` may be the same array as `in`.
+ *
+ * @param in Input array of `n` elements.
+ * @param out Output array of `n` elements.
+ * @param n Number of elements.
+ */
+void mu_sin_fast_n(const double *in, double *out, size_t n);
+
+/**
+ * @brief Computes the medium-tier sines of an array of double-precision
+ * floating-point numbers.
+ *
+ * Batch form of mu_sin_medium(). `out` may be the same array as `in`.
+ *
+ * @param in Input array of `n` elements.
+ * @param out Output array of `n` elements.
+ * @param n Number of elements.
+ */
+void mu_sin_medium_n(const double *in, double *out, size_t n);
+
+/**
+ * @brief Computes the fast-tier cosines of an array of double-precision
+ * floating-point numbers.
+ *
+ * Batch form of mu_cos_fast(). `out` may be the same array as `in`.
+ *
+ * @param in Input array of `n` elements.
+ * @param out Output array of `n` elements.
+ * @param n Number of elements.
+ */
+void mu_cos_fast_n(const double *in, double *out, size_t n);
+
+/**
+ * @brief Computes the medium-tier cosines of an array of double-precision
+ * floating-point numbers.
+ *
+ * Batch form of mu_cos_medium(). `out` may be the same array as `in`.
+ *
+ * @param in Input array of `n` elements.
+ * @param out Output array of `n` elements.
+ * @param n Number of elements.
+ */
+void mu_cos_medium_n(const double *in, double *out, size_t n);
+
+/**
+ * @brief Computes the fast-tier exponentials of an array of double-precision
+ * floating-point numbers.
+ *
+ * Batch form of mu_exp_fast(). `out` may be the same array as `in`.
+ *
+ * @param in Input array of `n` elements.
+ * @param out Output array of `n` elements.
+ * @param n Number of elements.
+ */
+void mu_exp_fast_n(const double *in, double *out, size_t n);
+
+/**
+ * @brief Computes the medium-tier exponentials of an array of double-precision
+ * floating-point numbers.
+ *
+ * Batch form of mu_exp_medium(). `out` may be the same array as `in`.
+ *
+ * @param in Input array of `n` elements.
+ * @param out Output array of `n` elements.
+ * @param n Number of elements.
+ */
+void mu_exp_medium_n(const double *in, double *out, size_t n);
+
+/**
+ * @brief Computes the fast-tier natural logarithms of an array of
+ * double-precision floating-point numbers.
+ *
+ * Batch form of mu_log_fast(). `out` may be the same array as `in`.
+ *
+ * @param in Input array of `n` elements.
+ * @param out Output array of `n` elements.
+ * @param n Number of elements.
+ */
+void mu_log_fast_n(const double *in, double *out, size_t n);
+
+/**
+ * @brief Computes the medium-tier natural logarithms of an array of
+ * double-precision floating-point numbers.
+ *
+ * Batch form of mu_log_medium(). `out` may be the same array as `in`.
+ *
+ * @param in Input array of `n` elements.
+ * @param out Output array of `n` elements.
+ * @param n Number of elements.
+ */
+void mu_log_medium_n(const double *in, double *out, size_t n);
+
+/**
+ * @brief Returns the instruction set the batch functions currently run on.
+ *
+ * On x86 the batch kernels are built for SSE2, AVX2+FMA and AVX-512, and the
+ * first batch call picks the widest one the CPU supports. The environment
+ * variable `MU_BATCH_ISA` overrides that choice when it names a supported
+ * instruction set. Other targets have a single `"native"` variant.
+ *
+ * @return `"sse2"`, `"avx2"`, `"avx512"` or `"native"`.
+ */
+const char *mu_batch_isa(void);
+
+/**
+ * @brief Switches the batch functions to another instruction set.
+ *
+ * Intended for benchmarking and for bisecting problems in one variant; it
+ * must not race with batch calls in other threads.
+ *
+ * @param isa One of the names returned by mu_batch_isa(), or `NULL` to redo
+ * the automatic choice.
+ * @return 0 on success, -1 if `isa` is unknown or the CPU does not support
+ * it. The current choice is kept on failure.
+ */
+int mu_batch_set_isa(const char *isa);
+
+/**
+ * @brief Number of input-magnitude buckets in mu_stats_counters.
+ */
+#define MU_STATS_BUCKETS 16
+
+/**
+ * @brief Functions with instrumentation counters. Each counts its long double
+ * and its `_d` form together.
+ */
+typedef enum {
+  MU_STATS_SIN,
+  MU_STATS_COS,
+  MU_STATS_ASIN,
+  MU_STATS_SQRT,
+  MU_STATS_EXP,
+  MU_STATS_LOG,
+  MU_STATS_FUNCS
+} mu_stats_func;
+
+/**
+ * @brief Counters of one function.
+ */
+typedef struct {
+  /** Number of calls. */
+  unsigned long long calls;
+  /** Calls with a NaN input. */
+  unsigned long long nan;
+  /** Calls with an infinite input. */
+  unsigned long long inf;
+  /** Domain errors: finite inputs with a NaN result, like mu_sqrt(-1). */
+  unsigned long long domain;
+  /** Range errors: overflow, underflow to zero, or a pole like mu_log(0). */
+  unsigned long long range;
+  /**
+   * Calls that took the function's slow path: Payne-Hanek reduction for
+   * sin/cos (|x| >= 2^20), the near-one branch of asin (|x| >= 0.975),
+   * subnormal inputs for sqrt/log and subnormal results for exp.
+   */
+  unsigned long long slow;
+  /**
+   * Finite inputs by binary exponent e of |x|. The bucket edges are at e =
+   * -64, -32, -16, -8, -4, -2, -1, 0, 1, 2, 4, 8, 16, 32 and 64: bucket 0
+   * holds zeros, subnormals and e < -64, bucket 8 holds 1 <= |x| < 2 and
+   * bucket 15 holds e >= 64.
+   */
+  unsigned long long magnitude[MU_STATS_BUCKETS];
+} mu_stats_counters;
+
+/**
+ * @brief Snapshot of the instrumentation counters of all threads.
+ */
+typedef struct {
+  /** Nonzero if the library was built with `MU_STATS`. */
+  int enabled;
+  /** Counters indexed by mu_stats_func. */
+  mu_stats_counters func[MU_STATS_FUNCS];
+} mu_stats;
+
+/**
+ * @brief Reads the instrumentation counters.
+ *
+ * The counters exist only in builds with the `MU_STATS` option. They are
+ * kept per thread and summed here, including threads that have exited. Builds
+ * without the option have no counting cost and return all zeros with
+ * `enabled` cleared.
+ *
+ * @param out Receives the sums.
+ */
+void mu_stats_snapshot(mu_stats *out);
+
+/**
+ * @brief Sets every instrumentation counter to zero. Counts made by other
+ * threads while the reset runs may survive it.
+ */
+void mu_stats_reset(void);
+
+/**
+ * @brief Functions that mu_parallel_apply() and mu_apply_strided() can run,
+ * each naming the batch function of the same name (MU_FN_SIN runs mu_sin_n(),
+ * and so on).
+ */
+typedef enum {
+  MU_FN_FABS,
+  MU_FN_TRUNC,
+  MU_FN_CEIL,
+  MU_FN_FLOOR,
+  MU_FN_SIN,
+  MU_FN_COS,
+  MU_FN_TAN,
+  MU_FN_ASIN,
+  MU_FN_ACOS,
+  MU_FN_ATAN,
+  MU_FN_SQRT,
+  MU_FN_RSQRT,
+  MU_FN_EXP,
+  MU_FN_LOG,
+  MU_FN_SIN_FAST,
+  MU_FN_SIN_MEDIUM,
+  MU_FN_COS_FAST,
+  MU_FN_COS_MEDIUM,
+  MU_FN_EXP_FAST,
+  MU_FN_EXP_MEDIUM,
+  MU_FN_LOG_FAST,
+  MU_FN_LOG_MEDIUM,
+  MU_FN_ROUND,
+  MU_FN_NEARBYINT,
+  MU_FN_SINPI,
+  MU_FN_COSPI,
+  MU_FN_TANPI,
+  MU_FN_SIND,
+  MU_FN_COSD,
+  MU_FN_SINH,
+  MU_FN_COSH,
+  MU_FN_TANH,
+  MU_FN_ASINH,
+  MU_FN_ACOSH,
+  MU_FN_ATANH,
+  MU_FN_EXP2,
+  MU_FN_EXP10,
+  MU_FN_EXPM1,
+  MU_FN_LOG2,
+  MU_FN_LOG10,
+  MU_FN_LOG1P,
+  MU_FN_COUNT
+} mu_fn_id;
+
+/**
+ * @brief Applies a batch function to an array on several threads.
+ *
+ * The array is cut into fixed-size chunks. Each thread starts on its own
+ * contiguous run of chunks, so it works on memory it is likely to have
+ * touched, and then takes chunks left over by the others. Every element is
+ * computed by the same batch kernel as in the serial call, so the output is
+ * bit-identical to it for any thread count. The worker threads are created at
+ * the first call that needs them and are reused. Concurrent calls run one
+ * after another.
+ *
+ * @param fn Function to apply.
+ * @param in Input array of `n` elements.
+ * @param out Output array of `n` elements; may be the same array as `in`.
+ * @param n Number of elements.
+ * @param nthreads Number of threads including the caller, or 0 or less for
+ * one per online CPU. Small arrays use fewer threads.
+ * @return 0 on success, -1 if `fn` is not a valid mu_fn_id.
+ */
+int mu_parallel_apply(mu_fn_id fn, const double *in, double *out, size_t n,
+                      int nthreads);
+
+/**
+ * @brief Stops and joins the worker threads of mu_parallel_apply(). A later
+ * call starts them again. Must not run concurrently with mu_parallel_apply().
+ */
+void mu_parallel_shutdown(void);
+
+/**
+ * @brief Binary functions that mu_apply2_strided() can run, each naming the
+ * batch function of the same name (MU_FN2_POW runs mu_pow_n(), and so on).
+ */
+typedef enum {
+  MU_FN2_FMOD,
+  MU_FN2_ATAN2,
+  MU_FN2_POW,
+  MU_FN2_REMAINDER,
+  MU_FN2_COUNT
+} mu_fn2_id;
+
+/**
+ * @brief Applies a batch function to strided data, such as one field of an
+ * array of structs.
+ *
+ * Element i is read from `in[i * in_stride]` and written to
+ * `out[i * out_stride]`; strides count doubles and may be zero or negative.
+ * For an array `p` of structs with double fields `angle` and `s`:
+ * @code
+ * ptrdiff_t stride = sizeof(p[0]) / sizeof(double);
+ * mu_apply_strided(MU_FN_SIN, &p[0].angle, stride, &p[0].s, stride, n);
+ * @endcode
+ * The elements are gathered block by block into a small buffer that stays in
+ * cache, run through the same kernel as the contiguous call and scattered
+ * back, so the results are bit-identical to it. Unit strides skip the copy.
+ *
+ * @param fn Function to apply.
+ * @param in First input element.
+ * @param in_stride Distance between input elements.
+ * @param out First output element. The output may be the input with the same
+ * stride, but must not overlap it otherwise.
+ * @param out_stride Distance between output elements.
+ * @param n Number of elements.
+ * @return 0 on success, -1 if `fn` is not a valid mu_fn_id.
+ */
+int mu_apply_strided(mu_fn_id fn, const double *in, ptrdiff_t in_stride,
+                     double *out, ptrdiff_t out_stride, size_t n);
+
+/**
+ * @brief Applies a binary batch function to two strided inputs, such as two
+ * fields of an array of structs. A zero stride repeats one value, for
+ * example a common exponent of mu_pow().
+ *
+ * @param fn Function to apply.
+ * @param x First element of the first argument.
+ * @param x_stride Distance between elements of `x`.
+ * @param y First element of the second argument.
+ * @param y_stride Distance between elements of `y`.
+ * @param out First output element. The output may be one of the inputs with
+ * the same stride, but must not overlap them otherwise.
+ * @param out_stride Distance between output elements.
+ * @param n Number of elements.
+ * @return 0 on success, -1 if `fn` is not a valid mu_fn2_id.
+ * @see mu_apply_strided()
+ */
+int mu_apply2_strided(mu_fn2_id fn, const double *x, ptrdiff_t x_stride,
+                      const double *y, ptrdiff_t y_stride, double *out,
+                      ptrdiff_t out_stride, size_t n);
+
 #endif  // MATH_MATH_UTILS_H_
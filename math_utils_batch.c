@@ -0,0 +1,2431 @@
+#include "math_utils.h"
+#include "math_utils_dispatch.h"
+#include "math_utils_internal.h"
+#include "math_utils_simd.h"
+
+/*
+ * With runtime dispatch this file is compiled once per instruction set; the
+ * wrapper files set MU_ISA_SUFFIX before including it. Each variant keeps its
+ * functions static and exports only its mu_batch_table.
+ */
+#if defined(MU_DISPATCH)
+#ifndef MU_ISA_SUFFIX
+#define MU_ISA_SUFFIX _sse2
+#endif
+#define MU_BATCH_API static
+#define MU_VARIANT(name) MU_CAT(name, MU_ISA_SUFFIX)
+#else
+#define MU_BATCH_API
+#define MU_VARIANT(name) name
+#endif
+
+/*
+ * Applies a vector kernel to a whole array: full vectors first, then the
+ * remaining tail through a padded partial vector. `fill` is a harmless input
+ * for the unused tail lanes.
+ */
+#define MU_BATCH_UNARY(name, kernel, fill)                          \
+  MU_BATCH_API void MU_VARIANT(name)(const double *in, double *out, \
+                                     size_t n) {                    \
+    size_t i = 0;                                                   \
+    for (; i + MU_VLEN <= n; i += MU_VLEN) {                        \
+      mu_v_store(out + i, kernel(mu_v_load(in + i)));               \
+    }                                                               \
+    if (i < n) {                                                    \
+      mu_vf64 x = mu_v_load_partial(in + i, n - i, fill);           \
+      mu_v_store_partial(out + i, kernel(x), n - i);                \
+    }                                                               \
+  }
+
+/*
+ * MU_BATCH_UNARY() for kernels with a cheaper form on clean inputs. Each block
+ * is classified once with `clean`; blocks where every lane passes run `fast`,
+ * the others run the full `kernel`, which handles special lanes one by one
+ * through its selects. Both give the same results on clean lanes.
+ */
+#define MU_BATCH_BLOCK (8 * MU_VLEN)
+
+#define MU_BATCH_UNARY_SPLIT(name, kernel, fast, clean, fill)       \
+  MU_BATCH_API void MU_VARIANT(name)(const double *in, double *out, \
+                                     size_t n) {                    \
+    size_t i = 0;                                                   \
+    for (; i + MU_BATCH_BLOCK <= n; i += MU_BATCH_BLOCK) {          \
+      mu_vi64 ok = clean(mu_v_load(in + i));                        \
+      for (size_t j = MU_VLEN; j < MU_BATCH_BLOCK; j += MU_VLEN) {  \
+        ok &= clean(mu_v_load(in + i + j));                         \
+      }                                                             \
+      if (mu_v_all(ok)) {                                           \
+        for (size_t j = 0; j < MU_BATCH_BLOCK; j += MU_VLEN) {      \
+          mu_v_store(out + i + j, fast(mu_v_load(in + i + j)));     \
+        }                                                           \
+      } else {                                                      \
+        for (size_t j = 0; j < MU_BATCH_BLOCK; j += MU_VLEN) {      \
+          mu_v_store(out + i + j, kernel(mu_v_load(in + i + j)));   \
+        }                                                           \
+      }                                                             \
+    }                                                               \
+    for (; i + MU_VLEN <= n; i += MU_VLEN) {                        \
+      mu_v_store(out + i, kernel(mu_v_load(in + i)));               \
+    }                                                               \
+    if (i < n) {                                                    \
+      mu_vf64 x = mu_v_load_partial(in + i, n - i, fill);           \
+      mu_v_store_partial(out + i, kernel(x), n - i);                \
+    }                                                               \
+  }
+
+#define MU_BATCH_BINARY(name, kernel, fill_x, fill_y)                  \
+  MU_BATCH_API void MU_VARIANT(name)(const double *x, const double *y, \
+                                     double *out, size_t n) {          \
+    size_t i = 0;                                                      \
+    for (; i + MU_VLEN <= n; i += MU_VLEN) {                           \
+      mu_v_store(out + i, kernel(mu_v_load(x + i), mu_v_load(y + i))); \
+    }                                                                  \
+    if (i < n) {                                                       \
+      mu_vf64 vx = mu_v_load_partial(x + i, n - i, fill_x);            \
+      mu_vf64 vy = mu_v_load_partial(y + i, n - i, fill_y);            \
+      mu_v_store_partial(out + i, kernel(vx, vy), n - i);              \
+    }                                                                  \
+  }
+
+#define MU_BATCHF_UNARY(name, kernel, fill)                       \
+  MU_BATCH_API void MU_VARIANT(name)(const float *in, float *out, \
+                                     size_t n) {                  \
+    size_t i = 0;                                                 \
+    for (; i + MU_VLENF <= n; i += MU_VLENF) {                    \
+      mu_vf_store(out + i, kernel(mu_vf_load(in + i)));           \
+    }                                                             \
+    if (i < n) {                                                  \
+      mu_vf32 x = mu_vf_load_partial(in + i, n - i, fill);        \
+      mu_vf_store_partial(out + i, kernel(x), n - i);             \
+    }                                                             \
+  }
+
+#define MU_BATCHF_BINARY(name, kernel, fill_x, fill_y)                    \
+  MU_BATCH_API void MU_VARIANT(name)(const float *x, const float *y,      \
+                                     float *out, size_t n) {              \
+    size_t i = 0;                                                         \
+    for (; i + MU_VLENF <= n; i += MU_VLENF) {                            \
+      mu_vf_store(out + i, kernel(mu_vf_load(x + i), mu_vf_load(y + i))); \
+    }                                                                     \
+    if (i < n) {                                                          \
+      mu_vf32 vx = mu_vf_load_partial(x + i, n - i, fill_x);              \
+      mu_vf32 vy = mu_vf_load_partial(y + i, n - i, fill_y);              \
+      mu_vf_store_partial(out + i, kernel(vx, vy), n - i);                \
+    }                                                                     \
+  }
+
+/* Batch form of a kernel with two results, such as mu_v_sincos(). */
+#define MU_BATCH_SINCOS(name, kernel, fill)                         \
+  MU_BATCH_API void MU_VARIANT(name)(const double *in, double *s,   \
+                                     double *c, size_t n) {         \
+    size_t i = 0;                                                   \
+    mu_vf64 vs, vc;                                                 \
+    for (; i + MU_VLEN <= n; i += MU_VLEN) {                        \
+      kernel(mu_v_load(in + i), &vs, &vc);                          \
+      mu_v_store(s + i, vs);                                        \
+      mu_v_store(c + i, vc);                                        \
+    }                                                               \
+    if (i < n) {                                                    \
+      kernel(mu_v_load_partial(in + i, n - i, fill), &vs, &vc);     \
+      mu_v_store_partial(s + i, vs, n - i);                         \
+      mu_v_store_partial(c + i, vc, n - i);                         \
+    }                                                               \
+  }
+
+#define MU_BATCHF_SINCOS(name, kernel, fill)                        \
+  MU_BATCH_API void MU_VARIANT(name)(const float *in, float *s,     \
+                                     float *c, size_t n) {          \
+    size_t i = 0;                                                   \
+    mu_vf32 vs, vc;                                                 \
+    for (; i + MU_VLENF <= n; i += MU_VLENF) {                      \
+      kernel(mu_vf_load(in + i), &vs, &vc);                         \
+      mu_vf_store(s + i, vs);                                       \
+      mu_vf_store(c + i, vc);                                       \
+    }                                                               \
+    if (i < n) {                                                    \
+      kernel(mu_vf_load_partial(in + i, n - i, fill), &vs, &vc);    \
+      mu_vf_store_partial(s + i, vs, n - i);                        \
+      mu_vf_store_partial(c + i, vc, n - i);                        \
+    }                                                               \
+  }
+
+static inline mu_vf64 mu_v_trunc(mu_vf64 x) {
+#if defined(MU_V_ROUND)
+  return MU_V_ROUND(x, _MM_FROUND_TO_ZERO);
+#else
+  mu_vf64 ax = mu_v_abs(x);
+  mu_vi64 keep = (ax >= MU_TWO52) | mu_v_isnan(x);
+  mu_vf64 t = (ax + MU_TWO52) - MU_TWO52;
+  t = mu_v_select(t > ax, t - 1.0, t);
+  return mu_v_select(keep, x, mu_v_copysign(t, x));
+#endif
+}
+
+static inline mu_vf64 mu_v_floor(mu_vf64 x) {
+#if defined(MU_V_ROUND)
+  return MU_V_ROUND(x, _MM_FROUND_TO_NEG_INF);
+#else
+  mu_vf64 t = mu_v_trunc(x);
+  return mu_v_select(t > x, t - 1.0, t);
+#endif
+}
+
+static inline mu_vf64 mu_v_ceil(mu_vf64 x) {
+#if defined(MU_V_ROUND)
+  return MU_V_ROUND(x, _MM_FROUND_TO_POS_INF);
+#else
+  mu_vf64 t = mu_v_trunc(x);
+  return mu_v_select(t < x, t + 1.0, t);
+#endif
+}
+
+/* Halfway cases away from zero: adds the signed 0 or 1 to the truncation. */
+static inline mu_vf64 mu_v_round(mu_vf64 x) {
+  mu_vf64 t = mu_v_trunc(x);
+  mu_vf64 half = mu_v_select(mu_v_abs(x - t) >= 0.5, mu_v_dup(1.0),
+                             mu_v_dup(0.0));
+  return t + mu_v_copysign(half, x);
+}
+
+static inline mu_vf64 mu_v_nearbyint(mu_vf64 x) {
+#if defined(MU_V_ROUND)
+  return MU_V_ROUND(x, _MM_FROUND_CUR_DIRECTION);
+#else
+  mu_vf64 shift = mu_v_copysign(mu_v_dup(MU_TWO52), x);
+  mu_vf64 r = mu_v_copysign((x + shift) - shift, x);
+  return mu_v_select(mu_v_abs(x) < MU_TWO52, r, x);
+#endif
+}
+
+/* Stores the truncation in `ipart`; the fraction of an infinity is 0. */
+static inline mu_vf64 mu_v_modf(mu_vf64 x, mu_vf64 *ipart) {
+  *ipart = mu_v_trunc(x);
+  mu_vf64 frac = mu_v_select(mu_v_isinf(x), mu_v_dup(0.0), x - *ipart);
+  return mu_v_copysign(frac, x);
+}
+
+/*
+ * mu_fmod_kernel() lane by lane, out of line so that the vector path stays
+ * small enough to inline. Lanes in `special` are left to the caller.
+ */
+static __attribute__((noinline)) mu_vf64 mu_v_fmod_lanes(mu_vf64 ax,
+                                                         mu_vf64 ay,
+                                                         mu_vi64 special,
+                                                         mu_vi64 *q) {
+  mu_vf64 r = ax;
+  for (int i = 0; i < MU_VLEN; ++i) {
+    uint64_t bits = 0;
+    if (!special[i]) {
+      r[i] = mu_fmod_kernel(ax[i], ay[i], &bits);
+    }
+    (*q)[i] = (long long)(bits & 0x7fffffff);
+  }
+  return r;
+}
+
+/*
+ * fmod(ax, ay) for ax >= 0 and ay >= 0, exactly, and the low 31 bits of the
+ * quotient in `q`, for the lanes outside `special`: those with ax finite and
+ * ay finite and nonzero. Vectors whose other lanes all fit the fast path of
+ * mu_fmod_kernel() take it in vector form; others run it lane by lane.
+ */
+static inline mu_vf64 mu_v_fmod_kernel(mu_vf64 ax, mu_vf64 ay,
+                                       mu_vi64 special, mu_vi64 *q) {
+  mu_vi64 fast = (ax < ay * 0x1p52) & (ay >= MU_FMOD_FAST_MIN) &
+                 (ay < MU_FMOD_FAST_MAX);
+  if (mu_v_all(fast | special)) {
+    /* The quotient is at most one too large; ax - n * ay is then negative. */
+    mu_vf64 n = mu_v_trunc(ax / ay);
+#if defined(__FMA__) || defined(__AVX512F__)
+    mu_vf64 r = mu_v_fnma(n, ay, ax);
+#else
+    mu_vf64 e;
+    mu_vf64 p = mu_v_two_prod(n, ay, &e);
+    mu_vf64 r = (ax - p) - e;
+#endif
+    mu_vi64 neg = r < 0.0;
+    mu_vi64 bits = (mu_vi64)(n + MU_TWO52) - (mu_vi64)mu_v_dup(MU_TWO52);
+    *q = (bits + neg) & 0x7fffffff;
+    return mu_v_select(neg, r + ay, r);
+  }
+  return mu_v_fmod_lanes(ax, ay, special, q);
+}
+
+/*
+ * Remainder of x / y for the quotient rounded to nearest, ties to even when
+ * `nearest` is set, or truncated. `quo` receives the signed low 31 bits of
+ * the quotient.
+ */
+static inline mu_vf64 mu_v_rem(mu_vf64 x, mu_vf64 y, int nearest,
+                               mu_vi64 *quo) {
+  mu_vf64 ax = mu_v_abs(x);
+  mu_vf64 ay = mu_v_abs(y);
+  mu_vi64 nan = ~(ax < MU_INF) | ~(ay > 0.0);
+  mu_vi64 keep = (ay == MU_INF) & ~nan;
+  mu_vi64 special = nan | keep;
+
+  mu_vi64 q;
+  mu_vf64 r = mu_v_fmod_kernel(ax, ay, special, &q);
+  mu_vi64 up = {0};
+  if (nearest) {
+    up = (2.0 * r > ay) | ((2.0 * r == ay) & ((q & 1) != 0));
+    r = mu_v_select(up, ay - r, r);
+    q = (q - up) & 0x7fffffff;
+  }
+  mu_vi64 neg = ((mu_vi64)x ^ (mu_vi64)y) < 0;
+  *quo = ((q ^ neg) - neg) & ~special;
+
+  r = mu_v_copysign(r, x);
+  r = mu_v_select(up, -r, r);
+  r = mu_v_select(keep, x, r);
+  return mu_v_select(nan, mu_v_dup(MU_NAN), r);
+}
+
+static inline mu_vf64 mu_v_fmod(mu_vf64 x, mu_vf64 y) {
+  mu_vf64 ax = mu_v_abs(x);
+  mu_vf64 ay = mu_v_abs(y);
+  mu_vi64 nan = ~(ax < MU_INF) | ~(ay > 0.0);
+  mu_vi64 special = nan | (ay == MU_INF);
+
+  mu_vi64 q;
+  mu_vf64 r = mu_v_fmod_kernel(ax, ay, special, &q);
+  r = mu_v_select(special, x, mu_v_copysign(r, x));
+  return mu_v_select(nan, mu_v_dup(MU_NAN), r);
+}
+
+static inline mu_vf64 mu_v_remainder(mu_vf64 x, mu_vf64 y) {
+  mu_vi64 q;
+  return mu_v_rem(x, y, 1, &q);
+}
+
+/* Cody-Waite part of mu_v_rem_pio2(), for |x| < MU_PIO2_MEDIUM. */
+static inline mu_vi64 mu_v_rem_pio2_medium(mu_vf64 x, mu_vf64 *hi,
+                                           mu_vf64 *lo) {
+  mu_vf64 t = x * MU_INV_PIO2 + MU_ROUND_SHIFT;
+  mu_vf64 fn = t - MU_ROUND_SHIFT;
+
+  mu_vf64 r = x - fn * MU_PIO2_1;
+  mu_vf64 e1, e2;
+  mu_vf64 s = mu_v_two_sum(r, -fn * MU_PIO2_2, &e1);
+  s = mu_v_two_sum(s, -fn * MU_PIO2_3, &e2);
+  *hi = mu_v_two_sum(s, (e1 + e2) - fn * MU_PIO2_3T, lo);
+
+  return (mu_vi64)t;
+}
+
+/*
+ * Vector form of mu_rem_pio2(). Lanes beyond the Cody-Waite range are rare and
+ * go through the scalar Payne-Hanek reduction one at a time.
+ */
+static inline mu_vi64 mu_v_rem_pio2(mu_vf64 x, mu_vf64 *hi, mu_vf64 *lo) {
+  mu_vi64 large = mu_v_abs(x) >= MU_PIO2_MEDIUM;
+  mu_vi64 n =
+      mu_v_rem_pio2_medium(mu_v_select(large, mu_v_dup(0.0), x), hi, lo);
+
+  if (mu_v_any(large)) {
+    for (int i = 0; i < MU_VLEN; ++i) {
+      if (large[i]) {
+        double h, l;
+        n[i] = mu_rem_pio2_large(x[i], &h, &l);
+        (*hi)[i] = h;
+        (*lo)[i] = l;
+      }
+    }
+  }
+
+  return n;
+}
+
+static inline mu_vf64 mu_v_sin_kernel(mu_vf64 x, mu_vf64 y) {
+  mu_vf64 z = x * x;
+  mu_vf64 v = z * x;
+  mu_vf64 r = MU_SIN_S2 +
+              z * (MU_SIN_S3 +
+                   z * (MU_SIN_S4 + z * (MU_SIN_S5 + z * MU_SIN_S6)));
+  return x - ((z * (0.5 * y - v * r) - y) - v * MU_SIN_S1);
+}
+
+static inline mu_vf64 mu_v_cos_kernel(mu_vf64 x, mu_vf64 y) {
+  mu_vf64 z = x * x;
+  mu_vf64 r =
+      z * (MU_COS_C1 +
+           z * (MU_COS_C2 +
+                z * (MU_COS_C3 +
+                     z * (MU_COS_C4 +
+                          z * (MU_COS_C5 + z * MU_COS_C6)))));
+  mu_vf64 hz = 0.5 * z;
+  mu_vf64 w = 1.0 - hz;
+  return w + (((1.0 - w) - hz) + (z * r - x * y));
+}
+
+/* Results for quadrant `n` and reduced argument hi + lo. */
+static inline mu_vf64 mu_v_sin_reduced(mu_vi64 n, mu_vf64 hi, mu_vf64 lo) {
+  mu_vf64 res = mu_v_select((n & 1) != 0, mu_v_cos_kernel(hi, lo),
+                            mu_v_sin_kernel(hi, lo));
+  return mu_v_select((n & 2) != 0, -res, res);
+}
+
+static inline mu_vf64 mu_v_cos_reduced(mu_vi64 n, mu_vf64 hi, mu_vf64 lo) {
+  mu_vf64 res = mu_v_select((n & 1) != 0, mu_v_sin_kernel(hi, lo),
+                            mu_v_cos_kernel(hi, lo));
+  return mu_v_select(((n + 1) & 2) != 0, -res, res);
+}
+
+static inline void mu_v_sincos_reduced(mu_vi64 n, mu_vf64 hi, mu_vf64 lo,
+                                       mu_vf64 *s, mu_vf64 *c) {
+  mu_vf64 sin_r = mu_v_sin_kernel(hi, lo);
+  mu_vf64 cos_r = mu_v_cos_kernel(hi, lo);
+  mu_vi64 odd = (n & 1) != 0;
+  mu_vf64 rs = mu_v_select(odd, cos_r, sin_r);
+  mu_vf64 rc = mu_v_select(odd, sin_r, cos_r);
+  *s = mu_v_select((n & 2) != 0, -rs, rs);
+  *c = mu_v_select(((n + 1) & 2) != 0, -rc, rc);
+}
+
+static inline mu_vf64 mu_v_tan_reduced(mu_vi64 n, mu_vf64 hi, mu_vf64 lo) {
+  mu_vf64 z = hi * hi;
+  mu_vf64 r = hi * z * ((MU_TAN_P0 * z + MU_TAN_P1) * z + MU_TAN_P2) /
+              ((((z + MU_TAN_Q1) * z + MU_TAN_Q2) * z + MU_TAN_Q3) * z +
+               MU_TAN_Q4);
+  mu_vf64 t = hi + r;
+  mu_vf64 w = r + lo * (1.0 + t * t);
+  t = hi + w;
+  mu_vf64 q = -1.0 / t;
+  mu_vf64 cot = q + q * q * (w - (t - hi));
+  return mu_v_select((n & 1) != 0, cot, t);
+}
+
+/* sin(x) or tan(x) as `res`, with x itself below MU_TRIG_TINY like mu_sin_d. */
+static inline mu_vf64 mu_v_trig_tiny(mu_vf64 x, mu_vf64 res) {
+  return mu_v_select(mu_v_abs(x) < MU_TRIG_TINY, x, res);
+}
+
+static inline mu_vf64 mu_v_sin(mu_vf64 x) {
+  mu_vi64 special = mu_v_isnan(x) | mu_v_isinf(x);
+  mu_vf64 hi, lo;
+  mu_vi64 n = mu_v_rem_pio2(mu_v_select(special, mu_v_dup(0.0), x), &hi, &lo);
+
+  return mu_v_select(special, mu_v_dup(MU_NAN),
+                     mu_v_trig_tiny(x, mu_v_sin_reduced(n, hi, lo)));
+}
+
+static inline mu_vf64 mu_v_cos(mu_vf64 x) {
+  mu_vi64 special = mu_v_isnan(x) | mu_v_isinf(x);
+  mu_vf64 hi, lo;
+  mu_vi64 n = mu_v_rem_pio2(mu_v_select(special, mu_v_dup(0.0), x), &hi, &lo);
+
+  return mu_v_select(special, mu_v_dup(MU_NAN), mu_v_cos_reduced(n, hi, lo));
+}
+
+static inline void mu_v_sincos(mu_vf64 x, mu_vf64 *s, mu_vf64 *c) {
+  mu_vi64 special = mu_v_isnan(x) | mu_v_isinf(x);
+  mu_vf64 hi, lo;
+  mu_vi64 n = mu_v_rem_pio2(mu_v_select(special, mu_v_dup(0.0), x), &hi, &lo);
+
+  mu_vf64 rs, rc;
+  mu_v_sincos_reduced(n, hi, lo, &rs, &rc);
+  *s = mu_v_select(special, mu_v_dup(MU_NAN), mu_v_trig_tiny(x, rs));
+  *c = mu_v_select(special, mu_v_dup(MU_NAN), rc);
+}
+
+static inline mu_vf64 mu_v_tan(mu_vf64 x) {
+  mu_vi64 special = mu_v_isnan(x) | mu_v_isinf(x);
+  mu_vf64 hi, lo;
+  mu_vi64 n = mu_v_rem_pio2(mu_v_select(special, mu_v_dup(0.0), x), &hi, &lo);
+
+  return mu_v_select(special, mu_v_dup(MU_NAN),
+                     mu_v_trig_tiny(x, mu_v_tan_reduced(n, hi, lo)));
+}
+
+/*
+ * Forms without special-value handling, for blocks whose every lane passes
+ * mu_v_trig_clean(): no NaN or Inf, no zero, whose sign the kernels drop,
+ * and no Payne-Hanek reduction.
+ */
+static inline mu_vi64 mu_v_trig_clean(mu_vf64 x) {
+  mu_vi64 a = (mu_vi64)mu_v_abs(x);
+  return (a > 0) & (a < (long long)mu_as_u64(MU_PIO2_MEDIUM));
+}
+
+static inline mu_vf64 mu_v_sin_unchecked(mu_vf64 x) {
+  mu_vf64 hi, lo;
+  mu_vi64 n = mu_v_rem_pio2_medium(x, &hi, &lo);
+  return mu_v_sin_reduced(n, hi, lo);
+}
+
+static inline mu_vf64 mu_v_cos_unchecked(mu_vf64 x) {
+  mu_vf64 hi, lo;
+  mu_vi64 n = mu_v_rem_pio2_medium(x, &hi, &lo);
+  return mu_v_cos_reduced(n, hi, lo);
+}
+
+static inline mu_vf64 mu_v_tan_unchecked(mu_vf64 x) {
+  mu_vf64 hi, lo;
+  mu_vi64 n = mu_v_rem_pio2_medium(x, &hi, &lo);
+  return mu_v_tan_reduced(n, hi, lo);
+}
+
+/*
+ * Vector form of mu_rem_pi(). It needs no special-value masks: NaN and
+ * infinite lanes reduce to NaN, which the kernels carry to the result.
+ */
+static inline mu_vi64 mu_v_rem_pi(mu_vf64 ax, mu_vf64 *hi, mu_vf64 *lo) {
+  mu_vf64 a = ax - ((ax + 0x1p54) - 0x1p54);
+  mu_vf64 t = 2.0 * a + MU_ROUND_SHIFT;
+  mu_vf64 r = a - 0.5 * (t - MU_ROUND_SHIFT);
+  *hi = mu_v_two_prod(r, mu_v_dup(MU_PI_HI), lo);
+  *lo += r * MU_PI_LO;
+  return (mu_vi64)t;
+}
+
+/* Vector form of mu_rem_90(); huge finite lanes are reduced one at a time. */
+static inline mu_vi64 mu_v_rem_90(mu_vf64 ax, mu_vf64 *hi, mu_vf64 *lo) {
+  mu_vf64 t = ax * (1.0 / 90.0) + MU_ROUND_SHIFT;
+  mu_vf64 r = ax - (t - MU_ROUND_SHIFT) * 90.0;
+  *hi = mu_v_two_prod(r, mu_v_dup(MU_PIO180_HI), lo);
+  *lo += r * MU_PIO180_LO;
+  mu_vi64 n = (mu_vi64)t;
+
+  mu_vi64 large = (ax >= MU_REM90_MEDIUM) & (ax < MU_INF);
+  if (mu_v_any(large)) {
+    for (int i = 0; i < MU_VLEN; ++i) {
+      if (large[i]) {
+        double h, l;
+        n[i] = mu_rem_90(ax[i], &h, &l);
+        (*hi)[i] = h;
+        (*lo)[i] = l;
+      }
+    }
+  }
+
+  return n;
+}
+
+/* Vector form of mu_tiny_scale(). */
+static inline mu_vf64 mu_v_tiny_scale(mu_vf64 *ax) {
+  mu_vi64 tiny = *ax < MU_SCALED_TINY;
+  *ax = mu_v_select(tiny, *ax * 0x1p120, *ax);
+  return mu_v_select(tiny, mu_v_dup(0x1p-120), mu_v_dup(1.0));
+}
+
+/* Results of mu_sin_quadrant() and mu_cos_quadrant() in vector form. */
+static inline mu_vf64 mu_v_sin_quadrant(mu_vi64 n, mu_vf64 hi, mu_vf64 lo,
+                                        mu_vf64 x) {
+  mu_vf64 res = mu_v_sin_reduced(n, hi, lo) + 0.0;
+  return (mu_vf64)((mu_vi64)res ^ ((mu_vi64)x & MU_SIGN_MASK));
+}
+
+static inline mu_vf64 mu_v_cos_quadrant(mu_vi64 n, mu_vf64 hi, mu_vf64 lo) {
+  return mu_v_cos_reduced(n, hi, lo) + 0.0;
+}
+
+static inline mu_vf64 mu_v_sinpi(mu_vf64 x) {
+  mu_vf64 ax = mu_v_abs(x);
+  mu_vf64 scale = mu_v_tiny_scale(&ax);
+  mu_vf64 hi, lo;
+  mu_vi64 n = mu_v_rem_pi(ax, &hi, &lo);
+  return mu_v_sin_quadrant(n, hi, lo, x) * scale;
+}
+
+static inline mu_vf64 mu_v_cospi(mu_vf64 x) {
+  mu_vf64 hi, lo;
+  mu_vi64 n = mu_v_rem_pi(mu_v_abs(x), &hi, &lo);
+  return mu_v_cos_quadrant(n, hi, lo);
+}
+
+static inline void mu_v_sincospi(mu_vf64 x, mu_vf64 *s, mu_vf64 *c) {
+  mu_vf64 ax = mu_v_abs(x);
+  mu_vf64 scale = mu_v_tiny_scale(&ax);
+  mu_vf64 hi, lo;
+  mu_vi64 n = mu_v_rem_pi(ax, &hi, &lo);
+  *s = mu_v_sin_quadrant(n, hi, lo, x) * scale;
+  *c = mu_v_cos_quadrant(n, hi, lo);
+}
+
+static inline mu_vf64 mu_v_tanpi(mu_vf64 x) {
+  mu_vf64 ax = mu_v_abs(x);
+  mu_vf64 scale = mu_v_tiny_scale(&ax);
+  mu_vf64 hi, lo;
+  mu_vi64 n = mu_v_rem_pi(ax, &hi, &lo);
+  mu_vf64 res = mu_v_tan_reduced(n, hi, lo);
+
+  /* Multiples of 1/2, as in mu_tanpi_d(). */
+  mu_vf64 edge =
+      mu_v_select((n & 1) != 0, mu_v_dup(MU_INF), mu_v_dup(0.0));
+  edge = mu_v_select((n & 2) != 0, -edge, edge);
+  res = mu_v_select(hi == 0.0, edge, res) * scale;
+  return (mu_vf64)((mu_vi64)res ^ ((mu_vi64)x & MU_SIGN_MASK));
+}
+
+static inline mu_vf64 mu_v_sind(mu_vf64 x) {
+  mu_vf64 ax = mu_v_abs(x);
+  mu_vf64 scale = mu_v_tiny_scale(&ax);
+  mu_vf64 hi, lo;
+  mu_vi64 n = mu_v_rem_90(ax, &hi, &lo);
+  return mu_v_sin_quadrant(n, hi, lo, x) * scale;
+}
+
+static inline mu_vf64 mu_v_cosd(mu_vf64 x) {
+  mu_vf64 hi, lo;
+  mu_vi64 n = mu_v_rem_90(mu_v_abs(x), &hi, &lo);
+  return mu_v_cos_quadrant(n, hi, lo);
+}
+
+static inline void mu_v_sincosd(mu_vf64 x, mu_vf64 *s, mu_vf64 *c) {
+  mu_vf64 ax = mu_v_abs(x);
+  mu_vf64 scale = mu_v_tiny_scale(&ax);
+  mu_vf64 hi, lo;
+  mu_vi64 n = mu_v_rem_90(ax, &hi, &lo);
+  *s = mu_v_sin_quadrant(n, hi, lo, x) * scale;
+  *c = mu_v_cos_quadrant(n, hi, lo);
+}
+
+static inline mu_vf64 mu_v_high_half(mu_vf64 x) {
+  return (mu_vf64)((mu_vi64)x & (long long)0xffffffff00000000ULL);
+}
+
+static inline mu_vf64 mu_v_asin_r(mu_vf64 t) {
+  mu_vf64 p =
+      t * (MU_ASIN_P0 +
+           t * (MU_ASIN_P1 +
+                t * (MU_ASIN_P2 +
+                     t * (MU_ASIN_P3 + t * (MU_ASIN_P4 + t * MU_ASIN_P5)))));
+  mu_vf64 q =
+      1.0 +
+      t * (MU_ASIN_Q1 + t * (MU_ASIN_Q2 + t * (MU_ASIN_Q3 + t * MU_ASIN_Q4)));
+  return p / q;
+}
+
+/*
+ * Vector form of mu_asin_kernel(). Both reductions are evaluated and blended;
+ * lanes with |x| > 1 or NaN fall out of the square root as NaN.
+ */
+static inline mu_vf64 mu_v_asin(mu_vf64 x) {
+  mu_vf64 ax = mu_v_abs(x);
+  mu_vi64 small = ax < 0.5;
+  mu_vf64 t = mu_v_select(small, x * x, (1.0 - ax) * 0.5);
+  mu_vf64 r = mu_v_asin_r(t);
+  mu_vf64 s = mu_v_sqrt(t);
+
+  mu_vf64 w = mu_v_high_half(s);
+  mu_vf64 c = (t - w * w) / (s + w);
+  mu_vf64 p = 2.0 * s * r - (MU_PIO2_LO - 2.0 * c);
+  mu_vf64 mid = MU_PIO4_HI - (p - (MU_PIO4_HI - 2.0 * w));
+  mu_vf64 near1 = MU_PIO2_HI - (2.0 * (s + s * r) - MU_PIO2_LO);
+
+  mu_vf64 res = mu_v_copysign(mu_v_select(ax < MU_ASIN_NEAR1, mid, near1), x);
+  return mu_v_select(small, x + x * r, res);
+}
+
+static inline mu_vf64 mu_v_acos(mu_vf64 x) {
+  mu_vf64 ax = mu_v_abs(x);
+  mu_vi64 small = ax < 0.5;
+  mu_vf64 t = mu_v_select(small, x * x, (1.0 - ax) * 0.5);
+  mu_vf64 r = mu_v_asin_r(t);
+  mu_vf64 s = mu_v_sqrt(t);
+
+  mu_vf64 w = mu_v_high_half(s);
+  mu_vf64 c = (t - w * w) / (s + w);
+  mu_vf64 pos = 2.0 * (w + (r * s + c));
+  mu_vf64 neg = MU_PI_HI - 2.0 * (s + (r * s - MU_PIO2_LO));
+
+  mu_vf64 res = mu_v_select(x < 0.0, neg, pos);
+  res = mu_v_select(x == 1.0, mu_v_dup(0.0), res);
+  return mu_v_select(small, MU_PIO2_HI - (x - (MU_PIO2_LO - x * r)), res);
+}
+
+static inline mu_vf64 mu_v_sqrt_checked(mu_vf64 x) {
+  mu_vi64 invalid = (x < 0.0) | mu_v_isnan(x) | mu_v_isinf(x);
+  return mu_v_select(invalid, mu_v_dup(MU_NAN), mu_v_sqrt(x));
+}
+
+/*
+ * Vector form of mu_rsqrt_d(). Zero, infinite and invalid lanes keep the plain
+ * 1 / sqrt(x), which already has the right special value.
+ */
+static inline mu_vf64 mu_v_rsqrt(mu_vf64 x) {
+  mu_vi64 tiny = x < 0x1p-968;
+  mu_vi64 huge = x > 0x1p1020;
+  mu_vf64 xs = mu_v_select(tiny, x * 0x1p104, x);
+  xs = mu_v_select(huge, x * 0x1p-104, xs);
+  mu_vf64 s = mu_v_sqrt(xs);
+  mu_vf64 r = 1.0 / s;
+  mu_vf64 e;
+  mu_vf64 p = mu_v_two_prod(s, s, &e);
+  mu_vf64 ds = ((xs - p) - e) * 0.5;
+  p = mu_v_two_prod(r, s, &e);
+  mu_vf64 res = r + r * (((1.0 - p) - e) - ds * r * r);
+  res = mu_v_select(tiny, res * 0x1p52, res);
+  res = mu_v_select(huge, res * 0x1p-52, res);
+  return mu_v_select((x > 0.0) & (x < MU_INF), res, 1.0 / mu_v_sqrt(x));
+}
+
+static inline mu_vf64 mu_v_atan_poly(mu_vf64 x) {
+  mu_vf64 z = x * x;
+  mu_vf64 w = z * z;
+  mu_vf64 s1 =
+      z * (MU_ATAN_T0 +
+           w * (MU_ATAN_T2 +
+                w * (MU_ATAN_T4 +
+                     w * (MU_ATAN_T6 + w * (MU_ATAN_T8 + w * MU_ATAN_T10)))));
+  mu_vf64 s2 =
+      w * (MU_ATAN_T1 +
+           w * (MU_ATAN_T3 +
+                w * (MU_ATAN_T5 + w * (MU_ATAN_T7 + w * MU_ATAN_T9))));
+  return x * (s1 + s2);
+}
+
+/*
+ * Vector form of mu_atan_kernel(). The reduction is selected per lane as a
+ * numerator/denominator pair, so every lane costs a single division.
+ */
+static inline mu_vf64 mu_v_atan(mu_vf64 x) {
+  mu_vf64 ax = mu_v_abs(x);
+  mu_vf64 zero = mu_v_dup(0.0);
+  mu_vf64 num = ax;
+  mu_vf64 den = mu_v_dup(1.0);
+  mu_vf64 hi = zero;
+  mu_vf64 lo = zero;
+
+  mu_vi64 m = ax >= MU_ATAN_B0;
+  num = mu_v_select(m, 2.0 * ax - 1.0, num);
+  den = mu_v_select(m, 2.0 + ax, den);
+  hi = mu_v_select(m, mu_v_dup(mu_atan_table[0]), hi);
+  lo = mu_v_select(m, mu_v_dup(mu_atan_table[1]), lo);
+
+  m = ax >= MU_ATAN_B1;
+  num = mu_v_select(m, ax - 1.0, num);
+  den = mu_v_select(m, ax + 1.0, den);
+  hi = mu_v_select(m, mu_v_dup(mu_atan_table[2]), hi);
+  lo = mu_v_select(m, mu_v_dup(mu_atan_table[3]), lo);
+
+  m = ax >= MU_ATAN_B2;
+  num = mu_v_select(m, ax - 1.5, num);
+  den = mu_v_select(m, 1.0 + 1.5 * ax, den);
+  hi = mu_v_select(m, mu_v_dup(mu_atan_table[4]), hi);
+  lo = mu_v_select(m, mu_v_dup(mu_atan_table[5]), lo);
+
+  m = ax >= MU_ATAN_B3;
+  num = mu_v_select(m, mu_v_dup(-1.0), num);
+  den = mu_v_select(m, ax, den);
+  hi = mu_v_select(m, mu_v_dup(mu_atan_table[6]), hi);
+  lo = mu_v_select(m, mu_v_dup(mu_atan_table[7]), lo);
+
+  mu_vf64 xr = num / den;
+  mu_vf64 res = hi - ((mu_v_atan_poly(xr) - lo) - xr);
+  return mu_v_copysign(res, x);
+}
+
+/* Vector form of mu_atan2_kernel(). */
+static inline mu_vf64 mu_v_atan2(mu_vf64 y, mu_vf64 x) {
+  mu_vf64 ax = mu_v_abs(x);
+  mu_vf64 ay = mu_v_abs(y);
+  mu_vf64 z = mu_v_atan(ay / ax);
+
+  mu_vi64 both = (ax == ay) & ((ax == 0.0) | mu_v_isinf(ax));
+  z = mu_v_select(both & (ax == 0.0), mu_v_dup(0.0), z);
+  z = mu_v_select(both & mu_v_isinf(ax), mu_v_dup(MU_PIO4_HI), z);
+  z = mu_v_select((mu_vi64)x < 0, MU_PI_HI - (z - MU_PI_LO), z);
+
+  mu_vf64 res = mu_v_copysign(z, y);
+  res = mu_v_select(ay > 0x1p60 * ax, mu_v_copysign(mu_v_dup(MU_PIO2_HI), y),
+                    res);
+  return mu_v_select(mu_v_isnan(x) | mu_v_isnan(y), x + y, res);
+}
+
+/*
+ * The reduction of mu_exp_kernel(): e^(x + xtail) = (thi + *tail) * s1 * s2
+ * with the table value thi = 2^(j/N) returned apart from the polynomial term.
+ * The scale 2^k is always split in two factors, which keeps every lane on the
+ * same path down to subnormal results. mu_v_exp_reduced() is the part after
+ * the reduction, shared with exp2.
+ */
+static inline mu_vf64 mu_v_exp_reduced(mu_vi64 ki, mu_vf64 r, mu_vf64 *tail,
+                                       mu_vf64 *s1, mu_vf64 *s2) {
+  mu_vi64 idx = (ki & (MU_EXP_N - 1)) * 2;
+  mu_vf64 p =
+      r + r * r * (MU_EXP_C2 +
+                   r * (MU_EXP_C3 + r * (MU_EXP_C4 + r * MU_EXP_C5)));
+  mu_vf64 thi = mu_v_gather(mu_exp_table, idx);
+  *tail = thi * p + mu_v_gather(mu_exp_table + 1, idx);
+
+  mu_vi64 k = ki >> MU_EXP_TABLE_BITS;
+  mu_vi64 k1 = k >> 1;
+  *s1 = (mu_vf64)((k1 + 1023) << 52);
+  *s2 = (mu_vf64)((k - k1 + 1023) << 52);
+  return thi;
+}
+
+static inline mu_vf64 mu_v_exp_parts(mu_vf64 x, mu_vf64 xtail, mu_vf64 *tail,
+                                     mu_vf64 *s1, mu_vf64 *s2) {
+  mu_vf64 t = x * MU_EXP_INV_LN2N + MU_ROUND_SHIFT;
+  mu_vf64 kd = t - MU_ROUND_SHIFT;
+  mu_vi64 ki = (mu_vi64)t - (long long)mu_as_u64(MU_ROUND_SHIFT);
+  mu_vf64 r = (x - kd * MU_EXP_LN2HI_N) - kd * MU_EXP_LN2LO_N + xtail;
+
+  return mu_v_exp_reduced(ki, r, tail, s1, s2);
+}
+
+/* Vector form of mu_exp_kernel(). */
+static inline mu_vf64 mu_v_exp_kernel(mu_vf64 x, mu_vf64 xtail) {
+  mu_vf64 tail, s1, s2;
+  mu_vf64 thi = mu_v_exp_parts(x, xtail, &tail, &s1, &s2);
+  return (thi + tail) * s1 * s2;
+}
+
+/* Vector form of mu_expm1_small(). */
+static inline mu_vf64 mu_v_expm1_small(mu_vf64 x) {
+  mu_vf64 q = MU_EXPM1_C6 +
+              x * (MU_EXPM1_C7 +
+                   x * (MU_EXPM1_C8 + x * (MU_EXPM1_C9 + x * MU_EXPM1_C10)));
+  return x + x * x *
+                 (MU_EXP_C2 +
+                  x * (MU_EXP_C3 + x * (MU_EXP_C4 + x * (MU_EXP_C5 + x * q))));
+}
+
+/*
+ * e^x - 1 from the parts of mu_v_exp_parts(), as in mu_expm1_kernel(). Above
+ * 700 the 1 no longer shows and the single scale could overflow, so those
+ * lanes take e^x. The small-argument polynomial is evaluated only when some
+ * lane needs it.
+ */
+static inline mu_vf64 mu_v_expm1_parts(mu_vf64 x, mu_vf64 thi, mu_vf64 tail,
+                                       mu_vf64 s1, mu_vf64 s2) {
+  mu_vf64 scale = s1 * s2;
+  mu_vf64 e;
+  mu_vf64 hi = mu_v_two_sum(thi * scale, mu_v_dup(-1.0), &e);
+  mu_vf64 res = mu_v_select(x > 700.0, (thi + tail) * s1 * s2,
+                            hi + (tail * scale + e));
+
+  mu_vi64 small = mu_v_abs(x) < MU_EXPM1_SMALL;
+  if (mu_v_any(small)) {
+    res = mu_v_select(small, mu_v_expm1_small(x), res);
+  }
+  return res;
+}
+
+/* Lanes that need none of the special cases of mu_v_exp(). */
+static inline mu_vi64 mu_v_exp_clean(mu_vf64 x) {
+  return (x >= MU_EXP_UNDERFLOW) & (x <= MU_EXP_OVERFLOW);
+}
+
+static inline mu_vf64 mu_v_exp_unchecked(mu_vf64 x) {
+  return mu_v_exp_kernel(x, mu_v_dup(0.0));
+}
+
+/* exp(x + xtail) for |xtail| <= ulp(x), with the special cases of exp(x). */
+static inline mu_vf64 mu_v_exp_tail(mu_vf64 x, mu_vf64 xtail) {
+  mu_vi64 nan = mu_v_isnan(x);
+  mu_vi64 over = x > MU_EXP_OVERFLOW;
+  mu_vi64 under = x < MU_EXP_UNDERFLOW;
+  mu_vi64 special = nan | over | under;
+  mu_vf64 xs = mu_v_select(special, mu_v_dup(0.0), x);
+  mu_vf64 ts = mu_v_select(special, mu_v_dup(0.0), xtail);
+
+  mu_vf64 res = mu_v_exp_kernel(xs, ts);
+
+  res = mu_v_select(over, mu_v_dup(MU_INF), res);
+  res = mu_v_select(under, mu_v_dup(0.0), res);
+  return mu_v_select(nan, mu_v_dup(MU_NAN), res);
+}
+
+static inline mu_vf64 mu_v_exp(mu_vf64 x) {
+  return mu_v_exp_tail(x, mu_v_dup(0.0));
+}
+
+/* Vector form of mu_exp2_d(). */
+static inline mu_vf64 mu_v_exp2(mu_vf64 x) {
+  mu_vi64 nan = mu_v_isnan(x);
+  mu_vi64 over = x > MU_EXP2_OVERFLOW;
+  mu_vi64 under = x < MU_EXP2_UNDERFLOW;
+  mu_vf64 xs = mu_v_select(nan | over | under, mu_v_dup(0.0), x);
+
+  mu_vf64 t = xs * MU_EXP_N + MU_ROUND_SHIFT;
+  mu_vf64 kd = t - MU_ROUND_SHIFT;
+  mu_vi64 ki = (mu_vi64)t - (long long)mu_as_u64(MU_ROUND_SHIFT);
+  mu_vf64 tail, s1, s2;
+  mu_vf64 thi = mu_v_exp_reduced(
+      ki, (xs - kd * (1.0 / MU_EXP_N)) * MU_EXP2_LN2, &tail, &s1, &s2);
+  mu_vf64 res = (thi + tail) * s1 * s2;
+
+  res = mu_v_select(over, mu_v_dup(MU_INF), res);
+  res = mu_v_select(under, mu_v_dup(0.0), res);
+  return mu_v_select(nan, mu_v_dup(MU_NAN), res);
+}
+
+/* Vector form of mu_expm1_d(). */
+static inline mu_vf64 mu_v_expm1(mu_vf64 x) {
+  mu_vi64 keep = (mu_v_abs(x) < MU_EXPM1_TINY) | mu_v_isnan(x);
+  mu_vi64 over = x > MU_EXP_OVERFLOW;
+  mu_vi64 under = x < MU_EXP_UNDERFLOW;
+  mu_vf64 xs = mu_v_select(keep | over | under, mu_v_dup(0.0), x);
+
+  mu_vf64 tail, s1, s2;
+  mu_vf64 thi = mu_v_exp_parts(xs, mu_v_dup(0.0), &tail, &s1, &s2);
+  mu_vf64 res = mu_v_expm1_parts(xs, thi, tail, s1, s2);
+
+  res = mu_v_select(over, mu_v_dup(MU_INF), res);
+  res = mu_v_select(under, mu_v_dup(-1.0), res);
+  return mu_v_select(keep, x, res);
+}
+
+/* Vector form of mu_log1p_near0_tail(). */
+static inline mu_vf64 mu_v_log1p_near0_tail(mu_vf64 f) {
+  mu_vf64 s = f / (2.0 + f);
+  mu_vf64 s2 = s * s;
+  mu_vf64 q =
+      s2 * (MU_LOG_S1 + s2 * (MU_LOG_S2 + s2 * (MU_LOG_S3 + s2 * MU_LOG_S4)));
+  return -(s * (f - q));
+}
+
+static inline mu_vf64 mu_v_log1p_near0(mu_vf64 f) {
+  return f + mu_v_log1p_near0_tail(f);
+}
+
+/*
+ * Vector form of mu_log_sum_kernel(). The near-1 path is evaluated only when
+ * some lane needs it.
+ */
+static inline mu_vf64 mu_v_log_sum_kernel(mu_vf64 x, mu_vf64 c) {
+  mu_vi64 subnormal = x < 0x1p-1022;
+  mu_vf64 xs = mu_v_select(subnormal, x * 0x1p52, x);
+
+  mu_vi64 ix = (mu_vi64)xs;
+  mu_vi64 tmp = ix - (long long)MU_LOG_OFF;
+  mu_vi64 idx = ((tmp >> (52 - MU_LOG_TABLE_BITS)) & (MU_LOG_N - 1)) * 4;
+  mu_vi64 k = (tmp >> 52) - (subnormal & 52);
+  mu_vf64 kd = (mu_vf64)(k + 0x4338000000000000LL) - MU_ROUND_SHIFT;
+  mu_vf64 z = (mu_vf64)(ix - (tmp & (long long)0xfff0000000000000ULL));
+
+  mu_vf64 r = (z - mu_v_gather(mu_log_table + 1, idx)) *
+              mu_v_gather(mu_log_table, idx);
+  mu_vf64 lo_w;
+  mu_vf64 w =
+      mu_v_two_sum(kd * MU_LN2_HI, mu_v_gather(mu_log_table + 2, idx), &lo_w);
+  mu_vf64 hi = w + r;
+  mu_vf64 lo = ((w - hi) + r) + lo_w;
+  mu_vf64 p = r * r *
+              (MU_LOG_C2 +
+               r * (MU_LOG_C3 +
+                    r * (MU_LOG_C4 +
+                         r * (MU_LOG_C5 + r * (MU_LOG_C6 + r * MU_LOG_C7)))));
+  mu_vf64 res =
+      hi + (lo + (kd * MU_LN2_LO + mu_v_gather(mu_log_table + 3, idx) + c) + p);
+
+  mu_vi64 near1 = (x >= 0x1.fp-1) & (x < 0x1.08p+0);
+  if (mu_v_any(near1)) {
+    res = mu_v_select(near1, mu_v_log1p_near0(x - 1.0) + c, res);
+  }
+
+  return res;
+}
+
+static inline mu_vf64 mu_v_log_kernel(mu_vf64 x) {
+  return mu_v_log_sum_kernel(x, mu_v_dup(-0.0));
+}
+
+static inline mu_vf64 mu_v_log(mu_vf64 x) {
+  mu_vi64 zero = x == 0.0;
+  mu_vi64 invalid = (x < 0.0) | mu_v_isnan(x);
+  mu_vi64 inf = x == MU_INF;
+  mu_vf64 res =
+      mu_v_log_kernel(mu_v_select(zero | invalid | inf, mu_v_dup(1.0), x));
+
+  res = mu_v_select(inf, mu_v_dup(MU_INF), res);
+  res = mu_v_select(zero, mu_v_dup(-MU_INF), res);
+  return mu_v_select(invalid, mu_v_dup(MU_NAN), res);
+}
+
+/* Vector form of mu_log1p_kernel(). */
+static inline mu_vf64 mu_v_log1p_kernel(mu_vf64 x) {
+  mu_vf64 u = 1.0 + x;
+  mu_vf64 res = mu_v_log_sum_kernel(u, (x - (u - 1.0)) / u);
+
+  mu_vi64 small = mu_v_abs(x) < 0x1p-5;
+  if (mu_v_any(small)) {
+    res = mu_v_select(small, mu_v_log1p_near0(x), res);
+  }
+  return res;
+}
+
+/* Positive normal finite lanes, which mu_v_log() passes to the kernel. */
+static inline mu_vi64 mu_v_log_clean(mu_vf64 x) {
+  return ((mu_vi64)x >= 0x0010000000000000LL) &
+         ((mu_vi64)x < 0x7ff0000000000000LL);
+}
+
+/* Vector form of mu_log1p_d(). */
+static inline mu_vf64 mu_v_log1p(mu_vf64 x) {
+  mu_vi64 pole = x == -1.0;
+  mu_vi64 invalid = ~(x >= -1.0);
+  mu_vi64 inf = x == MU_INF;
+  mu_vf64 res =
+      mu_v_log1p_kernel(mu_v_select(pole | invalid | inf, mu_v_dup(0.0), x));
+
+  res = mu_v_select(inf, mu_v_dup(MU_INF), res);
+  res = mu_v_select(pole, mu_v_dup(-MU_INF), res);
+  return mu_v_select(invalid, mu_v_dup(MU_NAN), res);
+}
+
+/*
+ * Vector form of mu_log_base_kernel(). The near-1 path is evaluated only when
+ * some lane needs it.
+ */
+static inline mu_vf64 mu_v_log_base_kernel(mu_vf64 x, double l2hi,
+                                           double l2lo, double ihi,
+                                           double ilo) {
+  mu_vi64 subnormal = x < 0x1p-1022;
+  mu_vf64 xs = mu_v_select(subnormal, x * 0x1p52, x);
+
+  mu_vi64 ix = (mu_vi64)xs;
+  mu_vi64 tmp = ix - (long long)MU_LOG_OFF;
+  mu_vi64 idx = ((tmp >> (52 - MU_LOG_TABLE_BITS)) & (MU_LOG_N - 1)) * 4;
+  mu_vi64 k = (tmp >> 52) - (subnormal & 52);
+  mu_vf64 kd = (mu_vf64)(k + 0x4338000000000000LL) - MU_ROUND_SHIFT;
+  mu_vf64 z = (mu_vf64)(ix - (tmp & (long long)0xfff0000000000000ULL));
+
+  mu_vf64 r = (z - mu_v_gather(mu_log_table + 1, idx)) *
+              mu_v_gather(mu_log_table, idx);
+  mu_vf64 lo_u;
+  mu_vf64 u = mu_v_two_sum(mu_v_gather(mu_log_table + 2, idx), r, &lo_u);
+  mu_vf64 p = r * r *
+              (MU_LOG_C2 +
+               r * (MU_LOG_C3 +
+                    r * (MU_LOG_C4 +
+                         r * (MU_LOG_C5 + r * (MU_LOG_C6 + r * MU_LOG_C7)))));
+  mu_vf64 e;
+  mu_vf64 hi = mu_v_two_prod(u, mu_v_dup(ihi), &e);
+  mu_vf64 lo_s;
+  mu_vf64 s = mu_v_two_sum(kd * l2hi, hi, &lo_s);
+  mu_vf64 res =
+      s + (lo_s + e +
+           (kd * l2lo + u * ilo +
+            (lo_u + mu_v_gather(mu_log_table + 3, idx) + p) * ihi));
+
+  mu_vi64 near1 = (x >= 0x1.fp-1) & (x < 0x1.08p+0);
+  if (mu_v_any(near1)) {
+    mu_vf64 f = x - 1.0;
+    hi = mu_v_two_prod(f, mu_v_dup(ihi), &e);
+    res = mu_v_select(near1,
+                      hi + (e + (f * ilo + mu_v_log1p_near0_tail(f) * ihi)),
+                      res);
+  }
+
+  return res;
+}
+
+static inline mu_vf64 mu_v_log2_kernel(mu_vf64 x) {
+  return mu_v_log_base_kernel(x, 1.0, 0.0, MU_INV_LN2_HI, MU_INV_LN2_LO);
+}
+
+static inline mu_vf64 mu_v_log10_kernel(mu_vf64 x) {
+  return mu_v_log_base_kernel(x, MU_LOG10_2_HI, MU_LOG10_2_LO, MU_INV_LN10_HI,
+                              MU_INV_LN10_LO);
+}
+
+/* mu_v_log_base_kernel() with the special cases of mu_v_log(). */
+static inline mu_vf64 mu_v_log_base(mu_vf64 x, double l2hi, double l2lo,
+                                    double ihi, double ilo) {
+  mu_vi64 zero = x == 0.0;
+  mu_vi64 invalid = (x < 0.0) | mu_v_isnan(x);
+  mu_vi64 inf = x == MU_INF;
+  mu_vf64 res = mu_v_log_base_kernel(
+      mu_v_select(zero | invalid | inf, mu_v_dup(1.0), x), l2hi, l2lo, ihi,
+      ilo);
+
+  res = mu_v_select(inf, mu_v_dup(MU_INF), res);
+  res = mu_v_select(zero, mu_v_dup(-MU_INF), res);
+  return mu_v_select(invalid, mu_v_dup(MU_NAN), res);
+}
+
+static inline mu_vf64 mu_v_log2(mu_vf64 x) {
+  return mu_v_log_base(x, 1.0, 0.0, MU_INV_LN2_HI, MU_INV_LN2_LO);
+}
+
+static inline mu_vf64 mu_v_log10(mu_vf64 x) {
+  return mu_v_log_base(x, MU_LOG10_2_HI, MU_LOG10_2_LO, MU_INV_LN10_HI,
+                       MU_INV_LN10_LO);
+}
+
+/*
+ * Vector form of mu_log_dd() for positive finite lanes.
+ */
+static inline mu_vf64 mu_v_log_dd(mu_vf64 x, mu_vf64 *lo) {
+  mu_vi64 subnormal = x < 0x1p-1022;
+  mu_vf64 xs = mu_v_select(subnormal, x * 0x1p52, x);
+
+  mu_vi64 ix = (mu_vi64)xs;
+  mu_vi64 tmp = ix - (long long)MU_LOG_OFF;
+  mu_vi64 i = (tmp >> (52 - MU_LOG_TABLE_BITS)) & (MU_LOG_N - 1);
+  mu_vi64 k = (tmp >> 52) - (subnormal & 52);
+  mu_vf64 kd = (mu_vf64)(k + 0x4338000000000000LL) - MU_ROUND_SHIFT;
+  mu_vf64 z = (mu_vf64)(ix - (tmp & (long long)0xfff0000000000000ULL));
+
+  mu_vi64 one = (i == MU_LOG_ONE_IDX) | (i == MU_LOG_ONE_IDX - 1);
+  mu_vf64 zero = mu_v_dup(0.0);
+  mu_vi64 idx = i * 4;
+  mu_vf64 unit = mu_v_dup(1.0);
+  mu_vf64 invc = mu_v_select(one, unit, mu_v_gather(mu_log_table, idx));
+  mu_vf64 c = mu_v_select(one, unit, mu_v_gather(mu_log_table + 1, idx));
+  mu_vf64 logc_hi = mu_v_select(one, zero, mu_v_gather(mu_log_table + 2, idx));
+  mu_vf64 logc_lo = mu_v_select(one, zero, mu_v_gather(mu_log_table + 3, idx));
+
+  mu_vf64 d = z - c;
+  mu_vf64 e;
+  mu_vf64 uh = d * invc;
+  mu_vf64 ul = ((d - mu_v_two_prod(uh, c, &e)) - e) * invc;
+
+  mu_vf64 s_lo;
+  mu_vf64 s = mu_v_two_prod(uh, uh, &s_lo);
+  mu_vf64 q = uh * s *
+              (MU_LOG_DD_C3 +
+               uh * (MU_LOG_DD_C4 +
+                     uh * (MU_LOG_DD_C5 +
+                           uh * (MU_LOG_DD_C6 +
+                                 uh * (MU_LOG_DD_C7 +
+                                       uh * (MU_LOG_DD_C8 +
+                                             uh * (MU_LOG_DD_C9 +
+                                                   uh * MU_LOG_DD_C10)))))));
+
+  mu_vf64 w_lo, l1, l2;
+  mu_vf64 w = mu_v_two_sum(kd * MU_LN2_HI, logc_hi, &w_lo);
+  mu_vf64 h = mu_v_two_sum(w, uh, &l1);
+  h = mu_v_two_sum(h, -0.5 * s, &l2);
+  mu_vf64 l = (l1 + l2) + (w_lo + kd * MU_LN2_LO + logc_lo) +
+              (ul - 0.5 * s_lo - uh * ul + s * ul) + q;
+
+  mu_vf64 hi = h + l;
+  *lo = (h - hi) + l;
+  return hi;
+}
+
+/* Vector form of mu_pow_core(). */
+static inline mu_vf64 mu_v_pow_core(mu_vf64 hi, mu_vf64 lo, mu_vf64 y) {
+  mu_vf64 p = y * hi;
+  mu_vi64 nan = mu_v_isnan(p);
+  mu_vi64 over = p > MU_EXP_OVERFLOW;
+  mu_vi64 under = p < MU_EXP_UNDERFLOW;
+  mu_vf64 ys = mu_v_select(nan | over | under, mu_v_dup(0.0), y);
+
+  mu_vf64 p_lo;
+  p = mu_v_two_prod(ys, hi, &p_lo);
+  mu_vf64 res = mu_v_exp_kernel(p, p_lo + ys * lo);
+
+  res = mu_v_select(over, mu_v_dup(MU_INF), res);
+  res = mu_v_select(under, mu_v_dup(0.0), res);
+  return mu_v_select(nan, mu_v_dup(MU_NAN), res);
+}
+
+/* Vector form of mu_exp10_d(). */
+static inline mu_vf64 mu_v_exp10(mu_vf64 x) {
+  return mu_v_pow_core(mu_v_dup(MU_LN10_HI), mu_v_dup(MU_LN10_LO), x);
+}
+
+/*
+ * Lane masks of mu_pow_int_class(): `nonint` for non-integral or non-finite
+ * `y`, `odd` for odd integers.
+ */
+static inline void mu_v_pow_class(mu_vf64 y, mu_vi64 *nonint, mu_vi64 *odd) {
+  mu_vi64 is_int = (mu_v_trunc(y) == y) & ~mu_v_isinf(y);
+  *nonint = ~is_int;
+  *odd = is_int & (mu_v_abs(y) < 0x1p53) & (2.0 * mu_v_trunc(y * 0.5) != y);
+}
+
+/*
+ * Vector form of mu_pow_kernel(), with the class of `y` given as lane masks.
+ * Every special case becomes a mask, applied in reverse order of precedence.
+ */
+static inline mu_vf64 mu_v_pow_masked(mu_vf64 x, mu_vf64 y, mu_vi64 nonint,
+                                      mu_vi64 odd) {
+  mu_vf64 inf = mu_v_dup(MU_INF);
+  mu_vf64 zero = mu_v_dup(0.0);
+  mu_vf64 one = mu_v_dup(1.0);
+  mu_vf64 ax = mu_v_abs(x);
+  mu_vi64 yinf = mu_v_isinf(y);
+  mu_vi64 nan = mu_v_isnan(x) | mu_v_isnan(y);
+  mu_vi64 x_zero = ax == 0.0;
+  mu_vi64 x_inf = ax == MU_INF;
+  mu_vi64 x_one = ax == 1.0;
+  mu_vi64 special = nan | yinf | x_zero | x_inf | x_one;
+  mu_vf64 sign = mu_v_select(((mu_vi64)x < 0) & odd, -one, one);
+
+  mu_vf64 lo;
+  mu_vf64 hi = mu_v_log_dd(mu_v_select(special, mu_v_dup(2.0), ax), &lo);
+  mu_vf64 res = sign * mu_v_pow_core(hi, lo, mu_v_select(special, zero, y));
+
+  res = mu_v_select(x_zero, sign * mu_v_select(y < 0.0, inf, zero), res);
+  res = mu_v_select(x_inf, sign * mu_v_select(y < 0.0, zero, inf), res);
+  res = mu_v_select(yinf, mu_v_select((ax < 1.0) == (y < 0.0), inf, zero),
+                    res);
+  res = mu_v_select(x_one, mu_v_select(yinf, one, sign), res);
+  res = mu_v_select(((mu_vi64)x < 0) & nonint & ~yinf & ~x_zero & ~x_inf,
+                    mu_v_dup(MU_NAN), res);
+  res = mu_v_select(nan, x + y, res);
+
+  /* The exact reciprocal of mu_pow_kernel() for y == -1. */
+  mu_vi64 recip = y == -1.0;
+  if (mu_v_any(recip)) {
+    res = mu_v_select(recip, 1.0 / x, res);
+  }
+  return mu_v_select((y == 0.0) | (x == 1.0), one, res);
+}
+
+static inline mu_vf64 mu_v_pow(mu_vf64 x, mu_vf64 y) {
+  mu_vi64 nonint, odd;
+  mu_v_pow_class(y, &nonint, &odd);
+  return mu_v_pow_masked(x, y, nonint, odd);
+}
+
+/*
+ * Vector form of mu_pow_apply(). Base plans skip the logarithm and exponent
+ * plans pass their precomputed class as uniform masks.
+ */
+static inline mu_vf64 mu_v_pow_apply(const mu_pow_plan *plan, mu_vf64 x) {
+  mu_vf64 fixed = mu_v_dup(plan->value);
+  if (plan->kind == MU_POW_PLAN_EXP) {
+    mu_vi64 none = {0};
+    return mu_v_pow_masked(x, fixed, none - (plan->cls == MU_POW_NONINT),
+                           none - (plan->cls == MU_POW_ODD));
+  }
+  if (plan->kind == MU_POW_PLAN_GENERIC) {
+    return mu_v_pow(fixed, x);
+  }
+
+  mu_vf64 res =
+      mu_v_pow_core(mu_v_dup(plan->log_hi), mu_v_dup(plan->log_lo), x);
+  if (plan->value < 0) {
+    mu_vi64 nonint, odd;
+    mu_v_pow_class(x, &nonint, &odd);
+    res = mu_v_select(odd, -res, res);
+    res = mu_v_select(nonint & ~mu_v_isinf(x), mu_v_dup(MU_NAN), res);
+  }
+  return mu_v_select(x == -1.0, mu_v_dup(1.0 / plan->value), res);
+}
+
+/*
+ * Vector forms of the hyperbolic functions. Each lane takes one evaluation of
+ * the exponential or the logarithm, with its argument picked from the forms of
+ * the scalar function that apply to it.
+ */
+
+/* Vector form of mu_sinh_small(). */
+static inline mu_vf64 mu_v_sinh_small(mu_vf64 x) {
+  mu_vf64 z = x * x;
+  mu_vf64 q =
+      MU_SINH_C11 +
+      z * (MU_SINH_C13 +
+           z * (MU_SINH_C15 +
+                z * (MU_SINH_C17 + z * (MU_SINH_C19 + z * MU_SINH_C21))));
+  mu_vf64 p = MU_SINH_C3 +
+              z * (MU_SINH_C5 + z * (MU_SINH_C7 + z * (MU_SINH_C9 + z * q)));
+  return x + x * z * p;
+}
+
+/*
+ * The parts of e^a for 0 <= a <= MU_HYP_OVERFLOW: of e^(a - ln2) from
+ * MU_HYP_BIG on, where only e^a / 2 is needed.
+ */
+static inline mu_vf64 mu_v_hyp_parts(mu_vf64 a, mu_vi64 big, mu_vf64 *tail,
+                                     mu_vf64 *s1, mu_vf64 *s2) {
+  mu_vf64 e;
+  mu_vf64 half = mu_v_two_sum(a, mu_v_dup(-MU_LN2_HI), &e);
+  return mu_v_exp_parts(mu_v_select(big, half, a),
+                        mu_v_select(big, e - MU_LN2_LO, mu_v_dup(0.0)), tail,
+                        s1, s2);
+}
+
+/* sinh and cosh of |x| for lanes that are neither tiny nor special. */
+static inline void mu_v_sinhcosh_abs(mu_vf64 a, mu_vf64 *s, mu_vf64 *c) {
+  mu_vi64 big = a >= MU_HYP_BIG;
+  mu_vf64 tail, s1, s2;
+  mu_vf64 thi = mu_v_hyp_parts(a, big, &tail, &s1, &s2);
+  mu_vf64 half = (thi + tail) * s1 * s2;
+  mu_vf64 e = mu_v_expm1_parts(a, thi, tail, s1, s2);
+
+  mu_vf64 lo;
+  mu_vf64 t = mu_v_two_sum(e, mu_v_dup(1.0), &lo);
+  *s = mu_v_select(big, half, 0.5 * (e + e / (e + 1.0)));
+  *c = mu_v_select(a < MU_COSH_SMALL, 1.0 + e * e / (2.0 * (1.0 + e)),
+                   0.5 * t + (0.5 * lo + 0.5 / t));
+  *c = mu_v_select(big, half, *c);
+}
+
+static inline void mu_v_sinhcosh(mu_vf64 x, mu_vf64 *s, mu_vf64 *c) {
+  mu_vf64 a = mu_v_abs(x);
+  mu_vi64 tiny = a < MU_HYP_TINY;
+  mu_vi64 nan = mu_v_isnan(x);
+  mu_vi64 over = a > MU_HYP_OVERFLOW;
+  mu_vf64 sa, ca;
+  mu_v_sinhcosh_abs(mu_v_select(tiny | nan | over, mu_v_dup(1.0), a), &sa,
+                    &ca);
+
+  sa = mu_v_select(over, mu_v_dup(MU_INF), sa);
+  *s = mu_v_select(tiny | nan, x, mu_v_copysign(sa, x));
+  mu_vi64 small = a < 1.0;
+  if (mu_v_any(small)) {
+    *s = mu_v_select(small, mu_v_sinh_small(x), *s);
+  }
+  ca = mu_v_select(tiny, mu_v_dup(1.0), ca);
+  ca = mu_v_select(over, mu_v_dup(MU_INF), ca);
+  *c = mu_v_select(nan, mu_v_dup(MU_NAN), ca);
+}
+
+static inline mu_vf64 mu_v_sinh(mu_vf64 x) {
+  mu_vf64 s, c;
+  mu_v_sinhcosh(x, &s, &c);
+  return s;
+}
+
+static inline mu_vf64 mu_v_cosh(mu_vf64 x) {
+  mu_vf64 s, c;
+  mu_v_sinhcosh(x, &s, &c);
+  return c;
+}
+
+static inline mu_vf64 mu_v_tanh(mu_vf64 x) {
+  mu_vf64 a = mu_v_abs(x);
+  mu_vi64 small = a < 1.0;
+  mu_vf64 arg = 2.0 * mu_v_select(a < MU_HYP_BIG, a, mu_v_dup(MU_HYP_BIG));
+  arg = mu_v_select(small, -arg, arg);
+
+  mu_vf64 tail, s1, s2;
+  mu_vf64 thi = mu_v_exp_parts(arg, mu_v_dup(0.0), &tail, &s1, &s2);
+  mu_vf64 e = mu_v_expm1_parts(arg, thi, tail, s1, s2);
+  mu_vf64 res = mu_v_select(small, -e / (e + 2.0), 1.0 - 2.0 / (e + 2.0));
+
+  res = mu_v_select(a < MU_HYP_BIG, res, mu_v_dup(1.0));
+  return mu_v_select((a < MU_HYP_TINY) | mu_v_isnan(x), x,
+                     mu_v_copysign(res, x));
+}
+
+/*
+ * The logarithm of the inverse functions in one evaluation of the log kernel:
+ * log1p(y) on lanes outside `mid`, log(z) on `mid` lanes and log(z) + ln2 on
+ * `huge` lanes, which are all `mid`. Each lane follows the scalar function.
+ */
+static inline mu_vf64 mu_v_hyp_log(mu_vf64 z, mu_vf64 y, mu_vi64 mid,
+                                   mu_vi64 huge) {
+  mu_vf64 u1 = 1.0 + y;
+  mu_vf64 c = mu_v_select(mid, mu_v_dup(-0.0), (y - (u1 - 1.0)) / u1);
+  c = mu_v_select(huge, mu_v_dup(MU_LN2_LO), c);
+  mu_vf64 res = mu_v_log_sum_kernel(mu_v_select(mid, z, u1), c) +
+                mu_v_select(huge, mu_v_dup(MU_LN2_HI), mu_v_dup(-0.0));
+
+  mu_vi64 near = ~mid & (mu_v_abs(y) < 0x1p-5);
+  if (mu_v_any(near)) {
+    res = mu_v_select(near, mu_v_log1p_near0(y), res);
+  }
+  return res;
+}
+
+static inline mu_vf64 mu_v_asinh(mu_vf64 x) {
+  mu_vf64 a = mu_v_abs(x);
+  mu_vi64 keep = (a < MU_HYP_TINY) | ~(a < MU_INF);
+  a = mu_v_select(keep, mu_v_dup(1.0), a);
+  mu_vi64 huge = a > 0x1p28;
+
+  mu_vf64 t = a * a;
+  mu_vf64 y = a + t / (1.0 + mu_v_sqrt(1.0 + t));
+  mu_vf64 z = 2.0 * a + 1.0 / (mu_v_sqrt(t + 1.0) + a);
+  mu_vf64 res = mu_v_hyp_log(mu_v_select(huge, a, z), y, a > 2.0, huge);
+
+  return mu_v_select(keep, x, mu_v_copysign(res, x));
+}
+
+static inline mu_vf64 mu_v_acosh(mu_vf64 x) {
+  mu_vi64 invalid = ~(x >= 1.0);
+  mu_vi64 inf = x == MU_INF;
+  mu_vf64 a = mu_v_select(invalid | inf, mu_v_dup(1.0), x);
+  mu_vi64 huge = a > 0x1p28;
+
+  mu_vf64 t = a - 1.0;
+  mu_vf64 y = t + mu_v_sqrt(2.0 * t + t * t);
+  mu_vf64 z = 2.0 * a - 1.0 / (a + mu_v_sqrt(a * a - 1.0));
+  mu_vf64 res = mu_v_hyp_log(mu_v_select(huge, a, z), y, a > 2.0, huge);
+
+  res = mu_v_select(inf, mu_v_dup(MU_INF), res);
+  return mu_v_select(invalid, mu_v_dup(MU_NAN), res);
+}
+
+static inline mu_vf64 mu_v_atanh(mu_vf64 x) {
+  mu_vf64 a = mu_v_abs(x);
+  mu_vi64 keep = a < MU_HYP_TINY;
+  mu_vi64 edge = ~(a < 1.0);
+  a = mu_v_select(keep | edge, mu_v_dup(0.5), a);
+
+  mu_vf64 t = a + a;
+  mu_vf64 y = mu_v_select(a < 0.5, t + t * a / (1.0 - a), t / (1.0 - a));
+  mu_vf64 res = mu_v_copysign(0.5 * mu_v_log1p_kernel(y), x);
+
+  mu_vf64 pole = mu_v_select(mu_v_abs(x) == 1.0, mu_v_dup(MU_INF),
+                             mu_v_dup(MU_NAN));
+  res = mu_v_select(edge, mu_v_copysign(pole, x), res);
+  return mu_v_select(keep, x, res);
+}
+
+/*
+ * Single-precision kernels, on twice as many lanes as the double ones. The
+ * bodies mirror the scalar mu_*f_kernel() functions.
+ */
+static inline mu_vf32 mu_vf_trunc(mu_vf32 x) {
+#if defined(MU_VF_ROUND)
+  return MU_VF_ROUND(x, _MM_FROUND_TO_ZERO);
+#else
+  mu_vf32 ax = mu_vf_abs(x);
+  mu_vi32 keep = (ax >= MU_TWO23F) | mu_vf_isnan(x);
+  mu_vf32 t = (ax + MU_TWO23F) - MU_TWO23F;
+  t = mu_vf_select(t > ax, t - 1.0f, t);
+  return mu_vf_select(keep, x, mu_vf_copysign(t, x));
+#endif
+}
+
+static inline mu_vf32 mu_vf_floor(mu_vf32 x) {
+#if defined(MU_VF_ROUND)
+  return MU_VF_ROUND(x, _MM_FROUND_TO_NEG_INF);
+#else
+  mu_vf32 t = mu_vf_trunc(x);
+  return mu_vf_select(t > x, t - 1.0f, t);
+#endif
+}
+
+static inline mu_vf32 mu_vf_ceil(mu_vf32 x) {
+#if defined(MU_VF_ROUND)
+  return MU_VF_ROUND(x, _MM_FROUND_TO_POS_INF);
+#else
+  mu_vf32 t = mu_vf_trunc(x);
+  return mu_vf_select(t < x, t + 1.0f, t);
+#endif
+}
+
+static inline mu_vf32 mu_vf_round(mu_vf32 x) {
+  mu_vf32 t = mu_vf_trunc(x);
+  mu_vf32 half = mu_vf_select(mu_vf_abs(x - t) >= 0.5f, mu_vf_dup(1.0f),
+                               mu_vf_dup(0.0f));
+  return t + mu_vf_copysign(half, x);
+}
+
+static inline mu_vf32 mu_vf_nearbyint(mu_vf32 x) {
+#if defined(MU_VF_ROUND)
+  return MU_VF_ROUND(x, _MM_FROUND_CUR_DIRECTION);
+#else
+  mu_vf32 shift = mu_vf_copysign(mu_vf_dup(MU_TWO23F), x);
+  mu_vf32 r = mu_vf_copysign((x + shift) - shift, x);
+  return mu_vf_select(mu_vf_abs(x) < MU_TWO23F, r, x);
+#endif
+}
+
+static inline mu_vf32 mu_vf_modf(mu_vf32 x, mu_vf32 *ipart) {
+  *ipart = mu_vf_trunc(x);
+  mu_vf32 frac = mu_vf_select(mu_vf_isinf(x), mu_vf_dup(0.0f), x - *ipart);
+  return mu_vf_copysign(frac, x);
+}
+
+/* Runs in double, where the float remainder is exact. */
+static inline mu_vf32 mu_vf_fmod(mu_vf32 x, mu_vf32 y) {
+  mu_vf64 xl, xh, yl, yh;
+  mu_vf_widen(x, &xl, &xh);
+  mu_vf_widen(y, &yl, &yh);
+  return mu_vf_narrow(mu_v_fmod(xl, yl), mu_v_fmod(xh, yh));
+}
+
+static inline mu_vf32 mu_vf_remainder(mu_vf32 x, mu_vf32 y) {
+  mu_vf64 xl, xh, yl, yh;
+  mu_vf_widen(x, &xl, &xh);
+  mu_vf_widen(y, &yl, &yh);
+  return mu_vf_narrow(mu_v_remainder(xl, yl), mu_v_remainder(xh, yh));
+}
+
+/* Vector form of mu_rem_pio2_short(); `x` must be finite. */
+static inline mu_vi64 mu_v_rem_pio2_short(mu_vf64 x, mu_vf64 *r) {
+  mu_vi64 large = mu_v_abs(x) >= MU_PIO2_MEDIUM;
+  mu_vf64 xs = mu_v_select(large, mu_v_dup(0.0), x);
+  mu_vf64 t = xs * MU_INV_PIO2 + MU_ROUND_SHIFT;
+  mu_vf64 fn = t - MU_ROUND_SHIFT;
+  mu_vi64 n = (mu_vi64)t;
+  *r = ((xs - fn * MU_PIO2_1) - fn * MU_PIO2_2) - fn * MU_PIO2_3;
+
+  if (mu_v_any(large)) {
+    for (int i = 0; i < MU_VLEN; ++i) {
+      if (large[i]) {
+        double h, l;
+        n[i] = mu_rem_pio2_large(x[i], &h, &l);
+        (*r)[i] = h;
+      }
+    }
+  }
+
+  return n;
+}
+
+/* Vector form of mu_rem_pio2f(); `x` must be finite. */
+static inline mu_vi32 mu_vf_rem_pio2(mu_vf32 x, mu_vf32 *r) {
+  mu_vf64 lo, hi, rl, rh;
+  mu_vf_widen(x, &lo, &hi);
+  mu_vi64 nl = mu_v_rem_pio2_short(lo, &rl);
+  mu_vi64 nh = mu_v_rem_pio2_short(hi, &rh);
+  *r = mu_vf_narrow(rl, rh);
+  return mu_vf_narrow_int(nl, nh);
+}
+
+static inline mu_vf32 mu_vf_sin_kernel(mu_vf32 x) {
+  mu_vf32 z = x * x;
+  mu_vf32 res = x + x * z * (MU_SINF_S1 + z * (MU_SINF_S2 + z * MU_SINF_S3));
+  return mu_vf_select(mu_vf_abs(x) < 0x1p-12f, x, res);
+}
+
+static inline mu_vf32 mu_vf_cos_kernel(mu_vf32 x) {
+  mu_vf32 z = x * x;
+  mu_vf32 r = z * z * (MU_COSF_C1 + z * (MU_COSF_C2 + z * MU_COSF_C3));
+  return (1.0f - 0.5f * z) + r;
+}
+
+static inline mu_vf32 mu_vf_sin(mu_vf32 x) {
+  mu_vi32 special = mu_vf_isnan(x) | mu_vf_isinf(x);
+  mu_vf32 r;
+  mu_vi32 n = mu_vf_rem_pio2(mu_vf_select(special, mu_vf_dup(0.0f), x), &r);
+
+  mu_vf32 res = mu_vf_select((n & 1) != 0, mu_vf_cos_kernel(r),
+                             mu_vf_sin_kernel(r));
+  res = mu_vf_select((n & 2) != 0, -res, res);
+
+  return mu_vf_select(special, mu_vf_dup(MU_NAN), res);
+}
+
+static inline mu_vf32 mu_vf_cos(mu_vf32 x) {
+  mu_vi32 special = mu_vf_isnan(x) | mu_vf_isinf(x);
+  mu_vf32 r;
+  mu_vi32 n = mu_vf_rem_pio2(mu_vf_select(special, mu_vf_dup(0.0f), x), &r);
+
+  mu_vf32 res = mu_vf_select((n & 1) != 0, mu_vf_sin_kernel(r),
+                             mu_vf_cos_kernel(r));
+  res = mu_vf_select(((n + 1) & 2) != 0, -res, res);
+
+  return mu_vf_select(special, mu_vf_dup(MU_NAN), res);
+}
+
+static inline void mu_vf_sincos(mu_vf32 x, mu_vf32 *s, mu_vf32 *c) {
+  mu_vi32 special = mu_vf_isnan(x) | mu_vf_isinf(x);
+  mu_vf32 r;
+  mu_vi32 n = mu_vf_rem_pio2(mu_vf_select(special, mu_vf_dup(0.0f), x), &r);
+
+  mu_vf32 sin_r = mu_vf_sin_kernel(r);
+  mu_vf32 cos_r = mu_vf_cos_kernel(r);
+  mu_vi32 odd = (n & 1) != 0;
+  mu_vf32 rs = mu_vf_select(odd, cos_r, sin_r);
+  mu_vf32 rc = mu_vf_select(odd, sin_r, cos_r);
+  rs = mu_vf_select((n & 2) != 0, -rs, rs);
+  rc = mu_vf_select(((n + 1) & 2) != 0, -rc, rc);
+
+  *s = mu_vf_select(special, mu_vf_dup(MU_NAN), rs);
+  *c = mu_vf_select(special, mu_vf_dup(MU_NAN), rc);
+}
+
+static inline mu_vf32 mu_vf_tan(mu_vf32 x) {
+  mu_vi32 special = mu_vf_isnan(x) | mu_vf_isinf(x);
+  mu_vf32 r;
+  mu_vi32 n = mu_vf_rem_pio2(mu_vf_select(special, mu_vf_dup(0.0f), x), &r);
+
+  mu_vf32 z = r * r;
+  mu_vf32 p =
+      MU_TANF_T0 +
+      z * (MU_TANF_T1 +
+           z * (MU_TANF_T2 +
+                z * (MU_TANF_T3 + z * (MU_TANF_T4 + z * MU_TANF_T5))));
+  mu_vf32 t = r + r * z * p;
+  mu_vf32 res = mu_vf_select((n & 1) != 0, -1.0f / t, t);
+
+  return mu_vf_select(special, mu_vf_dup(MU_NAN), res);
+}
+
+/* The π-scaled and degree forms run in double, like mu_sinpif(). */
+#define MU_VF_FROM_DOUBLE(name, kernel)                \
+  static inline mu_vf32 name(mu_vf32 x) {              \
+    mu_vf64 lo, hi;                                    \
+    mu_vf_widen(x, &lo, &hi);                          \
+    return mu_vf_narrow(kernel(lo), kernel(hi));       \
+  }
+
+#define MU_VF_SINCOS_FROM_DOUBLE(name, kernel)                  \
+  static inline void name(mu_vf32 x, mu_vf32 *s, mu_vf32 *c) {  \
+    mu_vf64 lo, hi, sl, sh, cl, ch;                             \
+    mu_vf_widen(x, &lo, &hi);                                   \
+    kernel(lo, &sl, &cl);                                       \
+    kernel(hi, &sh, &ch);                                       \
+    *s = mu_vf_narrow(sl, sh);                                  \
+    *c = mu_vf_narrow(cl, ch);                                  \
+  }
+
+MU_VF_FROM_DOUBLE(mu_vf_sinpi, mu_v_sinpi)
+MU_VF_FROM_DOUBLE(mu_vf_cospi, mu_v_cospi)
+MU_VF_SINCOS_FROM_DOUBLE(mu_vf_sincospi, mu_v_sincospi)
+MU_VF_FROM_DOUBLE(mu_vf_tanpi, mu_v_tanpi)
+MU_VF_FROM_DOUBLE(mu_vf_sind, mu_v_sind)
+MU_VF_FROM_DOUBLE(mu_vf_cosd, mu_v_cosd)
+MU_VF_SINCOS_FROM_DOUBLE(mu_vf_sincosd, mu_v_sincosd)
+
+/* The hyperbolic forms run in double too, like mu_sinhf(). */
+MU_VF_FROM_DOUBLE(mu_vf_sinh, mu_v_sinh)
+MU_VF_FROM_DOUBLE(mu_vf_cosh, mu_v_cosh)
+MU_VF_SINCOS_FROM_DOUBLE(mu_vf_sinhcosh, mu_v_sinhcosh)
+MU_VF_FROM_DOUBLE(mu_vf_tanh, mu_v_tanh)
+MU_VF_FROM_DOUBLE(mu_vf_asinh, mu_v_asinh)
+MU_VF_FROM_DOUBLE(mu_vf_acosh, mu_v_acosh)
+MU_VF_FROM_DOUBLE(mu_vf_atanh, mu_v_atanh)
+
+/* So do the other bases and the forms near zero, like mu_exp2f(). */
+MU_VF_FROM_DOUBLE(mu_vf_exp2, mu_v_exp2)
+MU_VF_FROM_DOUBLE(mu_vf_exp10, mu_v_exp10)
+MU_VF_FROM_DOUBLE(mu_vf_expm1, mu_v_expm1)
+MU_VF_FROM_DOUBLE(mu_vf_log2, mu_v_log2)
+MU_VF_FROM_DOUBLE(mu_vf_log10, mu_v_log10)
+MU_VF_FROM_DOUBLE(mu_vf_log1p, mu_v_log1p)
+
+static inline mu_vf32 mu_vf_asin_r(mu_vf32 s, mu_vf32 z) {
+  mu_vf32 p =
+      MU_ASINF_P0 +
+      z * (MU_ASINF_P1 +
+           z * (MU_ASINF_P2 + z * (MU_ASINF_P3 + z * MU_ASINF_P4)));
+  return s + s * z * p;
+}
+
+/* Lanes with |x| > 1 or NaN fall out of the square root as NaN. */
+static inline mu_vf32 mu_vf_asin(mu_vf32 x) {
+  mu_vf32 ax = mu_vf_abs(x);
+  mu_vi32 small = ax < 0.5f;
+  mu_vf32 z = mu_vf_select(small, ax * ax, (1.0f - ax) * 0.5f);
+  mu_vf32 s = mu_vf_select(small, ax, mu_vf_sqrt(z));
+  mu_vf32 r = mu_vf_asin_r(s, z) - s;
+
+  mu_vf32 w = (mu_vf32)((mu_vi32)s & (int)0xfffff000U);
+  mu_vf32 c = (z - w * w) / (s + w);
+  mu_vf32 p = 2.0f * r - (MU_PIO2F_LO - 2.0f * c);
+  mu_vf32 mid = MU_PIO4F_HI - (p - (MU_PIO4F_HI - 2.0f * w));
+  mu_vf32 near1 = MU_PIO2F_HI - (2.0f * (s + r) - MU_PIO2F_LO);
+
+  mu_vf32 res = mu_vf_select(ax < (float)MU_ASIN_NEAR1, mid, near1);
+  return mu_vf_copysign(mu_vf_select(small, s + r, res), x);
+}
+
+static inline mu_vf32 mu_vf_acos(mu_vf32 x) {
+  mu_vf32 ax = mu_vf_abs(x);
+  mu_vi32 small = ax < 0.5f;
+  mu_vf32 z = mu_vf_select(small, ax * ax, (1.0f - ax) * 0.5f);
+  mu_vf32 s = mu_vf_select(small, ax, mu_vf_sqrt(z));
+  mu_vf32 r = mu_vf_asin_r(s, z);
+
+  mu_vf32 mid = MU_PIO2F_HI - (mu_vf_copysign(r, x) - MU_PIO2F_LO);
+  mu_vf32 res =
+      mu_vf_select(x < 0.0f, MU_PIF_HI - (2.0f * r - MU_PIF_LO), 2.0f * r);
+  return mu_vf_select(small, mid, res);
+}
+
+static inline mu_vf32 mu_vf_sqrt_checked(mu_vf32 x) {
+  mu_vi32 invalid = (x < 0.0f) | mu_vf_isnan(x) | mu_vf_isinf(x);
+  return mu_vf_select(invalid, mu_vf_dup(MU_NAN), mu_vf_sqrt(x));
+}
+
+static inline mu_vf32 mu_vf_rsqrt(mu_vf32 x) { return 1.0f / mu_vf_sqrt(x); }
+
+/*
+ * Vector form of mu_atanf_kernel(), with the reduction selected per lane as a
+ * numerator/denominator pair.
+ */
+static inline mu_vf32 mu_vf_atan(mu_vf32 x) {
+  mu_vf32 ax = mu_vf_abs(x);
+  mu_vi32 mid = ax > MU_ATANF_B0;
+  mu_vi32 big = ax > MU_ATANF_B1;
+
+  mu_vf32 num = mu_vf_select(mid, ax - 1.0f, ax);
+  mu_vf32 den = mu_vf_select(mid, ax + 1.0f, mu_vf_dup(1.0f));
+  num = mu_vf_select(big, mu_vf_dup(-1.0f), num);
+  den = mu_vf_select(big, ax, den);
+  mu_vf32 hi = mu_vf_select(mid, mu_vf_dup(MU_PIO4F_HI), mu_vf_dup(0.0f));
+  mu_vf32 lo = mu_vf_select(mid, mu_vf_dup(MU_PIO4F_LO), mu_vf_dup(0.0f));
+  hi = mu_vf_select(big, mu_vf_dup(MU_PIO2F_HI), hi);
+  lo = mu_vf_select(big, mu_vf_dup(MU_PIO2F_LO), lo);
+
+  mu_vf32 t = num / den;
+  mu_vf32 z = t * t;
+  mu_vf32 p =
+      MU_ATANF_P0 + z * (MU_ATANF_P1 + z * (MU_ATANF_P2 + z * MU_ATANF_P3));
+  mu_vf32 res = hi + (t + (t * z * p + lo));
+  return mu_vf_select(mu_vf_isnan(x), x, mu_vf_copysign(res, x));
+}
+
+/* Vector form of mu_atan2f_kernel(). */
+static inline mu_vf32 mu_vf_atan2(mu_vf32 y, mu_vf32 x) {
+  mu_vf32 ax = mu_vf_abs(x);
+  mu_vf32 ay = mu_vf_abs(y);
+  mu_vf32 z = mu_vf_atan(ay / ax);
+
+  mu_vi32 both = (ax == ay) & ((ax == 0.0f) | mu_vf_isinf(ax));
+  z = mu_vf_select(both & (ax == 0.0f), mu_vf_dup(0.0f), z);
+  z = mu_vf_select(both & mu_vf_isinf(ax), mu_vf_dup(MU_PIO4F_HI), z);
+  z = mu_vf_select((mu_vi32)x < 0, MU_PIF_HI - (z - MU_PIF_LO), z);
+
+  mu_vf32 res = mu_vf_copysign(z, y);
+  res = mu_vf_select(ay > 0x1p26f * ax,
+                     mu_vf_copysign(mu_vf_dup(MU_PIO2F_HI), y), res);
+  return mu_vf_select(mu_vf_isnan(x) | mu_vf_isnan(y), x + y, res);
+}
+
+/* Vector form of mu_expf_kernel(). */
+static inline mu_vf32 mu_vf_exp(mu_vf32 x) {
+  mu_vi32 nan = mu_vf_isnan(x);
+  mu_vi32 over = x > MU_EXPF_OVERFLOW;
+  mu_vi32 under = x < MU_EXPF_UNDERFLOW;
+  mu_vf32 xs = mu_vf_select(nan | over | under, mu_vf_dup(0.0f), x);
+
+  mu_vf32 t = xs * MU_LOG2EF + MU_ROUND_SHIFTF;
+  mu_vf32 fn = t - MU_ROUND_SHIFTF;
+  mu_vi32 n = (mu_vi32)t - (int)mu_as_u32(MU_ROUND_SHIFTF);
+  mu_vf32 r = (xs - fn * MU_LN2F_HI) - fn * MU_LN2F_LO;
+
+  mu_vf32 p =
+      MU_EXPF_P0 +
+      r * (MU_EXPF_P1 +
+           r * (MU_EXPF_P2 +
+                r * (MU_EXPF_P3 + r * (MU_EXPF_P4 + r * MU_EXPF_P5))));
+  mu_vf32 res = 1.0f + (r + r * r * p);
+
+  mu_vi32 n1 = n >> 1;
+  res = res * (mu_vf32)((n1 + 127) << 23) * (mu_vf32)((n - n1 + 127) << 23);
+
+  res = mu_vf_select(over, mu_vf_dup(MU_INF), res);
+  res = mu_vf_select(under, mu_vf_dup(0.0f), res);
+  return mu_vf_select(nan, mu_vf_dup(MU_NAN), res);
+}
+
+/* Vector form of mu_logf_kernel(), with the special lanes of mu_logf(). */
+static inline mu_vf32 mu_vf_log(mu_vf32 x) {
+  mu_vi32 zero = x == 0.0f;
+  mu_vi32 invalid = (x < 0.0f) | mu_vf_isnan(x);
+  mu_vi32 inf = x == MU_INFF;
+  mu_vf32 xs = mu_vf_select(zero | invalid | inf, mu_vf_dup(1.0f), x);
+
+  mu_vi32 subnormal = xs < 0x1p-126f;
+  xs = mu_vf_select(subnormal, xs * 0x1p23f, xs);
+  mu_vi32 ix = (mu_vi32)xs;
+  mu_vi32 tmp = ix - (int)MU_LOGF_OFF;
+  mu_vi32 k = (tmp >> 23) - (subnormal & 23);
+  mu_vf32 f = (mu_vf32)(ix - (tmp & (int)0xff800000U)) - 1.0f;
+  mu_vf32 fk = __builtin_convertvector(k, mu_vf32);
+
+  mu_vf32 z = f * f;
+  mu_vf32 p =
+      MU_LOGF_P0 +
+      f * (MU_LOGF_P1 +
+           f * (MU_LOGF_P2 +
+                f * (MU_LOGF_P3 +
+                     f * (MU_LOGF_P4 +
+                          f * (MU_LOGF_P5 +
+                               f * (MU_LOGF_P6 +
+                                    f * (MU_LOGF_P7 + f * MU_LOGF_P8)))))));
+  mu_vf32 y = f * z * p + fk * MU_LN2F_LO - 0.5f * z;
+  mu_vf32 res = (f + y) + fk * MU_LN2F_HI;
+
+  res = mu_vf_select(inf, mu_vf_dup(MU_INF), res);
+  res = mu_vf_select(zero, mu_vf_dup(-MU_INF), res);
+  return mu_vf_select(invalid, mu_vf_dup(MU_NAN), res);
+}
+
+/* Runs on the double kernel, whose result rounds correctly to float. */
+static inline mu_vf32 mu_vf_pow(mu_vf32 x, mu_vf32 y) {
+  mu_vf64 xl, xh, yl, yh;
+  mu_vf_widen(x, &xl, &xh);
+  mu_vf_widen(y, &yl, &yh);
+  return mu_vf_narrow(mu_v_pow(xl, yl), mu_v_pow(xh, yh));
+}
+
+/* Vector forms of the reduced-accuracy tier kernels. */
+static inline mu_vf64 mu_v_sin_tier_kernel(mu_vf64 r, int tier) {
+  mu_vf64 z = r * r;
+  mu_vf64 p;
+  if (tier == MU_ACCURACY_FAST) {
+    p = MU_SINF_S1 + z * (MU_SINF_S2 + z * MU_SINF_S3);
+  } else {
+    p = MU_TAYLOR_3 +
+        z * (MU_TAYLOR_5 +
+             z * (MU_TAYLOR_7 + z * (MU_TAYLOR_9 + z * MU_TAYLOR_11)));
+  }
+  return r + r * z * p;
+}
+
+static inline mu_vf64 mu_v_cos_tier_kernel(mu_vf64 r, int tier) {
+  mu_vf64 z = r * r;
+  mu_vf64 p;
+  if (tier == MU_ACCURACY_FAST) {
+    p = MU_COSF_C1 + z * (MU_COSF_C2 + z * MU_COSF_C3);
+  } else {
+    p = MU_TAYLOR_4 +
+        z * (MU_TAYLOR_6 +
+             z * (MU_TAYLOR_8 + z * (MU_TAYLOR_10 + z * MU_TAYLOR_12)));
+  }
+  return (1.0 + MU_TAYLOR_2 * z) + z * z * p;
+}
+
+static inline mu_vf64 mu_v_sin_tier(mu_vf64 x, int tier) {
+  mu_vi64 special = mu_v_isnan(x) | mu_v_isinf(x);
+  mu_vf64 r;
+  mu_vi64 n =
+      mu_v_rem_pio2_short(mu_v_select(special, mu_v_dup(0.0), x), &r);
+
+  mu_vf64 res = mu_v_select((n & 1) != 0, mu_v_cos_tier_kernel(r, tier),
+                            mu_v_sin_tier_kernel(r, tier));
+  res = mu_v_select((n & 2) != 0, -res, res);
+
+  return mu_v_select(special, mu_v_dup(MU_NAN), res);
+}
+
+static inline mu_vf64 mu_v_cos_tier(mu_vf64 x, int tier) {
+  mu_vi64 special = mu_v_isnan(x) | mu_v_isinf(x);
+  mu_vf64 r;
+  mu_vi64 n =
+      mu_v_rem_pio2_short(mu_v_select(special, mu_v_dup(0.0), x), &r);
+
+  mu_vf64 res = mu_v_select((n & 1) != 0, mu_v_sin_tier_kernel(r, tier),
+                            mu_v_cos_tier_kernel(r, tier));
+  res = mu_v_select(((n + 1) & 2) != 0, -res, res);
+
+  return mu_v_select(special, mu_v_dup(MU_NAN), res);
+}
+
+/* Vector form of mu_exp_tier_kernel(). */
+static inline mu_vf64 mu_v_exp_tier_kernel(mu_vf64 x, int tier) {
+  mu_vf64 t = x * MU_EXP_INV_LN2N + MU_ROUND_SHIFT;
+  mu_vf64 kd = t - MU_ROUND_SHIFT;
+  mu_vi64 ki = (mu_vi64)t - (long long)mu_as_u64(MU_ROUND_SHIFT);
+  mu_vf64 r = x - kd * MU_EXP_LN2HI_N;
+
+  mu_vf64 p;
+  if (tier == MU_ACCURACY_FAST) {
+    p = r + r * r * MU_EXP_C2;
+  } else {
+    r -= kd * MU_EXP_LN2LO_N;
+    p = r + r * r * (MU_EXP_C2 + r * MU_EXP_C3);
+  }
+  mu_vf64 thi = mu_v_gather(mu_exp_table, (ki & (MU_EXP_N - 1)) * 2);
+
+  mu_vi64 k = ki >> MU_EXP_TABLE_BITS;
+  mu_vi64 k1 = k >> 1;
+  return (thi + thi * p) * (mu_vf64)((k1 + 1023) << 52) *
+         (mu_vf64)((k - k1 + 1023) << 52);
+}
+
+static inline mu_vf64 mu_v_exp_tier(mu_vf64 x, int tier) {
+  mu_vi64 nan = mu_v_isnan(x);
+  mu_vi64 over = x > MU_EXP_OVERFLOW;
+  mu_vi64 under = x < MU_EXP_UNDERFLOW;
+  mu_vf64 res = mu_v_exp_tier_kernel(
+      mu_v_select(nan | over | under, mu_v_dup(0.0), x), tier);
+
+  res = mu_v_select(over, mu_v_dup(MU_INF), res);
+  res = mu_v_select(under, mu_v_dup(0.0), res);
+  return mu_v_select(nan, mu_v_dup(MU_NAN), res);
+}
+
+/*
+ * Vector form of mu_log_tier_kernel(). The near-1 path is evaluated only when
+ * some lane needs it.
+ */
+static inline mu_vf64 mu_v_log_tier_kernel(mu_vf64 x, int tier) {
+  mu_vi64 subnormal = x < 0x1p-1022;
+  mu_vf64 xs = mu_v_select(subnormal, x * 0x1p52, x);
+
+  mu_vi64 ix = (mu_vi64)xs;
+  mu_vi64 tmp = ix - (long long)MU_LOG_OFF;
+  mu_vi64 idx = ((tmp >> (52 - MU_LOG_TABLE_BITS)) & (MU_LOG_N - 1)) * 4;
+  mu_vi64 k = (tmp >> 52) - (subnormal & 52);
+  mu_vf64 kd = (mu_vf64)(k + 0x4338000000000000LL) - MU_ROUND_SHIFT;
+  mu_vf64 z = (mu_vf64)(ix - (tmp & (long long)0xfff0000000000000ULL));
+
+  mu_vf64 r = z * mu_v_gather(mu_log_table, idx) - 1.0;
+  mu_vf64 p;
+  if (tier == MU_ACCURACY_FAST) {
+    p = r * r * (MU_LOG_C2 + r * MU_LOG_C3);
+  } else {
+    p = r * r * (MU_LOG_C2 + r * (MU_LOG_C3 + r * MU_LOG_C4));
+  }
+  mu_vf64 res = kd * MU_LN2 + (mu_v_gather(mu_log_table + 2, idx) + (r + p));
+
+  mu_vi64 near1 = (x >= 0x1.fp-1) & (x < 0x1.08p+0);
+  if (mu_v_any(near1)) {
+    mu_vf64 f = x - 1.0;
+    mu_vf64 s = f / (2.0 + f);
+    mu_vf64 zs = s * s;
+    mu_vf64 q;
+    if (tier == MU_ACCURACY_FAST) {
+      q = zs * MU_LOG_S1;
+    } else {
+      q = zs * (MU_LOG_S1 + zs * MU_LOG_S2);
+    }
+    res = mu_v_select(near1, f - s * (f - q), res);
+  }
+  return res;
+}
+
+static inline mu_vf64 mu_v_log_tier(mu_vf64 x, int tier) {
+  mu_vi64 zero = x == 0.0;
+  mu_vi64 invalid = (x < 0.0) | mu_v_isnan(x);
+  mu_vi64 inf = x == MU_INF;
+  mu_vf64 res = mu_v_log_tier_kernel(
+      mu_v_select(zero | invalid | inf, mu_v_dup(1.0), x), tier);
+
+  res = mu_v_select(inf, mu_v_dup(MU_INF), res);
+  res = mu_v_select(zero, mu_v_dup(-MU_INF), res);
+  return mu_v_select(invalid, mu_v_dup(MU_NAN), res);
+}
+
+static inline mu_vf64 mu_v_sin_fast(mu_vf64 x) {
+  return mu_v_sin_tier(x, MU_ACCURACY_FAST);
+}
+
+static inline mu_vf64 mu_v_sin_medium(mu_vf64 x) {
+  return mu_v_sin_tier(x, MU_ACCURACY_MEDIUM);
+}
+
+static inline mu_vf64 mu_v_cos_fast(mu_vf64 x) {
+  return mu_v_cos_tier(x, MU_ACCURACY_FAST);
+}
+
+static inline mu_vf64 mu_v_cos_medium(mu_vf64 x) {
+  return mu_v_cos_tier(x, MU_ACCURACY_MEDIUM);
+}
+
+static inline mu_vf64 mu_v_exp_fast(mu_vf64 x) {
+  return mu_v_exp_tier(x, MU_ACCURACY_FAST);
+}
+
+static inline mu_vf64 mu_v_exp_medium(mu_vf64 x) {
+  return mu_v_exp_tier(x, MU_ACCURACY_MEDIUM);
+}
+
+static inline mu_vf64 mu_v_log_fast(mu_vf64 x) {
+  return mu_v_log_tier(x, MU_ACCURACY_FAST);
+}
+
+static inline mu_vf64 mu_v_log_medium(mu_vf64 x) {
+  return mu_v_log_tier(x, MU_ACCURACY_MEDIUM);
+}
+
+static inline mu_vf64 mu_v_exp_fast_kernel(mu_vf64 x) {
+  return mu_v_exp_tier_kernel(x, MU_ACCURACY_FAST);
+}
+
+static inline mu_vf64 mu_v_exp_medium_kernel(mu_vf64 x) {
+  return mu_v_exp_tier_kernel(x, MU_ACCURACY_MEDIUM);
+}
+
+static inline mu_vf64 mu_v_log_fast_kernel(mu_vf64 x) {
+  return mu_v_log_tier_kernel(x, MU_ACCURACY_FAST);
+}
+
+static inline mu_vf64 mu_v_log_medium_kernel(mu_vf64 x) {
+  return mu_v_log_tier_kernel(x, MU_ACCURACY_MEDIUM);
+}
+
+MU_BATCH_API void MU_VARIANT(mu_abs_n)(const int *in, long int *out,
+                                       size_t n) {
+  for (size_t i = 0; i < n; ++i) {
+    out[i] = in[i] > 0 ? in[i] : -(long int)in[i];
+  }
+}
+
+MU_BATCH_UNARY(mu_fabs_n, mu_v_abs, 0.0)
+MU_BATCH_UNARY(mu_trunc_n, mu_v_trunc, 0.0)
+MU_BATCH_UNARY(mu_ceil_n, mu_v_ceil, 0.0)
+MU_BATCH_UNARY(mu_floor_n, mu_v_floor, 0.0)
+MU_BATCH_UNARY(mu_round_n, mu_v_round, 0.0)
+MU_BATCH_UNARY(mu_nearbyint_n, mu_v_nearbyint, 0.0)
+
+MU_BATCH_API void MU_VARIANT(mu_modf_n)(const double *in, double *frac,
+                                        double *ipart, size_t n) {
+  size_t i = 0;
+  mu_vf64 vi;
+  for (; i + MU_VLEN <= n; i += MU_VLEN) {
+    mu_v_store(frac + i, mu_v_modf(mu_v_load(in + i), &vi));
+    mu_v_store(ipart + i, vi);
+  }
+  if (i < n) {
+    mu_vf64 vf = mu_v_modf(mu_v_load_partial(in + i, n - i, 0.0), &vi);
+    mu_v_store_partial(frac + i, vf, n - i);
+    mu_v_store_partial(ipart + i, vi, n - i);
+  }
+}
+
+/* Rounds in vectors; NaN and values outside `long int` give LONG_MIN. */
+static inline mu_vi64 mu_v_lround(mu_vf64 x) {
+  mu_vf64 r = mu_v_round(x);
+  mu_vi64 ok = (r >= (double)LONG_MIN) & (r < -(double)LONG_MIN);
+  mu_vi64 v = __builtin_convertvector(mu_v_select(ok, r, mu_v_dup(0.0)),
+                                      mu_vi64);
+  return (v & ok) | (~ok & LONG_MIN);
+}
+
+MU_BATCH_API void MU_VARIANT(mu_lround_n)(const double *in, long int *out,
+                                          size_t n) {
+  size_t i = 0;
+  for (; i + MU_VLEN <= n; i += MU_VLEN) {
+    mu_vi64 v = mu_v_lround(mu_v_load(in + i));
+    for (int j = 0; j < MU_VLEN; ++j) {
+      out[i + j] = (long int)v[j];
+    }
+  }
+  if (i < n) {
+    mu_vi64 v = mu_v_lround(mu_v_load_partial(in + i, n - i, 0.0));
+    for (size_t j = 0; i + j < n; ++j) {
+      out[i + j] = (long int)v[j];
+    }
+  }
+}
+
+MU_BATCH_BINARY(mu_fmod_n, mu_v_fmod, 0.0, 1.0)
+MU_BATCH_BINARY(mu_remainder_n, mu_v_remainder, 0.0, 1.0)
+
+MU_BATCH_API void MU_VARIANT(mu_remquo_n)(const double *x, const double *y,
+                                          double *out, int *quo, size_t n) {
+  size_t i = 0;
+  mu_vi64 q;
+  for (; i + MU_VLEN <= n; i += MU_VLEN) {
+    mu_v_store(out + i, mu_v_rem(mu_v_load(x + i), mu_v_load(y + i), 1, &q));
+    for (int j = 0; j < MU_VLEN; ++j) {
+      quo[i + j] = (int)q[j];
+    }
+  }
+  if (i < n) {
+    mu_vf64 vx = mu_v_load_partial(x + i, n - i, 0.0);
+    mu_vf64 vy = mu_v_load_partial(y + i, n - i, 1.0);
+    mu_v_store_partial(out + i, mu_v_rem(vx, vy, 1, &q), n - i);
+    for (size_t j = 0; i + j < n; ++j) {
+      quo[i + j] = (int)q[j];
+    }
+  }
+}
+MU_BATCH_UNARY_SPLIT(mu_sin_n, mu_v_sin, mu_v_sin_unchecked, mu_v_trig_clean,
+                     0.0)
+MU_BATCH_UNARY_SPLIT(mu_cos_n, mu_v_cos, mu_v_cos_unchecked, mu_v_trig_clean,
+                     0.0)
+MU_BATCH_UNARY_SPLIT(mu_tan_n, mu_v_tan, mu_v_tan_unchecked, mu_v_trig_clean,
+                     0.0)
+
+MU_BATCH_API void MU_VARIANT(mu_sincos_n)(const double *in, double *s,
+                                          double *c, size_t n) {
+  size_t i = 0;
+  mu_vf64 vs, vc, hi, lo;
+  for (; i + MU_BATCH_BLOCK <= n; i += MU_BATCH_BLOCK) {
+    mu_vi64 ok = mu_v_trig_clean(mu_v_load(in + i));
+    for (size_t j = MU_VLEN; j < MU_BATCH_BLOCK; j += MU_VLEN) {
+      ok &= mu_v_trig_clean(mu_v_load(in + i + j));
+    }
+    int clean = mu_v_all(ok);
+    for (size_t j = 0; j < MU_BATCH_BLOCK; j += MU_VLEN) {
+      if (clean) {
+        mu_vi64 q = mu_v_rem_pio2_medium(mu_v_load(in + i + j), &hi, &lo);
+        mu_v_sincos_reduced(q, hi, lo, &vs, &vc);
+      } else {
+        mu_v_sincos(mu_v_load(in + i + j), &vs, &vc);
+      }
+      mu_v_store(s + i + j, vs);
+      mu_v_store(c + i + j, vc);
+    }
+  }
+  for (; i + MU_VLEN <= n; i += MU_VLEN) {
+    mu_v_sincos(mu_v_load(in + i), &vs, &vc);
+    mu_v_store(s + i, vs);
+    mu_v_store(c + i, vc);
+  }
+  if (i < n) {
+    mu_v_sincos(mu_v_load_partial(in + i, n - i, 0.0), &vs, &vc);
+    mu_v_store_partial(s + i, vs, n - i);
+    mu_v_store_partial(c + i, vc, n - i);
+  }
+}
+
+MU_BATCH_UNARY(mu_sinpi_n, mu_v_sinpi, 0.0)
+MU_BATCH_UNARY(mu_cospi_n, mu_v_cospi, 0.0)
+MU_BATCH_SINCOS(mu_sincospi_n, mu_v_sincospi, 0.0)
+MU_BATCH_UNARY(mu_tanpi_n, mu_v_tanpi, 0.0)
+MU_BATCH_UNARY(mu_sind_n, mu_v_sind, 0.0)
+MU_BATCH_UNARY(mu_cosd_n, mu_v_cosd, 0.0)
+MU_BATCH_SINCOS(mu_sincosd_n, mu_v_sincosd, 0.0)
+MU_BATCH_UNARY(mu_asin_n, mu_v_asin, 0.0)
+MU_BATCH_UNARY(mu_acos_n, mu_v_acos, 0.0)
+MU_BATCH_UNARY(mu_atan_n, mu_v_atan, 0.0)
+MU_BATCH_BINARY(mu_atan2_n, mu_v_atan2, 0.0, 1.0)
+MU_BATCH_UNARY(mu_sqrt_n, mu_v_sqrt_checked, 0.0)
+MU_BATCH_UNARY(mu_rsqrt_n, mu_v_rsqrt, 1.0)
+MU_BATCH_BINARY(mu_pow_n, mu_v_pow, 1.0, 1.0)
+MU_BATCH_UNARY_SPLIT(mu_exp_n, mu_v_exp, mu_v_exp_unchecked, mu_v_exp_clean,
+                     0.0)
+MU_BATCH_UNARY(mu_exp2_n, mu_v_exp2, 0.0)
+MU_BATCH_UNARY(mu_exp10_n, mu_v_exp10, 0.0)
+MU_BATCH_UNARY(mu_expm1_n, mu_v_expm1, 0.0)
+MU_BATCH_UNARY_SPLIT(mu_log_n, mu_v_log, mu_v_log_kernel, mu_v_log_clean, 1.0)
+MU_BATCH_UNARY_SPLIT(mu_log2_n, mu_v_log2, mu_v_log2_kernel, mu_v_log_clean,
+                     1.0)
+MU_BATCH_UNARY_SPLIT(mu_log10_n, mu_v_log10, mu_v_log10_kernel,
+                     mu_v_log_clean, 1.0)
+MU_BATCH_UNARY(mu_log1p_n, mu_v_log1p, 0.0)
+
+/* Vector form of mu_ilogb(). */
+static inline mu_vi64 mu_v_ilogb(mu_vf64 x) {
+  mu_vf64 a = mu_v_abs(x);
+  mu_vi64 ia = (mu_vi64)a;
+  mu_vi64 subnormal = ia < 0x0010000000000000LL;
+  mu_vi64 e = ((mu_vi64)mu_v_select(subnormal, a * 0x1p64, a) >> 52) - 1023 -
+              (subnormal & 64);
+
+  mu_vi64 zero = ia == 0;
+  mu_vi64 inf = ia == 0x7ff0000000000000LL;
+  mu_vi64 nan = ia > 0x7ff0000000000000LL;
+  e = (e & ~zero) | (zero & MU_FP_ILOGB0);
+  e = (e & ~inf) | (inf & INT_MAX);
+  return (e & ~nan) | (nan & MU_FP_ILOGBNAN);
+}
+
+MU_BATCH_API void MU_VARIANT(mu_ilogb_n)(const double *in, int *out,
+                                         size_t n) {
+  size_t i = 0;
+  for (; i + MU_VLEN <= n; i += MU_VLEN) {
+    mu_vi64 v = mu_v_ilogb(mu_v_load(in + i));
+    for (int j = 0; j < MU_VLEN; ++j) {
+      out[i + j] = (int)v[j];
+    }
+  }
+  if (i < n) {
+    mu_vi64 v = mu_v_ilogb(mu_v_load_partial(in + i, n - i, 1.0));
+    for (size_t j = 0; i + j < n; ++j) {
+      out[i + j] = (int)v[j];
+    }
+  }
+}
+
+/*
+ * Vector form of mu_ldexp_d(): every lane takes both steps, by 1 where the
+ * scalar function would skip them.
+ */
+static inline mu_vf64 mu_v_ldexp(mu_vf64 x, mu_vi64 e) {
+  for (int step = 0; step < 2; ++step) {
+    mu_vi64 up = e > 1023;
+    mu_vi64 down = e < -1022;
+    x *= mu_v_select(up, mu_v_dup(0x1p1023),
+                     mu_v_select(down, mu_v_dup(0x1p-969), mu_v_dup(1.0)));
+    e += (down & 969) - (up & 1023);
+  }
+  mu_vi64 up = e > 1023;
+  mu_vi64 down = e < -1022;
+  e = (e & ~(up | down)) | (up & 1023) | (down & -1022);
+  return x * (mu_vf64)((e + 1023) << 52);
+}
+
+/* Widens the first `n` ints at `p`, at most MU_VLEN, with 0 in the rest. */
+static inline mu_vi64 mu_v_load_int(const int *p, size_t n) {
+  mu_vi64 v = {0};
+  for (size_t j = 0; j < n && j < MU_VLEN; ++j) {
+    v[j] = p[j];
+  }
+  return v;
+}
+
+MU_BATCH_API void MU_VARIANT(mu_ldexp_n)(const double *x, const int *e,
+                                         double *out, size_t n) {
+  size_t i = 0;
+  for (; i + MU_VLEN <= n; i += MU_VLEN) {
+    mu_vi64 v = mu_v_load_int(e + i, MU_VLEN);
+    mu_v_store(out + i, mu_v_ldexp(mu_v_load(x + i), v));
+  }
+  if (i < n) {
+    mu_vi64 v = mu_v_load_int(e + i, n - i);
+    mu_v_store_partial(out + i,
+                       mu_v_ldexp(mu_v_load_partial(x + i, n - i, 0.0), v),
+                       n - i);
+  }
+}
+MU_BATCH_UNARY(mu_sinh_n, mu_v_sinh, 0.0)
+MU_BATCH_UNARY(mu_cosh_n, mu_v_cosh, 0.0)
+MU_BATCH_SINCOS(mu_sinhcosh_n, mu_v_sinhcosh, 0.0)
+MU_BATCH_UNARY(mu_tanh_n, mu_v_tanh, 0.0)
+MU_BATCH_UNARY(mu_asinh_n, mu_v_asinh, 0.0)
+MU_BATCH_UNARY(mu_acosh_n, mu_v_acosh, 1.0)
+MU_BATCH_UNARY(mu_atanh_n, mu_v_atanh, 0.0)
+
+MU_BATCH_API void MU_VARIANT(mu_pow_apply_n)(const mu_pow_plan *plan,
+                                             const double *in, double *out,
+                                             size_t n) {
+  size_t i = 0;
+  for (; i + MU_VLEN <= n; i += MU_VLEN) {
+    mu_v_store(out + i, mu_v_pow_apply(plan, mu_v_load(in + i)));
+  }
+  if (i < n) {
+    mu_vf64 v = mu_v_load_partial(in + i, n - i, 1.0);
+    mu_v_store_partial(out + i, mu_v_pow_apply(plan, v), n - i);
+  }
+}
+
+/*
+ * Progressions x0 + k * dx run in blocks of MU_PROG_STEPS rows of
+ * MU_PROG_LANES elements. Row 0 of a block is evaluated with the accurate
+ * kernel; row r is row 0 advanced by r * MU_PROG_LANES * dx through a table
+ * built once per call. Each value is a single step from its seed, so rounding
+ * errors do not build up along the block. Seeds and table entries take their
+ * arguments as exact double-double sums, so the rounding of x0 + k * dx to a
+ * double does not show in the results either.
+ */
+#define MU_PROG_VECS 4
+#define MU_PROG_LANES (MU_PROG_VECS * MU_VLEN)
+#define MU_PROG_STEPS 32
+#define MU_PROG_BLOCK (MU_PROG_LANES * MU_PROG_STEPS)
+
+/* Largest sincos step: keeps the error-free products in range. */
+#define MU_PROG_SINCOS_MAX 0x1p900
+/* exp() is normal from here up to MU_EXP_OVERFLOW. */
+#define MU_PROG_EXP_MIN -708.0
+
+/*
+ * x0 + (k + j) * dx as x[v] + tail[v] for the row of elements k to
+ * k + MU_PROG_LANES - 1.
+ */
+static inline void mu_v_prog_args(double x0, double dx, size_t k,
+                                  mu_vf64 x[MU_PROG_VECS],
+                                  mu_vf64 tail[MU_PROG_VECS]) {
+  double idx[MU_PROG_LANES];
+  for (size_t j = 0; j < MU_PROG_LANES; ++j) {
+    idx[j] = (double)(k + j);
+  }
+  for (int v = 0; v < MU_PROG_VECS; ++v) {
+    mu_vf64 pe, se;
+    mu_vf64 p = mu_v_two_prod(mu_v_load(idx + v * MU_VLEN), mu_v_dup(dx), &pe);
+    x[v] = mu_v_two_sum(mu_v_dup(x0), p, &se);
+    /* Without FMA the split of a huge dx overflows; such tails are dropped. */
+    tail[v] = mu_v_select(mu_v_isnan(pe), mu_v_dup(0.0), se + pe);
+  }
+}
+
+/* r * step as t + tail for the table rows r to r + MU_VLEN - 1. */
+static inline mu_vf64 mu_v_prog_steps(double step, int r, mu_vf64 *tail) {
+  double idx[MU_VLEN];
+  for (int j = 0; j < MU_VLEN; ++j) {
+    idx[j] = (double)(r + j);
+  }
+  return mu_v_two_prod(mu_v_load(idx), mu_v_dup(step), tail);
+}
+
+/* Stores the first `m` elements of a row. */
+static inline void mu_v_prog_store(double *p, const mu_vf64 v[MU_PROG_VECS],
+                                   size_t m) {
+  for (size_t j = 0; j < MU_PROG_VECS && j * MU_VLEN < m; ++j) {
+    if (m - j * MU_VLEN >= MU_VLEN) {
+      mu_v_store(p + j * MU_VLEN, v[j]);
+    } else {
+      mu_v_store_partial(p + j * MU_VLEN, v[j], m - j * MU_VLEN);
+    }
+  }
+}
+
+/* mu_v_sincos() of x + tail, for |tail| <= ulp(x). */
+static inline void mu_v_sincos_tail(mu_vf64 x, mu_vf64 tail, mu_vf64 *s,
+                                    mu_vf64 *c) {
+  mu_vi64 special = mu_v_isnan(x) | mu_v_isinf(x);
+  mu_vf64 hi, lo;
+  mu_vi64 n = mu_v_rem_pio2(mu_v_select(special, mu_v_dup(0.0), x), &hi, &lo);
+  hi = mu_v_two_sum(hi, lo + mu_v_select(special, mu_v_dup(0.0), tail), &lo);
+
+  mu_vf64 rs, rc;
+  mu_v_sincos_reduced(n, hi, lo, &rs, &rc);
+  *s = mu_v_select(special, mu_v_dup(MU_NAN), rs);
+  *c = mu_v_select(special, mu_v_dup(MU_NAN), rc);
+}
+
+MU_BATCH_API void MU_VARIANT(mu_sincos_progression)(double x0, double dx,
+                                                    double *s, double *c,
+                                                    size_t n) {
+  /*
+   * sin(a + t) = sin a + (alpha sin a + beta cos a) with alpha = cos t - 1 =
+   * -2 sin^2(t/2) and beta = sin t, which keeps small steps accurate.
+   */
+  double step = dx * MU_PROG_LANES;
+  int table = n > MU_PROG_LANES && step > -MU_PROG_SINCOS_MAX &&
+              step < MU_PROG_SINCOS_MAX;
+  double alpha[MU_PROG_STEPS], beta[MU_PROG_STEPS];
+  if (table) {
+    for (int r = 0; r < MU_PROG_STEPS; r += MU_VLEN) {
+      mu_vf64 tail, hs, hc, ts, tc;
+      mu_vf64 t = mu_v_prog_steps(step, r, &tail);
+      mu_v_sincos_tail(0.5 * t, 0.5 * tail, &hs, &hc);
+      mu_v_sincos_tail(t, tail, &ts, &tc);
+      mu_v_store(alpha + r, -2.0 * hs * hs);
+      mu_v_store(beta + r, ts);
+    }
+  }
+
+  mu_vf64 x[MU_PROG_VECS], tail[MU_PROG_VECS];
+  mu_vf64 ss[MU_PROG_VECS], cs[MU_PROG_VECS];
+  mu_vf64 vs[MU_PROG_VECS], vc[MU_PROG_VECS];
+  for (size_t i = 0; i < n; i += MU_PROG_BLOCK) {
+    size_t len = n - i < MU_PROG_BLOCK ? n - i : MU_PROG_BLOCK;
+    double first = x0 + (double)i * dx;
+    double last = x0 + (double)(i + len - 1) * dx;
+    int fast = table && first > -MU_INF && first < MU_INF && last > -MU_INF &&
+               last < MU_INF;
+
+    mu_v_prog_args(x0, dx, i, x, tail);
+    for (int v = 0; v < MU_PROG_VECS; ++v) {
+      mu_v_sincos_tail(x[v], tail[v], &ss[v], &cs[v]);
+    }
+
+    for (size_t r = 0; r * MU_PROG_LANES < len; ++r) {
+      size_t k = r * MU_PROG_LANES;
+      if (r == 0) {
+        for (int v = 0; v < MU_PROG_VECS; ++v) {
+          vs[v] = ss[v];
+          vc[v] = cs[v];
+        }
+      } else if (fast) {
+        for (int v = 0; v < MU_PROG_VECS; ++v) {
+          vs[v] = ss[v] + (ss[v] * alpha[r] + cs[v] * beta[r]);
+          vc[v] = cs[v] + (cs[v] * alpha[r] - ss[v] * beta[r]);
+        }
+      } else {
+        mu_v_prog_args(x0, dx, i + k, x, tail);
+        for (int v = 0; v < MU_PROG_VECS; ++v) {
+          mu_v_sincos_tail(x[v], tail[v], &vs[v], &vc[v]);
+        }
+      }
+      size_t m = len - k < MU_PROG_LANES ? len - k : MU_PROG_LANES;
+      mu_v_prog_store(s + i + k, vs, m);
+      mu_v_prog_store(c + i + k, vc, m);
+    }
+  }
+}
+
+MU_BATCH_API void MU_VARIANT(mu_exp_progression)(double x0, double dx,
+                                                 double *out, size_t n) {
+  /* exp(a + t) = exp(a) * exp(t), with every exp(t) of the table normal. */
+  double step = dx * MU_PROG_LANES;
+  double span = step * (MU_PROG_STEPS - 1);
+  int table = n > MU_PROG_LANES && span >= MU_PROG_EXP_MIN &&
+              span <= -MU_PROG_EXP_MIN;
+  double scale[MU_PROG_STEPS];
+  if (table) {
+    for (int r = 0; r < MU_PROG_STEPS; r += MU_VLEN) {
+      mu_vf64 tail;
+      mu_vf64 t = mu_v_prog_steps(step, r, &tail);
+      mu_v_store(scale + r, mu_v_exp_kernel(t, tail));
+    }
+  }
+
+  mu_vf64 x[MU_PROG_VECS], tail[MU_PROG_VECS];
+  mu_vf64 seed[MU_PROG_VECS], v[MU_PROG_VECS];
+  for (size_t i = 0; i < n; i += MU_PROG_BLOCK) {
+    size_t len = n - i < MU_PROG_BLOCK ? n - i : MU_PROG_BLOCK;
+    double first = x0 + (double)i * dx;
+    double last = x0 + (double)(i + len - 1) * dx;
+    int fast = table && first >= MU_PROG_EXP_MIN &&
+               first <= MU_EXP_OVERFLOW && last >= MU_PROG_EXP_MIN &&
+               last <= MU_EXP_OVERFLOW;
+
+    mu_v_prog_args(x0, dx, i, x, tail);
+    for (int j = 0; j < MU_PROG_VECS; ++j) {
+      seed[j] = mu_v_exp_tail(x[j], tail[j]);
+    }
+
+    for (size_t r = 0; r * MU_PROG_LANES < len; ++r) {
+      size_t k = r * MU_PROG_LANES;
+      if (r == 0) {
+        for (int j = 0; j < MU_PROG_VECS; ++j) {
+          v[j] = seed[j];
+        }
+      } else if (fast) {
+        for (int j = 0; j < MU_PROG_VECS; ++j) {
+          v[j] = seed[j] * scale[r];
+        }
+      } else {
+        mu_v_prog_args(x0, dx, i + k, x, tail);
+        for (int j = 0; j < MU_PROG_VECS; ++j) {
+          v[j] = mu_v_exp_tail(x[j], tail[j]);
+        }
+      }
+      size_t m = len - k < MU_PROG_LANES ? len - k : MU_PROG_LANES;
+      mu_v_prog_store(out + i + k, v, m);
+    }
+  }
+}
+
+MU_BATCHF_UNARY(mu_fabsf_n, mu_vf_abs, 0.0f)
+MU_BATCHF_UNARY(mu_truncf_n, mu_vf_trunc, 0.0f)
+MU_BATCHF_UNARY(mu_ceilf_n, mu_vf_ceil, 0.0f)
+MU_BATCHF_UNARY(mu_floorf_n, mu_vf_floor, 0.0f)
+MU_BATCHF_UNARY(mu_roundf_n, mu_vf_round, 0.0f)
+MU_BATCHF_UNARY(mu_nearbyintf_n, mu_vf_nearbyint, 0.0f)
+
+MU_BATCH_API void MU_VARIANT(mu_modff_n)(const float *in, float *frac,
+                                         float *ipart, size_t n) {
+  size_t i = 0;
+  mu_vf32 vi;
+  for (; i + MU_VLENF <= n; i += MU_VLENF) {
+    mu_vf_store(frac + i, mu_vf_modf(mu_vf_load(in + i), &vi));
+    mu_vf_store(ipart + i, vi);
+  }
+  if (i < n) {
+    mu_vf32 vf = mu_vf_modf(mu_vf_load_partial(in + i, n - i, 0.0f), &vi);
+    mu_vf_store_partial(frac + i, vf, n - i);
+    mu_vf_store_partial(ipart + i, vi, n - i);
+  }
+}
+
+MU_BATCHF_BINARY(mu_fmodf_n, mu_vf_fmod, 0.0f, 1.0f)
+MU_BATCHF_BINARY(mu_remainderf_n, mu_vf_remainder, 0.0f, 1.0f)
+MU_BATCHF_UNARY(mu_sinf_n, mu_vf_sin, 0.0f)
+MU_BATCHF_UNARY(mu_cosf_n, mu_vf_cos, 0.0f)
+MU_BATCHF_UNARY(mu_tanf_n, mu_vf_tan, 0.0f)
+
+MU_BATCHF_SINCOS(mu_sincosf_n, mu_vf_sincos, 0.0f)
+MU_BATCHF_UNARY(mu_sinpif_n, mu_vf_sinpi, 0.0f)
+MU_BATCHF_UNARY(mu_cospif_n, mu_vf_cospi, 0.0f)
+MU_BATCHF_SINCOS(mu_sincospif_n, mu_vf_sincospi, 0.0f)
+MU_BATCHF_UNARY(mu_tanpif_n, mu_vf_tanpi, 0.0f)
+MU_BATCHF_UNARY(mu_sindf_n, mu_vf_sind, 0.0f)
+MU_BATCHF_UNARY(mu_cosdf_n, mu_vf_cosd, 0.0f)
+MU_BATCHF_SINCOS(mu_sincosdf_n, mu_vf_sincosd, 0.0f)
+MU_BATCHF_UNARY(mu_asinf_n, mu_vf_asin, 0.0f)
+MU_BATCHF_UNARY(mu_acosf_n, mu_vf_acos, 0.0f)
+MU_BATCHF_UNARY(mu_atanf_n, mu_vf_atan, 0.0f)
+MU_BATCHF_BINARY(mu_atan2f_n, mu_vf_atan2, 0.0f, 1.0f)
+MU_BATCHF_UNARY(mu_sqrtf_n, mu_vf_sqrt_checked, 0.0f)
+MU_BATCHF_UNARY(mu_rsqrtf_n, mu_vf_rsqrt, 1.0f)
+MU_BATCHF_BINARY(mu_powf_n, mu_vf_pow, 1.0f, 1.0f)
+MU_BATCHF_UNARY(mu_expf_n, mu_vf_exp, 0.0f)
+MU_BATCHF_UNARY(mu_exp2f_n, mu_vf_exp2, 0.0f)
+MU_BATCHF_UNARY(mu_exp10f_n, mu_vf_exp10, 0.0f)
+MU_BATCHF_UNARY(mu_expm1f_n, mu_vf_expm1, 0.0f)
+MU_BATCHF_UNARY(mu_logf_n, mu_vf_log, 1.0f)
+MU_BATCHF_UNARY(mu_log2f_n, mu_vf_log2, 1.0f)
+MU_BATCHF_UNARY(mu_log10f_n, mu_vf_log10, 1.0f)
+MU_BATCHF_UNARY(mu_log1pf_n, mu_vf_log1p, 0.0f)
+MU_BATCHF_UNARY(mu_sinhf_n, mu_vf_sinh, 0.0f)
+MU_BATCHF_UNARY(mu_coshf_n, mu_vf_cosh, 0.0f)
+MU_BATCHF_SINCOS(mu_sinhcoshf_n, mu_vf_sinhcosh, 0.0f)
+MU_BATCHF_UNARY(mu_tanhf_n, mu_vf_tanh, 0.0f)
+MU_BATCHF_UNARY(mu_asinhf_n, mu_vf_asinh, 0.0f)
+MU_BATCHF_UNARY(mu_acoshf_n, mu_vf_acosh, 1.0f)
+MU_BATCHF_UNARY(mu_atanhf_n, mu_vf_atanh, 0.0f)
+
+MU_BATCH_UNARY(mu_sin_fast_n, mu_v_sin_fast, 0.0)
+MU_BATCH_UNARY(mu_sin_medium_n, mu_v_sin_medium, 0.0)
+MU_BATCH_UNARY(mu_cos_fast_n, mu_v_cos_fast, 0.0)
+MU_BATCH_UNARY(mu_cos_medium_n, mu_v_cos_medium, 0.0)
+MU_BATCH_UNARY_SPLIT(mu_exp_fast_n, mu_v_exp_fast, mu_v_exp_fast_kernel,
+                     mu_v_exp_clean, 0.0)
+MU_BATCH_UNARY_SPLIT(mu_exp_medium_n, mu_v_exp_medium, mu_v_exp_medium_kernel,
+                     mu_v_exp_clean, 0.0)
+MU_BATCH_UNARY_SPLIT(mu_log_fast_n, mu_v_log_fast, mu_v_log_fast_kernel,
+                     mu_v_log_clean, 1.0)
+MU_BATCH_UNARY_SPLIT(mu_log_medium_n, mu_v_log_medium, mu_v_log_medium_kernel,
+                     mu_v_log_clean, 1.0)
+
+#if defined(MU_DISPATCH)
+#define MU_BATCH_INIT(name, params, args) .name = MU_VARIANT(name),
+
+const mu_batch_table MU_CAT(mu_batch_table, MU_ISA_SUFFIX) = {
+    MU_BATCH_LIST(MU_BATCH_INIT)};
+#endif
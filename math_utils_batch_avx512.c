@@ -0,0 +1,10 @@
+/*
+ * AVX-512 variant of the batch kernels. The build compiles this file with
+ * `-mavx512f -mavx512dq`; math_utils_dispatch.c selects it at run time.
+ */
+#include "math_utils_dispatch.h"
+
+#if defined(MU_DISPATCH)
+#define MU_ISA_SUFFIX _avx512
+#include "math_utils_batch.c"
+#endif
@@ -0,0 +1,101 @@
+#include "math_utils_dispatch.h"
+
+#include <stdatomic.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "math_utils.h"
+
+#if defined(MU_DISPATCH)
+
+typedef struct {
+  const char *name;
+  const mu_batch_table *table;
+  int (*supported)(void);
+} mu_batch_variant;
+
+static int mu_cpu_sse2(void) { return 1; }
+
+static int mu_cpu_avx2(void) {
+  __builtin_cpu_init();
+  return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+}
+
+static int mu_cpu_avx512(void) {
+  __builtin_cpu_init();
+  return __builtin_cpu_supports("avx512f") &&
+         __builtin_cpu_supports("avx512dq");
+}
+
+/* Widest first. The SSE2 variant is built with the library's own flags. */
+static const mu_batch_variant mu_batch_variants[] = {
+    {"avx512", &mu_batch_table_avx512, mu_cpu_avx512},
+    {"avx2", &mu_batch_table_avx2, mu_cpu_avx2},
+    {"sse2", &mu_batch_table_sse2, mu_cpu_sse2},
+};
+
+#define MU_BATCH_VARIANTS \
+  (sizeof(mu_batch_variants) / sizeof(mu_batch_variants[0]))
+
+static _Atomic(const mu_batch_variant *) mu_batch_active;
+
+static const mu_batch_variant *mu_batch_find(const char *isa) {
+  for (size_t i = 0; i < MU_BATCH_VARIANTS; ++i) {
+    if (strcmp(isa, mu_batch_variants[i].name) == 0) {
+      return mu_batch_variants[i].supported() ? &mu_batch_variants[i] : NULL;
+    }
+  }
+  return NULL;
+}
+
+static const mu_batch_variant *mu_batch_best(void) {
+  const char *env = getenv("MU_BATCH_ISA");
+  const mu_batch_variant *v = env ? mu_batch_find(env) : NULL;
+  for (size_t i = 0; v == NULL; ++i) {
+    if (mu_batch_variants[i].supported()) {
+      v = &mu_batch_variants[i];
+    }
+  }
+  return v;
+}
+
+/*
+ * Resolves the variant on first use. Concurrent first calls all pick the
+ * same variant, so the race between them is harmless.
+ */
+static const mu_batch_variant *mu_batch_variant_get(void) {
+  const mu_batch_variant *v =
+      atomic_load_explicit(&mu_batch_active, memory_order_acquire);
+  if (v == NULL) {
+    v = mu_batch_best();
+    atomic_store_explicit(&mu_batch_active, v, memory_order_release);
+  }
+  return v;
+}
+
+const char *mu_batch_isa(void) { return mu_batch_variant_get()->name; }
+
+int mu_batch_set_isa(const char *isa) {
+  const mu_batch_variant *v = isa ? mu_batch_find(isa) : mu_batch_best();
+  if (v == NULL) {
+    return -1;
+  }
+
+  atomic_store_explicit(&mu_batch_active, v, memory_order_release);
+  return 0;
+}
+
+#define MU_BATCH_STUB(name, params, args) \
+  void name params { mu_batch_variant_get()->table->name args; }
+
+MU_BATCH_LIST(MU_BATCH_STUB)
+
+#else
+
+const char *mu_batch_isa(void) { return "native"; }
+
+int mu_batch_set_isa(const char *isa) {
+  return (isa == NULL || strcmp(isa, "native") == 0) ? 0 : -1;
+}
+
+#endif
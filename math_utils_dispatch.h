@@ -0,0 +1,173 @@
+#ifndef MATH_MATH_UTILS_DISPATCH_H_
+#define MATH_MATH_UTILS_DISPATCH_H_
+
+#include "math_utils.h"
+
+/*
+ * On x86 the batch kernels are built once per instruction set (SSE2,
+ * AVX2+FMA and AVX-512) and the public mu_*_n() functions jump through the
+ * table of the best variant the CPU supports. Other targets, and builds with
+ * MU_NO_DISPATCH, compile a single variant under the public names.
+ */
+#if !defined(MU_NO_DISPATCH) && defined(__GNUC__) && \
+    (defined(__x86_64__) || defined(__i386__))
+#define MU_DISPATCH 1
+#endif
+
+#define MU_CAT_(a, b) a##b
+#define MU_CAT(a, b) MU_CAT_(a, b)
+
+/* Parameter lists and argument lists of the batch function shapes. */
+#define MU_SIG_ABS (const int *in, long int *out, size_t n), (in, out, n)
+#define MU_SIG_UNARY (const double *in, double *out, size_t n), (in, out, n)
+#define MU_SIG_BINARY \
+  (const double *x, const double *y, double *out, size_t n), (x, y, out, n)
+#define MU_SIG_SINCOS \
+  (const double *in, double *s, double *c, size_t n), (in, s, c, n)
+#define MU_SIG_MODF                                          \
+  (const double *in, double *frac, double *ipart, size_t n), \
+      (in, frac, ipart, n)
+#define MU_SIG_LROUND (const double *in, long int *out, size_t n), (in, out, n)
+#define MU_SIG_ILOGB (const double *in, int *out, size_t n), (in, out, n)
+#define MU_SIG_LDEXP \
+  (const double *x, const int *e, double *out, size_t n), (x, e, out, n)
+#define MU_SIG_REMQUO                                                  \
+  (const double *x, const double *y, double *out, int *quo, size_t n), \
+      (x, y, out, quo, n)
+#define MU_SIG_POW_APPLY                                              \
+  (const mu_pow_plan *plan, const double *in, double *out, size_t n), \
+      (plan, in, out, n)
+#define MU_SIG_SINCOS_PROG \
+  (double x0, double dx, double *s, double *c, size_t n), (x0, dx, s, c, n)
+#define MU_SIG_EXP_PROG \
+  (double x0, double dx, double *out, size_t n), (x0, dx, out, n)
+#define MU_SIG_UNARYF (const float *in, float *out, size_t n), (in, out, n)
+#define MU_SIG_BINARYF \
+  (const float *x, const float *y, float *out, size_t n), (x, y, out, n)
+#define MU_SIG_SINCOSF \
+  (const float *in, float *s, float *c, size_t n), (in, s, c, n)
+#define MU_SIG_MODFF                                      \
+  (const float *in, float *frac, float *ipart, size_t n), \
+      (in, frac, ipart, n)
+
+/*
+ * Every dispatched batch function with its shape. `X` is called as
+ * X(name, params, args) once the shape is expanded.
+ */
+#define MU_BATCH_LIST(X)                                       \
+  MU_BATCH_ENTRY(X, mu_abs_n, MU_SIG_ABS)                      \
+  MU_BATCH_ENTRY(X, mu_fabs_n, MU_SIG_UNARY)                   \
+  MU_BATCH_ENTRY(X, mu_trunc_n, MU_SIG_UNARY)                  \
+  MU_BATCH_ENTRY(X, mu_ceil_n, MU_SIG_UNARY)                   \
+  MU_BATCH_ENTRY(X, mu_floor_n, MU_SIG_UNARY)                  \
+  MU_BATCH_ENTRY(X, mu_round_n, MU_SIG_UNARY)                  \
+  MU_BATCH_ENTRY(X, mu_nearbyint_n, MU_SIG_UNARY)              \
+  MU_BATCH_ENTRY(X, mu_modf_n, MU_SIG_MODF)                    \
+  MU_BATCH_ENTRY(X, mu_lround_n, MU_SIG_LROUND)                \
+  MU_BATCH_ENTRY(X, mu_fmod_n, MU_SIG_BINARY)                  \
+  MU_BATCH_ENTRY(X, mu_remainder_n, MU_SIG_BINARY)             \
+  MU_BATCH_ENTRY(X, mu_remquo_n, MU_SIG_REMQUO)                \
+  MU_BATCH_ENTRY(X, mu_sin_n, MU_SIG_UNARY)                    \
+  MU_BATCH_ENTRY(X, mu_cos_n, MU_SIG_UNARY)                    \
+  MU_BATCH_ENTRY(X, mu_tan_n, MU_SIG_UNARY)                    \
+  MU_BATCH_ENTRY(X, mu_sincos_n, MU_SIG_SINCOS)                \
+  MU_BATCH_ENTRY(X, mu_sinpi_n, MU_SIG_UNARY)                  \
+  MU_BATCH_ENTRY(X, mu_cospi_n, MU_SIG_UNARY)                  \
+  MU_BATCH_ENTRY(X, mu_sincospi_n, MU_SIG_SINCOS)              \
+  MU_BATCH_ENTRY(X, mu_tanpi_n, MU_SIG_UNARY)                  \
+  MU_BATCH_ENTRY(X, mu_sind_n, MU_SIG_UNARY)                   \
+  MU_BATCH_ENTRY(X, mu_cosd_n, MU_SIG_UNARY)                   \
+  MU_BATCH_ENTRY(X, mu_sincosd_n, MU_SIG_SINCOS)               \
+  MU_BATCH_ENTRY(X, mu_asin_n, MU_SIG_UNARY)                   \
+  MU_BATCH_ENTRY(X, mu_acos_n, MU_SIG_UNARY)                   \
+  MU_BATCH_ENTRY(X, mu_atan_n, MU_SIG_UNARY)                   \
+  MU_BATCH_ENTRY(X, mu_atan2_n, MU_SIG_BINARY)                 \
+  MU_BATCH_ENTRY(X, mu_sqrt_n, MU_SIG_UNARY)                   \
+  MU_BATCH_ENTRY(X, mu_rsqrt_n, MU_SIG_UNARY)                  \
+  MU_BATCH_ENTRY(X, mu_pow_n, MU_SIG_BINARY)                   \
+  MU_BATCH_ENTRY(X, mu_pow_apply_n, MU_SIG_POW_APPLY)          \
+  MU_BATCH_ENTRY(X, mu_exp_n, MU_SIG_UNARY)                    \
+  MU_BATCH_ENTRY(X, mu_exp2_n, MU_SIG_UNARY)                   \
+  MU_BATCH_ENTRY(X, mu_exp10_n, MU_SIG_UNARY)                  \
+  MU_BATCH_ENTRY(X, mu_expm1_n, MU_SIG_UNARY)                  \
+  MU_BATCH_ENTRY(X, mu_log_n, MU_SIG_UNARY)                    \
+  MU_BATCH_ENTRY(X, mu_log2_n, MU_SIG_UNARY)                   \
+  MU_BATCH_ENTRY(X, mu_log10_n, MU_SIG_UNARY)                  \
+  MU_BATCH_ENTRY(X, mu_log1p_n, MU_SIG_UNARY)                  \
+  MU_BATCH_ENTRY(X, mu_ilogb_n, MU_SIG_ILOGB)                  \
+  MU_BATCH_ENTRY(X, mu_ldexp_n, MU_SIG_LDEXP)                  \
+  MU_BATCH_ENTRY(X, mu_sinh_n, MU_SIG_UNARY)                   \
+  MU_BATCH_ENTRY(X, mu_cosh_n, MU_SIG_UNARY)                   \
+  MU_BATCH_ENTRY(X, mu_sinhcosh_n, MU_SIG_SINCOS)              \
+  MU_BATCH_ENTRY(X, mu_tanh_n, MU_SIG_UNARY)                   \
+  MU_BATCH_ENTRY(X, mu_asinh_n, MU_SIG_UNARY)                  \
+  MU_BATCH_ENTRY(X, mu_acosh_n, MU_SIG_UNARY)                  \
+  MU_BATCH_ENTRY(X, mu_atanh_n, MU_SIG_UNARY)                  \
+  MU_BATCH_ENTRY(X, mu_sincos_progression, MU_SIG_SINCOS_PROG) \
+  MU_BATCH_ENTRY(X, mu_exp_progression, MU_SIG_EXP_PROG)       \
+  MU_BATCH_ENTRY(X, mu_fabsf_n, MU_SIG_UNARYF)                 \
+  MU_BATCH_ENTRY(X, mu_truncf_n, MU_SIG_UNARYF)                \
+  MU_BATCH_ENTRY(X, mu_ceilf_n, MU_SIG_UNARYF)                 \
+  MU_BATCH_ENTRY(X, mu_floorf_n, MU_SIG_UNARYF)                \
+  MU_BATCH_ENTRY(X, mu_roundf_n, MU_SIG_UNARYF)                \
+  MU_BATCH_ENTRY(X, mu_nearbyintf_n, MU_SIG_UNARYF)            \
+  MU_BATCH_ENTRY(X, mu_modff_n, MU_SIG_MODFF)                  \
+  MU_BATCH_ENTRY(X, mu_fmodf_n, MU_SIG_BINARYF)                \
+  MU_BATCH_ENTRY(X, mu_remainderf_n, MU_SIG_BINARYF)           \
+  MU_BATCH_ENTRY(X, mu_sinf_n, MU_SIG_UNARYF)                  \
+  MU_BATCH_ENTRY(X, mu_cosf_n, MU_SIG_UNARYF)                  \
+  MU_BATCH_ENTRY(X, mu_tanf_n, MU_SIG_UNARYF)                  \
+  MU_BATCH_ENTRY(X, mu_sincosf_n, MU_SIG_SINCOSF)              \
+  MU_BATCH_ENTRY(X, mu_sinpif_n, MU_SIG_UNARYF)                \
+  MU_BATCH_ENTRY(X, mu_cospif_n, MU_SIG_UNARYF)                \
+  MU_BATCH_ENTRY(X, mu_sincospif_n, MU_SIG_SINCOSF)            \
+  MU_BATCH_ENTRY(X, mu_tanpif_n, MU_SIG_UNARYF)                \
+  MU_BATCH_ENTRY(X, mu_sindf_n, MU_SIG_UNARYF)                 \
+  MU_BATCH_ENTRY(X, mu_cosdf_n, MU_SIG_UNARYF)                 \
+  MU_BATCH_ENTRY(X, mu_sincosdf_n, MU_SIG_SINCOSF)             \
+  MU_BATCH_ENTRY(X, mu_asinf_n, MU_SIG_UNARYF)                 \
+  MU_BATCH_ENTRY(X, mu_acosf_n, MU_SIG_UNARYF)                 \
+  MU_BATCH_ENTRY(X, mu_atanf_n, MU_SIG_UNARYF)                 \
+  MU_BATCH_ENTRY(X, mu_atan2f_n, MU_SIG_BINARYF)               \
+  MU_BATCH_ENTRY(X, mu_sqrtf_n, MU_SIG_UNARYF)                 \
+  MU_BATCH_ENTRY(X, mu_rsqrtf_n, MU_SIG_UNARYF)                \
+  MU_BATCH_ENTRY(X, mu_powf_n, MU_SIG_BINARYF)                 \
+  MU_BATCH_ENTRY(X, mu_expf_n, MU_SIG_UNARYF)                  \
+  MU_BATCH_ENTRY(X, mu_exp2f_n, MU_SIG_UNARYF)                 \
+  MU_BATCH_ENTRY(X, mu_exp10f_n, MU_SIG_UNARYF)                \
+  MU_BATCH_ENTRY(X, mu_expm1f_n, MU_SIG_UNARYF)                \
+  MU_BATCH_ENTRY(X, mu_logf_n, MU_SIG_UNARYF)                  \
+  MU_BATCH_ENTRY(X, mu_log2f_n, MU_SIG_UNARYF)                 \
+  MU_BATCH_ENTRY(X, mu_log10f_n, MU_SIG_UNARYF)                \
+  MU_BATCH_ENTRY(X, mu_log1pf_n, MU_SIG_UNARYF)                \
+  MU_BATCH_ENTRY(X, mu_sinhf_n, MU_SIG_UNARYF)                 \
+  MU_BATCH_ENTRY(X, mu_coshf_n, MU_SIG_UNARYF)                 \
+  MU_BATCH_ENTRY(X, mu_sinhcoshf_n, MU_SIG_SINCOSF)            \
+  MU_BATCH_ENTRY(X, mu_tanhf_n, MU_SIG_UNARYF)                 \
+  MU_BATCH_ENTRY(X, mu_asinhf_n, MU_SIG_UNARYF)                \
+  MU_BATCH_ENTRY(X, mu_acoshf_n, MU_SIG_UNARYF)                \
+  MU_BATCH_ENTRY(X, mu_atanhf_n, MU_SIG_UNARYF)                \
+  MU_BATCH_ENTRY(X, mu_sin_fast_n, MU_SIG_UNARY)               \
+  MU_BATCH_ENTRY(X, mu_sin_medium_n, MU_SIG_UNARY)             \
+  MU_BATCH_ENTRY(X, mu_cos_fast_n, MU_SIG_UNARY)               \
+  MU_BATCH_ENTRY(X, mu_cos_medium_n, MU_SIG_UNARY)             \
+  MU_BATCH_ENTRY(X, mu_exp_fast_n, MU_SIG_UNARY)               \
+  MU_BATCH_ENTRY(X, mu_exp_medium_n, MU_SIG_UNARY)             \
+  MU_BATCH_ENTRY(X, mu_log_fast_n, MU_SIG_UNARY)               \
+  MU_BATCH_ENTRY(X, mu_log_medium_n, MU_SIG_UNARY)
+
+#define MU_BATCH_ENTRY(X, name, sig) MU_BATCH_EXPAND(X, name, sig)
+#define MU_BATCH_EXPAND(X, name, params, args) X(name, params, args)
+
+#define MU_BATCH_FIELD(name, params, args) void (*name) params;
+
+/* Function table filled in by each instruction-set variant. */
+typedef struct {
+  MU_BATCH_LIST(MU_BATCH_FIELD)
+} mu_batch_table;
+
+extern const mu_batch_table mu_batch_table_sse2;
+extern const mu_batch_table mu_batch_table_avx2;
+extern const mu_batch_table mu_batch_table_avx512;
+
+#endif  // MATH_MATH_UTILS_DISPATCH_H_
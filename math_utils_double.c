@@ -0,0 +1,722 @@
+#include "math_utils.h"
+#include "math_utils_internal.h"
+
+/*
+ * Double-precision tier. Every function here stays in SSE/AVX double
+ * arithmetic; the long double API in math_utils.c widens these results.
+ */
+
+double mu_fabs_d(double x) {
+  return mu_as_f64(mu_as_u64(x) & 0x7fffffffffffffffULL);
+}
+
+/*
+ * The rounding functions are branchless: roundsd where SSE4.1 is enabled,
+ * otherwise bit masks and compares that compile to selects.
+ */
+double mu_trunc_d(double x) {
+#if defined(__SSE4_1__)
+  return MU_ROUND_SD(x, _MM_FROUND_TO_ZERO);
+#else
+  /* Clears the fraction bits; below 1 all but the sign, leaving a signed 0. */
+  uint64_t u = mu_as_u64(x);
+  int frac = 1075 - (int)((u >> 52) & 0x7ff);
+  frac = frac < 0 ? 0 : frac;
+  frac = frac > 52 ? 63 : frac;
+  return mu_as_f64(u & (~0ULL << frac));
+#endif
+}
+
+double mu_ceil_d(double x) {
+#if defined(__SSE4_1__)
+  return MU_ROUND_SD(x, _MM_FROUND_TO_POS_INF);
+#else
+  double t = mu_trunc_d(x);
+  /* The sign of `x` turns the result for x in (-1, 0) into -0. */
+  return mu_copysign_bits(t + (double)(t < x), x);
+#endif
+}
+
+double mu_floor_d(double x) {
+#if defined(__SSE4_1__)
+  return MU_ROUND_SD(x, _MM_FROUND_TO_NEG_INF);
+#else
+  double t = mu_trunc_d(x);
+  return t - (double)(t > x);
+#endif
+}
+
+double mu_round_d(double x) {
+  double t = mu_trunc_d(x);
+  /* x - t is exact, and NaN for infinities, which then keep t. */
+  double half = (double)(mu_fabs_d(x - t) >= 0.5);
+  return t + mu_copysign_bits(half, x);
+}
+
+double mu_nearbyint_d(double x) {
+#if defined(__SSE4_1__)
+  return MU_ROUND_SD(x, _MM_FROUND_CUR_DIRECTION);
+#else
+  /*
+   * Adding and removing 2^52 with the sign of `x` rounds in the current
+   * direction. Larger magnitudes are already integral.
+   */
+  double shift = mu_copysign_bits(MU_TWO52, x);
+  double r = mu_copysign_bits((x + shift) - shift, x);
+  return mu_fabs_d(x) < MU_TWO52 ? r : x;
+#endif
+}
+
+double mu_modf_d(double x, double *iptr) {
+  double t = mu_trunc_d(x);
+  *iptr = t;
+  double frac = mu_fabs_d(x) == MU_INF ? 0.0 : x - t;
+  return mu_copysign_bits(frac, x);
+}
+
+double mu_fmod_d(double x, double y) {
+  double ax = mu_fabs_d(x);
+  double ay = mu_fabs_d(y);
+  if (!(ax < MU_INF) || !(ay > 0.0)) {
+    return MU_NAN;
+  }
+
+  uint64_t q;
+  return mu_copysign_bits(mu_fmod_kernel(ax, ay, &q), x);
+}
+
+double mu_remquo_d(double x, double y, int *quo) {
+  double ax = mu_fabs_d(x);
+  double ay = mu_fabs_d(y);
+  *quo = 0;
+  if (!(ax < MU_INF) || !(ay > 0.0)) {
+    return MU_NAN;
+  } else if (ay == MU_INF) {
+    return x;
+  }
+
+  /* Rounds the truncated quotient to nearest, ties to even; ay - r is exact
+   * for r in [ay / 2, ay). */
+  uint64_t q;
+  double r = mu_fmod_kernel(ax, ay, &q);
+  double neg = 1.0;
+  if (2.0 * r > ay || (2.0 * r == ay && (q & 1))) {
+    r = ay - r;
+    neg = -1.0;
+    ++q;
+  }
+  int bits = (int)(q & 0x7fffffff);
+  *quo = (mu_as_u64(x) ^ mu_as_u64(y)) >> 63 ? -bits : bits;
+  return mu_copysign_bits(r, x) * neg;
+}
+
+double mu_remainder_d(double x, double y) {
+  int quo;
+  return mu_remquo_d(x, y, &quo);
+}
+
+double mu_sin_d(double x) {
+  MU_STATS_CALL(MU_STATS_SIN, x);
+  if (x != x || mu_fabs_d(x) == MU_INF) {
+    return MU_NAN;
+  }
+  if (mu_fabs_d(x) < MU_TRIG_TINY) {
+    return x; /* Keeps the sign of -0, which the kernel drops. */
+  }
+  if (mu_fabs_d(x) >= MU_PIO2_MEDIUM) {
+    MU_STATS_EVENT(MU_STATS_SIN, SLOW);
+  }
+
+  double hi, lo;
+  int n = mu_rem_pio2(x, &hi, &lo);
+  double res = (n & 1) ? mu_cos_kernel(hi, lo) : mu_sin_kernel(hi, lo);
+
+  return (n & 2) ? -res : res;
+}
+
+double mu_cos_d(double x) {
+  MU_STATS_CALL(MU_STATS_COS, x);
+  if (x != x || mu_fabs_d(x) == MU_INF) {
+    return MU_NAN;
+  }
+  if (mu_fabs_d(x) >= MU_PIO2_MEDIUM) {
+    MU_STATS_EVENT(MU_STATS_COS, SLOW);
+  }
+
+  double hi, lo;
+  int n = mu_rem_pio2(x, &hi, &lo);
+  double res = (n & 1) ? mu_sin_kernel(hi, lo) : mu_cos_kernel(hi, lo);
+
+  return ((n + 1) & 2) ? -res : res;
+}
+
+void mu_sincos_d(double x, double *s, double *c) {
+  if (x != x || mu_fabs_d(x) == MU_INF) {
+    *s = MU_NAN;
+    *c = MU_NAN;
+    return;
+  }
+  if (mu_fabs_d(x) < MU_TRIG_TINY) {
+    *s = x;
+    *c = 1.0;
+    return;
+  }
+
+  double hi, lo;
+  int n = mu_rem_pio2(x, &hi, &lo);
+  double sin_r = mu_sin_kernel(hi, lo);
+  double cos_r = mu_cos_kernel(hi, lo);
+
+  *s = (n & 1) ? cos_r : sin_r;
+  *c = (n & 1) ? sin_r : cos_r;
+  if (n & 2) {
+    *s = -*s;
+  }
+  if ((n + 1) & 2) {
+    *c = -*c;
+  }
+}
+
+double mu_tan_d(double x) {
+  if (x != x || mu_fabs_d(x) == MU_INF) {
+    return MU_NAN;
+  }
+  if (mu_fabs_d(x) < MU_TRIG_TINY) {
+    return x;
+  }
+
+  double hi, lo;
+  int n = mu_rem_pio2(x, &hi, &lo);
+
+  return mu_tan_kernel(hi, lo, n & 1);
+}
+
+/*
+ * The π-scaled and degree functions reduce exactly, then share the kernels of
+ * sin, cos and tan. Results that are exact zeros get the signs of IEEE 754:
+ * adding 0.0 turns a -0 into +0 before the sign of `x` is applied to the odd
+ * functions.
+ */
+static double mu_sin_quadrant(int n, double hi, double lo, double x) {
+  double res = (n & 1) ? mu_cos_kernel(hi, lo) : mu_sin_kernel(hi, lo);
+  res = ((n & 2) ? -res : res) + 0.0;
+  return (mu_as_u64(x) >> 63) ? -res : res;
+}
+
+static double mu_cos_quadrant(int n, double hi, double lo) {
+  double res = (n & 1) ? mu_sin_kernel(hi, lo) : mu_cos_kernel(hi, lo);
+  return (((n + 1) & 2) ? -res : res) + 0.0;
+}
+
+/* Scales a tiny ax up by 2^120 and returns the factor for the odd results. */
+static double mu_tiny_scale(double *ax) {
+  if (*ax < MU_SCALED_TINY) {
+    *ax *= 0x1p120;
+    return 0x1p-120;
+  }
+  return 1.0;
+}
+
+double mu_sinpi_d(double x) {
+  double ax = mu_fabs_d(x);
+  if (!(ax < MU_INF)) {
+    return MU_NAN;
+  }
+
+  double scale = mu_tiny_scale(&ax);
+  double hi, lo;
+  int n = mu_rem_pi(ax, &hi, &lo);
+  return mu_sin_quadrant(n, hi, lo, x) * scale;
+}
+
+double mu_cospi_d(double x) {
+  double ax = mu_fabs_d(x);
+  if (!(ax < MU_INF)) {
+    return MU_NAN;
+  }
+
+  double hi, lo;
+  int n = mu_rem_pi(ax, &hi, &lo);
+  return mu_cos_quadrant(n, hi, lo);
+}
+
+void mu_sincospi_d(double x, double *s, double *c) {
+  double ax = mu_fabs_d(x);
+  if (!(ax < MU_INF)) {
+    *s = MU_NAN;
+    *c = MU_NAN;
+    return;
+  }
+
+  double scale = mu_tiny_scale(&ax);
+  double hi, lo;
+  int n = mu_rem_pi(ax, &hi, &lo);
+  *s = mu_sin_quadrant(n, hi, lo, x) * scale;
+  *c = mu_cos_quadrant(n, hi, lo);
+}
+
+double mu_tanpi_d(double x) {
+  double ax = mu_fabs_d(x);
+  if (!(ax < MU_INF)) {
+    return MU_NAN;
+  }
+
+  double scale = mu_tiny_scale(&ax);
+  double hi, lo;
+  int n = mu_rem_pi(ax, &hi, &lo);
+  double res = mu_tan_kernel(hi, lo, n & 1);
+  if (hi == 0.0) {
+    /* Multiples of 1/2: a pole of the sign of the side it is reached from. */
+    res = (n & 1) ? MU_INF : 0.0;
+    res = (n & 2) ? -res : res;
+  }
+  res *= scale;
+  return (mu_as_u64(x) >> 63) ? -res : res;
+}
+
+double mu_sind_d(double x) {
+  double ax = mu_fabs_d(x);
+  if (!(ax < MU_INF)) {
+    return MU_NAN;
+  }
+
+  double scale = mu_tiny_scale(&ax);
+  double hi, lo;
+  int n = mu_rem_90(ax, &hi, &lo);
+  return mu_sin_quadrant(n, hi, lo, x) * scale;
+}
+
+double mu_cosd_d(double x) {
+  double ax = mu_fabs_d(x);
+  if (!(ax < MU_INF)) {
+    return MU_NAN;
+  }
+
+  double hi, lo;
+  int n = mu_rem_90(ax, &hi, &lo);
+  return mu_cos_quadrant(n, hi, lo);
+}
+
+void mu_sincosd_d(double x, double *s, double *c) {
+  double ax = mu_fabs_d(x);
+  if (!(ax < MU_INF)) {
+    *s = MU_NAN;
+    *c = MU_NAN;
+    return;
+  }
+
+  double scale = mu_tiny_scale(&ax);
+  double hi, lo;
+  int n = mu_rem_90(ax, &hi, &lo);
+  *s = mu_sin_quadrant(n, hi, lo, x) * scale;
+  *c = mu_cos_quadrant(n, hi, lo);
+}
+
+double mu_asin_d(double x) {
+  MU_STATS_CALL(MU_STATS_ASIN, x);
+  if (x != x || mu_fabs_d(x) > 1.0) {
+    if (mu_fabs_d(x) < MU_INF) {
+      MU_STATS_EVENT(MU_STATS_ASIN, DOMAIN);
+    }
+    return MU_NAN;
+  }
+  if (mu_fabs_d(x) >= MU_ASIN_NEAR1) {
+    MU_STATS_EVENT(MU_STATS_ASIN, SLOW);
+  }
+
+  return mu_asin_kernel(x);
+}
+
+double mu_acos_d(double x) {
+  if (x != x || mu_fabs_d(x) > 1.0) {
+    return MU_NAN;
+  }
+
+  return mu_acos_kernel(x);
+}
+
+double mu_atan_d(double x) {
+  if (x != x) {
+    return MU_NAN;
+  }
+
+  return mu_atan_kernel(x);
+}
+
+double mu_atan2_d(double y, double x) { return mu_atan2_kernel(y, x); }
+
+double mu_sqrt_d(double x) {
+  MU_STATS_CALL(MU_STATS_SQRT, x);
+  if (x < 0 || x != x || x == MU_INF) {
+    if (x < 0 && x > -MU_INF) {
+      MU_STATS_EVENT(MU_STATS_SQRT, DOMAIN);
+    }
+    return MU_NAN;
+  }
+
+  if (x == 0.0) {
+    return x;
+  }
+  if (x < 0x1p-1022) {
+    MU_STATS_EVENT(MU_STATS_SQRT, SLOW);
+  }
+
+  return mu_sqrt_kernel(x);
+}
+
+double mu_rsqrt_d(double x) {
+  if (x < 0 || x != x) {
+    return MU_NAN;
+  }
+
+  if (x == 0.0) {
+    return 1.0 / x;
+  }
+
+  if (x == MU_INF) {
+    return 0.0;
+  }
+
+  /*
+   * Corrects 1 / s for the rounding of both the root and the division. Tiny
+   * inputs are scaled up first so that the error terms stay normal, and huge
+   * ones down so that s * s does not overflow.
+   */
+  double scale = 1.0;
+  if (x < 0x1p-968) {
+    x *= 0x1p104;
+    scale = 0x1p52;
+  } else if (x > 0x1p1020) {
+    x *= 0x1p-104;
+    scale = 0x1p-52;
+  }
+
+  double s = mu_sqrt_kernel(x);
+  double r = 1.0 / s;
+  double e;
+  double p = mu_two_prod(s, s, &e);
+  double ds = ((x - p) - e) * 0.5;
+  p = mu_two_prod(r, s, &e);
+  return (r + r * (((1.0 - p) - e) - ds * r * r)) * scale;
+}
+
+double mu_pow_d(double base, double exp) {
+  return mu_pow_kernel(base, exp, mu_pow_int_class(exp));
+}
+
+double mu_pow_apply_d(const mu_pow_plan *plan, double x) {
+  if (plan->kind == MU_POW_PLAN_EXP) {
+    return mu_pow_kernel(x, plan->value, plan->cls);
+  }
+
+  int cls = mu_pow_int_class(x);
+  if (plan->kind == MU_POW_PLAN_GENERIC) {
+    return mu_pow_kernel(plan->value, x, cls);
+  }
+
+  if (x == -1.0) {
+    return 1.0 / plan->value;
+  }
+
+  double res = mu_pow_core(plan->log_hi, plan->log_lo, x);
+  if (plan->value < 0) {
+    if (cls == MU_POW_NONINT && mu_fabs_d(x) < MU_INF) {
+      return MU_NAN;
+    }
+    if (cls == MU_POW_ODD) {
+      res = -res;
+    }
+  }
+
+  return res;
+}
+
+double mu_exp_d(double x) {
+  MU_STATS_CALL(MU_STATS_EXP, x);
+  if (x != x) {
+    return MU_NAN;
+  }
+  if (x > MU_EXP_OVERFLOW) {
+    if (x < MU_INF) {
+      MU_STATS_EVENT(MU_STATS_EXP, RANGE);
+    }
+    return MU_INF;
+  }
+  if (x < MU_EXP_UNDERFLOW) {
+    if (x > -MU_INF) {
+      MU_STATS_EVENT(MU_STATS_EXP, RANGE);
+    }
+    return 0.0;
+  }
+  if (x < MU_EXP_SUBNORMAL) {
+    MU_STATS_EVENT(MU_STATS_EXP, SLOW);
+  }
+
+  return mu_exp_kernel(x, 0.0);
+}
+
+double mu_log_d(double x) {
+  MU_STATS_CALL(MU_STATS_LOG, x);
+  if (x == 0.0) {
+    MU_STATS_EVENT(MU_STATS_LOG, RANGE);
+    return -MU_INF;
+  }
+  if (x < 0 || x != x) {
+    if (x < 0 && x > -MU_INF) {
+      MU_STATS_EVENT(MU_STATS_LOG, DOMAIN);
+    }
+    return MU_NAN;
+  }
+  if (x == MU_INF) {
+    return MU_INF;
+  }
+  if (x < 0x1p-1022) {
+    MU_STATS_EVENT(MU_STATS_LOG, SLOW);
+  }
+
+  return mu_log_kernel(x);
+}
+
+double mu_exp2_d(double x) {
+  if (x != x) {
+    return MU_NAN;
+  }
+  if (x > MU_EXP2_OVERFLOW) {
+    return MU_INF;
+  }
+  if (x < MU_EXP2_UNDERFLOW) {
+    return 0.0;
+  }
+
+  return mu_exp2_kernel(x);
+}
+
+/* e^(x * ln10) with the product split as in pow(), which brings the limits. */
+double mu_exp10_d(double x) { return mu_pow_core(MU_LN10_HI, MU_LN10_LO, x); }
+
+double mu_expm1_d(double x) {
+  if (mu_fabs_d(x) < MU_EXPM1_TINY || x != x) {
+    return x;
+  }
+  if (x > MU_EXP_OVERFLOW) {
+    return MU_INF;
+  }
+  if (x < MU_EXP_UNDERFLOW) {
+    return -1.0;
+  }
+
+  return mu_expm1_kernel(x);
+}
+
+double mu_log2_d(double x) {
+  if (x == 0.0) {
+    return -MU_INF;
+  }
+  if (x < 0 || x != x) {
+    return MU_NAN;
+  }
+  if (x == MU_INF) {
+    return MU_INF;
+  }
+
+  return mu_log_base_kernel(x, 1.0, 0.0, MU_INV_LN2_HI, MU_INV_LN2_LO);
+}
+
+double mu_log10_d(double x) {
+  if (x == 0.0) {
+    return -MU_INF;
+  }
+  if (x < 0 || x != x) {
+    return MU_NAN;
+  }
+  if (x == MU_INF) {
+    return MU_INF;
+  }
+
+  return mu_log_base_kernel(x, MU_LOG10_2_HI, MU_LOG10_2_LO, MU_INV_LN10_HI,
+                            MU_INV_LN10_LO);
+}
+
+double mu_log1p_d(double x) {
+  if (!(x > -1.0)) {
+    return x == -1.0 ? -MU_INF : MU_NAN;
+  }
+  if (x == MU_INF) {
+    return MU_INF;
+  }
+
+  return mu_log1p_kernel(x);
+}
+
+/*
+ * Scales in at most three exact steps. Downward steps stop 53 bits short of
+ * the subnormal range, so that only the last product rounds.
+ */
+double mu_ldexp_d(double x, int n) {
+  if (n > 1023) {
+    x *= 0x1p1023;
+    n -= 1023;
+    if (n > 1023) {
+      x *= 0x1p1023;
+      n -= 1023;
+      n = n > 1023 ? 1023 : n;
+    }
+  } else if (n < -1022) {
+    x *= 0x1p-969;
+    n += 969;
+    if (n < -1022) {
+      x *= 0x1p-969;
+      n += 969;
+      n = n < -1022 ? -1022 : n;
+    }
+  }
+  return x * mu_pow2(n);
+}
+
+/*
+ * The hyperbolic functions take a single exponential: e^|x| - 1 from
+ * mu_expm1_kernel(), which keeps small arguments free of cancellation, or
+ * e^|x| / 2 = e^(|x| - ln2) once e^-|x| no longer shows. The second form
+ * stays finite up to MU_HYP_OVERFLOW, past the overflow of e^|x| itself.
+ * Below 1, sinh is its own odd polynomial.
+ */
+static double mu_exp_half(double ax) {
+  double e;
+  double hi = mu_two_sum(ax, -MU_LN2_HI, &e);
+  return mu_exp_kernel(hi, e - MU_LN2_LO);
+}
+
+/* sinh and cosh of MU_HYP_TINY <= ax < MU_HYP_BIG from e = e^ax - 1. */
+static double mu_sinh_expm1(double e) { return 0.5 * (e + e / (e + 1.0)); }
+
+static double mu_cosh_expm1(double ax, double e) {
+  if (ax < MU_COSH_SMALL) {
+    return 1.0 + e * e / (2.0 * (1.0 + e));
+  }
+  double lo;
+  double t = mu_two_sum(e, 1.0, &lo);
+  return 0.5 * t + (0.5 * lo + 0.5 / t);
+}
+
+double mu_sinh_d(double x) {
+  double ax = mu_fabs_d(x);
+  if (ax < 1.0) {
+    return mu_sinh_small(x);
+  }
+  if (!(ax <= MU_HYP_OVERFLOW)) {
+    return x != x ? MU_NAN : mu_copysign_bits(MU_INF, x);
+  }
+
+  double res = ax < MU_HYP_BIG ? mu_sinh_expm1(mu_expm1_kernel(ax))
+                               : mu_exp_half(ax);
+  return mu_copysign_bits(res, x);
+}
+
+double mu_cosh_d(double x) {
+  double ax = mu_fabs_d(x);
+  if (ax < MU_HYP_TINY) {
+    return 1.0;
+  }
+  if (ax < MU_HYP_BIG) {
+    return mu_cosh_expm1(ax, mu_expm1_kernel(ax));
+  }
+  if (ax <= MU_HYP_OVERFLOW) {
+    return mu_exp_half(ax);
+  }
+  return x != x ? MU_NAN : MU_INF;
+}
+
+void mu_sinhcosh_d(double x, double *s, double *c) {
+  double ax = mu_fabs_d(x);
+  if (ax < MU_HYP_TINY) {
+    *s = x;
+    *c = 1.0;
+  } else if (ax < MU_HYP_BIG) {
+    double e = mu_expm1_kernel(ax);
+    *s = ax < 1.0 ? mu_sinh_small(x) : mu_copysign_bits(mu_sinh_expm1(e), x);
+    *c = mu_cosh_expm1(ax, e);
+  } else if (ax <= MU_HYP_OVERFLOW) {
+    double h = mu_exp_half(ax);
+    *s = mu_copysign_bits(h, x);
+    *c = h;
+  } else {
+    *s = x != x ? MU_NAN : mu_copysign_bits(MU_INF, x);
+    *c = x != x ? MU_NAN : MU_INF;
+  }
+}
+
+double mu_tanh_d(double x) {
+  double ax = mu_fabs_d(x);
+  if (ax < MU_HYP_TINY) {
+    return x;
+  }
+  if (x != x) {
+    return MU_NAN;
+  }
+
+  double res = 1.0;
+  if (ax < 1.0) {
+    double e = mu_expm1_kernel(-2.0 * ax);
+    res = -e / (e + 2.0);
+  } else if (ax < MU_HYP_BIG) {
+    double e = mu_expm1_kernel(2.0 * ax);
+    res = 1.0 - 2.0 / (e + 2.0);
+  }
+  return mu_copysign_bits(res, x);
+}
+
+/*
+ * The inverse functions use the logarithm in the forms of fdlibm: log1p near
+ * the origin, log of a rearranged sum in the middle and log(|x|) + ln2 where
+ * the square root no longer matters.
+ */
+double mu_asinh_d(double x) {
+  double ax = mu_fabs_d(x);
+  if (ax < MU_HYP_TINY || !(ax < MU_INF)) {
+    return x != x ? MU_NAN : x;
+  }
+
+  double res;
+  if (ax > 0x1p28) {
+    res = mu_log_sum_kernel(ax, MU_LN2_LO) + MU_LN2_HI;
+  } else if (ax > 2.0) {
+    res = mu_log_kernel(2.0 * ax + 1.0 / (mu_sqrt_kernel(ax * ax + 1.0) + ax));
+  } else {
+    double t = ax * ax;
+    res = mu_log1p_kernel(ax + t / (1.0 + mu_sqrt_kernel(1.0 + t)));
+  }
+  return mu_copysign_bits(res, x);
+}
+
+double mu_acosh_d(double x) {
+  if (!(x >= 1.0)) {
+    return MU_NAN;
+  }
+  if (x > 0x1p28) {
+    return x == MU_INF ? MU_INF : mu_log_sum_kernel(x, MU_LN2_LO) + MU_LN2_HI;
+  }
+  if (x > 2.0) {
+    return mu_log_kernel(2.0 * x - 1.0 / (x + mu_sqrt_kernel(x * x - 1.0)));
+  }
+  double t = x - 1.0;
+  return mu_log1p_kernel(t + mu_sqrt_kernel(2.0 * t + t * t));
+}
+
+double mu_atanh_d(double x) {
+  double ax = mu_fabs_d(x);
+  if (!(ax < 1.0)) {
+    return ax == 1.0 ? mu_copysign_bits(MU_INF, x) : MU_NAN;
+  }
+  if (ax < MU_HYP_TINY) {
+    return x;
+  }
+
+  double res;
+  if (ax < 0.5) {
+    double t = ax + ax;
+    res = 0.5 * mu_log1p_kernel(t + t * ax / (1.0 - ax));
+  } else {
+    res = 0.5 * mu_log1p_kernel((ax + ax) / (1.0 - ax));
+  }
+  return mu_copysign_bits(res, x);
+}
@@ -0,0 +1,286 @@
+#include "math_utils.h"
+#include "math_utils_internal.h"
+
+/*
+ * Single-precision tier. Kernels evaluate in float with polynomials sized for
+ * a 24-bit mantissa; only the trigonometric reduction and mu_powf() go
+ * through double.
+ */
+
+float mu_fabsf(float x) { return mu_fabsf_bits(x); }
+
+float mu_truncf(float x) {
+#if defined(__SSE4_1__)
+  return MU_ROUND_SS(x, _MM_FROUND_TO_ZERO);
+#else
+  uint32_t u = mu_as_u32(x);
+  int frac = 150 - (int)((u >> 23) & 0xff);
+  frac = frac < 0 ? 0 : frac;
+  frac = frac > 23 ? 31 : frac;
+  return mu_as_f32(u & (~0U << frac));
+#endif
+}
+
+float mu_ceilf(float x) {
+#if defined(__SSE4_1__)
+  return MU_ROUND_SS(x, _MM_FROUND_TO_POS_INF);
+#else
+  float t = mu_truncf(x);
+  return mu_fcopysign_bits(t + (float)(t < x), x);
+#endif
+}
+
+float mu_floorf(float x) {
+#if defined(__SSE4_1__)
+  return MU_ROUND_SS(x, _MM_FROUND_TO_NEG_INF);
+#else
+  float t = mu_truncf(x);
+  return t - (float)(t > x);
+#endif
+}
+
+float mu_roundf(float x) {
+  float t = mu_truncf(x);
+  float half = (float)(mu_fabsf_bits(x - t) >= 0.5f);
+  return t + mu_fcopysign_bits(half, x);
+}
+
+float mu_nearbyintf(float x) {
+#if defined(__SSE4_1__)
+  return MU_ROUND_SS(x, _MM_FROUND_CUR_DIRECTION);
+#else
+  float shift = mu_fcopysign_bits(MU_TWO23F, x);
+  float r = mu_fcopysign_bits((x + shift) - shift, x);
+  return mu_fabsf_bits(x) < MU_TWO23F ? r : x;
+#endif
+}
+
+float mu_modff(float x, float *iptr) {
+  float t = mu_truncf(x);
+  *iptr = t;
+  float frac = mu_fabsf_bits(x) == MU_INF ? 0.0f : x - t;
+  return mu_fcopysign_bits(frac, x);
+}
+
+long int mu_lroundf(float x) { return mu_lround(x); }
+
+float mu_fmodf(float x, float y) { return (float)mu_fmod_d(x, y); }
+
+float mu_remainderf(float x, float y) { return (float)mu_remainder_d(x, y); }
+
+float mu_remquof(float x, float y, int *quo) {
+  return (float)mu_remquo_d(x, y, quo);
+}
+
+float mu_sinf(float x) {
+  if (x != x || mu_fabsf_bits(x) == MU_INF) {
+    return MU_NAN;
+  }
+
+  float r;
+  int n = mu_rem_pio2f(x, &r);
+  float res = (n & 1) ? mu_cosf_kernel(r) : mu_sinf_kernel(r);
+
+  return (n & 2) ? -res : res;
+}
+
+float mu_cosf(float x) {
+  if (x != x || mu_fabsf_bits(x) == MU_INF) {
+    return MU_NAN;
+  }
+
+  float r;
+  int n = mu_rem_pio2f(x, &r);
+  float res = (n & 1) ? mu_sinf_kernel(r) : mu_cosf_kernel(r);
+
+  return ((n + 1) & 2) ? -res : res;
+}
+
+void mu_sincosf(float x, float *s, float *c) {
+  if (x != x || mu_fabsf_bits(x) == MU_INF) {
+    *s = MU_NAN;
+    *c = MU_NAN;
+    return;
+  }
+
+  float r;
+  int n = mu_rem_pio2f(x, &r);
+  float sin_r = mu_sinf_kernel(r);
+  float cos_r = mu_cosf_kernel(r);
+
+  *s = (n & 1) ? cos_r : sin_r;
+  *c = (n & 1) ? sin_r : cos_r;
+  if (n & 2) {
+    *s = -*s;
+  }
+  if ((n + 1) & 2) {
+    *c = -*c;
+  }
+}
+
+float mu_tanf(float x) {
+  if (x != x || mu_fabsf_bits(x) == MU_INF) {
+    return MU_NAN;
+  }
+
+  float r;
+  int n = mu_rem_pio2f(x, &r);
+
+  return mu_tanf_kernel(r, n & 1);
+}
+
+/* The π-scaled and degree forms run in double, where the reduction is free. */
+float mu_sinpif(float x) { return (float)mu_sinpi_d(x); }
+
+float mu_cospif(float x) { return (float)mu_cospi_d(x); }
+
+void mu_sincospif(float x, float *s, float *c) {
+  double sin_r, cos_r;
+  mu_sincospi_d(x, &sin_r, &cos_r);
+  *s = (float)sin_r;
+  *c = (float)cos_r;
+}
+
+float mu_tanpif(float x) { return (float)mu_tanpi_d(x); }
+
+float mu_sindf(float x) { return (float)mu_sind_d(x); }
+
+float mu_cosdf(float x) { return (float)mu_cosd_d(x); }
+
+void mu_sincosdf(float x, float *s, float *c) {
+  double sin_r, cos_r;
+  mu_sincosd_d(x, &sin_r, &cos_r);
+  *s = (float)sin_r;
+  *c = (float)cos_r;
+}
+
+float mu_asinf(float x) {
+  if (x != x || mu_fabsf_bits(x) > 1.0f) {
+    return MU_NAN;
+  }
+
+  return mu_asinf_kernel(x);
+}
+
+float mu_acosf(float x) {
+  if (x != x || mu_fabsf_bits(x) > 1.0f) {
+    return MU_NAN;
+  }
+
+  return mu_acosf_kernel(x);
+}
+
+float mu_atanf(float x) {
+  if (x != x) {
+    return MU_NAN;
+  }
+
+  return mu_atanf_kernel(x);
+}
+
+float mu_atan2f(float y, float x) { return mu_atan2f_kernel(y, x); }
+
+float mu_sqrtf(float x) {
+  if (x < 0 || x != x || x == MU_INF) {
+    return MU_NAN;
+  }
+
+  if (x == 0.0f) {
+    return x;
+  }
+
+  /* The double root of a float rounds correctly to float. */
+  return (float)mu_sqrt_kernel(x);
+}
+
+float mu_rsqrtf(float x) {
+  if (x < 0 || x != x) {
+    return MU_NAN;
+  }
+
+  if (x == 0.0f) {
+    return 1.0f / x;
+  }
+
+  if (x == MU_INF) {
+    return 0.0f;
+  }
+
+  return 1.0f / (float)mu_sqrt_kernel(x);
+}
+
+float mu_powf(float base, float exp) {
+  return (float)mu_pow_kernel(base, exp, mu_pow_int_class(exp));
+}
+
+float mu_expf(float x) {
+  if (x != x) {
+    return MU_NAN;
+  }
+  if (x > MU_EXPF_OVERFLOW) {
+    return MU_INF;
+  }
+  if (x < MU_EXPF_UNDERFLOW) {
+    return 0.0f;
+  }
+
+  return mu_expf_kernel(x);
+}
+
+float mu_logf(float x) {
+  if (x == 0.0f) {
+    return -MU_INF;
+  }
+  if (x < 0 || x != x) {
+    return MU_NAN;
+  }
+  if (x == MU_INF) {
+    return MU_INF;
+  }
+
+  return mu_logf_kernel(x);
+}
+
+/*
+ * The other bases and the forms near zero run in double like the hyperbolic
+ * functions below.
+ */
+float mu_exp2f(float x) { return (float)mu_exp2_d(x); }
+
+float mu_exp10f(float x) { return (float)mu_exp10_d(x); }
+
+float mu_expm1f(float x) { return (float)mu_expm1_d(x); }
+
+float mu_log2f(float x) { return (float)mu_log2_d(x); }
+
+float mu_log10f(float x) { return (float)mu_log10_d(x); }
+
+float mu_log1pf(float x) { return (float)mu_log1p_d(x); }
+
+int mu_ilogbf(float x) { return mu_ilogb(x); }
+
+/* Exact in double for every result a float can hold, so one rounding. */
+float mu_ldexpf(float x, int n) { return (float)mu_ldexp_d(x, n); }
+
+/*
+ * The hyperbolic functions run in double, where their single exponential or
+ * logarithm leaves the float result correctly rounded in practice.
+ */
+float mu_sinhf(float x) { return (float)mu_sinh_d(x); }
+
+float mu_coshf(float x) { return (float)mu_cosh_d(x); }
+
+void mu_sinhcoshf(float x, float *s, float *c) {
+  double sinh_r, cosh_r;
+  mu_sinhcosh_d(x, &sinh_r, &cosh_r);
+  *s = (float)sinh_r;
+  *c = (float)cosh_r;
+}
+
+float mu_tanhf(float x) { return (float)mu_tanh_d(x); }
+
+float mu_asinhf(float x) { return (float)mu_asinh_d(x); }
+
+float mu_acoshf(float x) { return (float)mu_acosh_d(x); }
+
+float mu_atanhf(float x) { return (float)mu_atanh_d(x); }
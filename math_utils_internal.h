@@ -0,0 +1,1588 @@
+#ifndef MATH_MATH_UTILS_INTERNAL_H_
+#define MATH_MATH_UTILS_INTERNAL_H_
+
+#include <stdint.h>
+#include <string.h>
+
+#include "math_utils.h"
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+#if defined(__SSE4_1__)
+#include <smmintrin.h>
+#endif
+
+/*
+ * Internal helpers shared by the scalar and the batch translation units.
+ * Nothing in this header is part of the public API.
+ */
+
+#define MU_TWO52 4503599627370496.0
+#define MU_ROUND_SHIFT 6755399441055744.0
+
+/*
+ * 2/π and π/2 split into three 33-bit parts plus a 53-bit tail, so that
+ * n * MU_PIO2_1..3 are exact for every quadrant number n < 2^20.
+ */
+#define MU_INV_PIO2 6.36619772367581382433e-01
+#define MU_PIO2_1 1.57079632673412561417e+00
+#define MU_PIO2_2 6.07710050630396597660e-11
+#define MU_PIO2_3 2.02226624871116645580e-21
+#define MU_PIO2_3T 8.47842766036889956997e-32
+#define MU_PIO2_HI 1.57079632679489655800e+00
+#define MU_PIO2_LO 6.12323399573676603587e-17
+
+/* Largest magnitude reduced with the Cody-Waite constants above. */
+#define MU_PIO2_MEDIUM 0x1p20
+/* sin(x) and tan(x) round to x itself below MU_TRIG_TINY in magnitude. */
+#define MU_TRIG_TINY 0x1p-27
+
+/*
+ * π/180 as a double plus a tail, and the largest magnitude that mu_rem_90()
+ * reduces without mu_fmod_kernel(): below it n * 90 is exact.
+ */
+#define MU_PIO180_HI 1.74532925199432954744e-02
+#define MU_PIO180_LO 2.94865227087016868684e-19
+#define MU_REM90_MEDIUM 0x1p46
+/*
+ * Below MU_SCALED_TINY the error term of the product by π or π/180 would be
+ * subnormal, so sinpi, tanpi and sind scale the argument by 2^120 and their
+ * result back. Rounding the scaled result into the subnormal range then adds
+ * at most 0.25 ULP, the same in every batch variant.
+ */
+#define MU_SCALED_TINY 0x1p-960
+
+/* Minimax coefficients of sin(x) on [-π/4, π/4] (degree 13). */
+#define MU_SIN_S1 -1.66666666666666324348e-01
+#define MU_SIN_S2 8.33333333332248946124e-03
+#define MU_SIN_S3 -1.98412698298579493134e-04
+#define MU_SIN_S4 2.75573137070700676789e-06
+#define MU_SIN_S5 -2.50507602534068634195e-08
+#define MU_SIN_S6 1.58969099521155010221e-10
+
+/* Minimax coefficients of cos(x) on [-π/4, π/4] (degree 14). */
+#define MU_COS_C1 4.16666666666666019037e-02
+#define MU_COS_C2 -1.38888888888741095749e-03
+#define MU_COS_C3 2.48015872894767294178e-05
+#define MU_COS_C4 -2.75573143513906633035e-07
+#define MU_COS_C5 2.08757232129817482790e-09
+#define MU_COS_C6 -1.13596475577881948265e-11
+
+/*
+ * Rational minimax approximation of tan(x) on [-π/4, π/4]:
+ * tan(x) = x + x^3 P(x^2) / Q(x^2), Q monic.
+ */
+#define MU_TAN_P0 -1.30936939181383777646e+04
+#define MU_TAN_P1 1.15351664838587416140e+06
+#define MU_TAN_P2 -1.79565251976484877988e+07
+#define MU_TAN_Q1 1.36812963470692954678e+04
+#define MU_TAN_Q2 -1.32089234440210967447e+06
+#define MU_TAN_Q3 2.50083801823357915839e+07
+#define MU_TAN_Q4 -5.38695755929454629881e+07
+
+/*
+ * exp(x) is evaluated as 2^k * 2^(j/N) * e^r with x = (k * N + j) * ln2/N + r
+ * and |r| <= ln2/(2N). ln2/N is split so that kd * MU_EXP_LN2HI_N is exact
+ * for the whole finite domain.
+ */
+#define MU_EXP_TABLE_BITS 7
+#define MU_EXP_N (1 << MU_EXP_TABLE_BITS)
+#define MU_EXP_INV_LN2N 184.6649652337873
+#define MU_EXP_LN2HI_N 0x1.62e42fef80000p-8
+#define MU_EXP_LN2LO_N 0x1.1cf79abc9e3b4p-43
+#define MU_EXP_C2 0.5
+#define MU_EXP_C3 0.16666666666666666
+#define MU_EXP_C4 0.041666666666666664
+#define MU_EXP_C5 0.008333333333333333
+
+/*
+ * exp2(x) splits x = (k * N + j) / N + r exactly, so that only e^(r * ln2)
+ * needs the polynomial; exp10(x) takes e^(x * ln10) with the product carried
+ * as a double-double.
+ */
+#define MU_EXP2_LN2 0x1.62e42fefa39efp-1
+#define MU_LN10_HI 0x1.26bb1bbb55516p+1
+#define MU_LN10_LO -0x1.f48ad494ea3e9p-53
+
+/* sinh() takes its odd Taylor series below 1, to 1/21!. */
+#define MU_SINH_C3 0.16666666666666666
+#define MU_SINH_C5 0.008333333333333333
+#define MU_SINH_C7 0.0001984126984126984
+#define MU_SINH_C9 2.7557319223985893e-06
+#define MU_SINH_C11 2.505210838544172e-08
+#define MU_SINH_C13 1.6059043836821613e-10
+#define MU_SINH_C15 7.647163731819816e-13
+#define MU_SINH_C17 2.8114572543455206e-15
+#define MU_SINH_C19 8.22063524662433e-18
+#define MU_SINH_C21 1.9572941063391263e-20
+
+/*
+ * expm1() takes the Taylor series below MU_EXPM1_SMALL in magnitude, to 1/10!,
+ * and rounds to `x` itself below MU_EXPM1_TINY.
+ */
+#define MU_EXPM1_SMALL 0x1p-4
+#define MU_EXPM1_TINY 0x1p-54
+#define MU_EXPM1_C6 0.001388888888888889
+#define MU_EXPM1_C7 0.0001984126984126984
+#define MU_EXPM1_C8 2.48015873015873e-05
+#define MU_EXPM1_C9 2.7557319223985893e-06
+#define MU_EXPM1_C10 2.755731922398589e-07
+
+/* exp(x) overflows above MU_EXP_OVERFLOW and rounds to zero below
+ * MU_EXP_UNDERFLOW. */
+#define MU_EXP_OVERFLOW 709.782712893383973096
+#define MU_EXP_UNDERFLOW -745.133219101941108420
+/* Below this exp(x) is subnormal: log(0x1p-1022). */
+#define MU_EXP_SUBNORMAL -708.396418532264106224
+/* The same thresholds for exp2(x). */
+#define MU_EXP2_OVERFLOW 1024.0
+#define MU_EXP2_UNDERFLOW -1075.0
+#define MU_EXP2_SUBNORMAL -1022.0
+
+/*
+ * The hyperbolic functions equal x (1 for cosh) below MU_HYP_TINY. From
+ * MU_HYP_BIG on, e^-|x| is below half an ULP of e^|x|; sinh and cosh overflow
+ * above MU_HYP_OVERFLOW = log(2 * DBL_MAX). cosh switches from its expm1 form
+ * at MU_COSH_SMALL = ln2 / 2.
+ */
+#define MU_HYP_TINY 0x1p-28
+#define MU_HYP_BIG 22.0
+#define MU_HYP_OVERFLOW 710.475860073943942042
+#define MU_COSH_SMALL 0.346573590279972654709
+
+extern const double mu_exp_table[2 * MU_EXP_N];
+
+/*
+ * log(x) is evaluated as k * ln2 + log(c) + log1p((z - c) / c) with
+ * x = z * 2^k, z in [0x1.6p-1, 0x1.6p+0) and c the midpoint of one of
+ * MU_LOG_N subintervals, so |(z - c) / c| < 2^-8. MU_LN2_HI has trailing zero
+ * bits, which keeps k * MU_LN2_HI exact.
+ */
+#define MU_LOG_TABLE_BITS 7
+#define MU_LOG_N (1 << MU_LOG_TABLE_BITS)
+#define MU_LOG_OFF 0x3fe6000000000000ULL
+#define MU_LN2_HI 6.93147180369123816490e-01
+#define MU_LN2_LO 1.90821492927058770002e-10
+#define MU_LOG_C2 -0.5
+#define MU_LOG_C3 0.33333333333333331
+#define MU_LOG_C4 -0.25
+#define MU_LOG_C5 0.2
+#define MU_LOG_C6 -0.16666666666666666
+#define MU_LOG_C7 0.14285714285714285
+
+/*
+ * Inputs within 2^-5 of 1 skip the table: log1p(f) = 2 atanh(s) with
+ * s = f / (2 + f), and the series of atanh in s^2 up to s^9.
+ */
+#define MU_LOG_NEAR1_LO 0x3fef000000000000ULL
+#define MU_LOG_NEAR1_HI 0x3ff0800000000000ULL
+#define MU_LOG_S1 0.66666666666666663
+#define MU_LOG_S2 0.4
+#define MU_LOG_S3 0.2857142857142857
+#define MU_LOG_S4 0.22222222222222221
+#define MU_LOG_S5 0.18181818181818182
+#define MU_LOG_S6 0.15384615384615385
+
+extern const double mu_log_table[4 * MU_LOG_N];
+
+/*
+ * log2 and log10 scale the reduced logarithm by 1/ln(b) and add
+ * k * log_b(2); both factors are split in two, and MU_LOG10_2_HI has trailing
+ * zero bits so that k * MU_LOG10_2_HI is exact.
+ */
+#define MU_INV_LN2_HI 0x1.71547652b82fep+0
+#define MU_INV_LN2_LO 0x1.777d0ffda0d24p-56
+#define MU_INV_LN10_HI 0x1.bcb7b1526e50ep-2
+#define MU_INV_LN10_LO 0x1.95355baaafad3p-57
+#define MU_LOG10_2_HI 0x1.34413509f8p-2
+#define MU_LOG10_2_LO -0x1.80433b83b532ap-44
+
+/*
+ * Table entry holding z = 1. mu_log_dd() replaces it and the entry below with
+ * c = 1, so that log(x) near 1 comes out without cancellation.
+ */
+#define MU_LOG_ONE_IDX \
+  ((int)(((0x3ff0000000000000ULL - MU_LOG_OFF) >> (52 - MU_LOG_TABLE_BITS)) & \
+         (MU_LOG_N - 1)))
+
+/*
+ * Taylor coefficients of log1p(u) from u^3 to u^10, enough for |u| <= 2^-7
+ * with a relative error below 2^-73.
+ */
+#define MU_LOG_DD_C3 0.33333333333333331
+#define MU_LOG_DD_C4 -0.25
+#define MU_LOG_DD_C5 0.2
+#define MU_LOG_DD_C6 -0.16666666666666666
+#define MU_LOG_DD_C7 0.14285714285714285
+#define MU_LOG_DD_C8 -0.125
+#define MU_LOG_DD_C9 0.11111111111111111
+#define MU_LOG_DD_C10 -0.1
+
+/* Classes of a pow() exponent returned by mu_pow_int_class(). */
+#define MU_POW_NONINT 0
+#define MU_POW_EVEN 1
+#define MU_POW_ODD 2
+
+/* Kinds of a mu_pow_plan. */
+#define MU_POW_PLAN_GENERIC 0
+#define MU_POW_PLAN_BASE 1
+#define MU_POW_PLAN_EXP 2
+
+/*
+ * Seed for 1/sqrt(x) without a hardware square root: halving the biased
+ * exponent bits and subtracting from this constant gives a first estimate
+ * within 3.5% of the true value over every binade.
+ */
+#define MU_RSQRT_MAGIC 0x5fe6eb50c7b537a9ULL
+
+#define MU_PI_HI 3.14159265358979311600e+00
+#define MU_PI_LO 1.22464679914735317720e-16
+#define MU_PIO4_HI 7.85398163397448278999e-01
+
+/*
+ * Rational minimax approximation of asin(x) on [0, 0.5]:
+ * asin(x) = x + x * t * P(t) / Q(t) with t = x^2.
+ */
+#define MU_ASIN_P0 1.66666666666666657415e-01
+#define MU_ASIN_P1 -3.25565818622400915405e-01
+#define MU_ASIN_P2 2.01212532134862925881e-01
+#define MU_ASIN_P3 -4.00555345006794114027e-02
+#define MU_ASIN_P4 7.91534994289814532176e-04
+#define MU_ASIN_P5 3.47933107596021167570e-05
+#define MU_ASIN_Q1 -2.40339491173441421878e+00
+#define MU_ASIN_Q2 2.02094576023350569471e+00
+#define MU_ASIN_Q3 -6.88283971605453293030e-01
+#define MU_ASIN_Q4 7.70381505559019352791e-02
+
+/* Above this magnitude asin(x) drops the split of sqrt((1 - |x|) / 2). */
+#define MU_ASIN_NEAR1 0.975
+
+/*
+ * Minimax coefficients of atan(x) on [-7/16, 7/16] (degree 23), and the
+ * breakpoints of the reduction atan(x) = atan(c) + atan((x - c) / (1 + c x)).
+ */
+#define MU_ATAN_T0 3.33333333333329318027e-01
+#define MU_ATAN_T1 -1.99999999998764832476e-01
+#define MU_ATAN_T2 1.42857142725034663711e-01
+#define MU_ATAN_T3 -1.11111104054623557880e-01
+#define MU_ATAN_T4 9.09088713343650656196e-02
+#define MU_ATAN_T5 -7.69187620504482999495e-02
+#define MU_ATAN_T6 6.66107313738753120669e-02
+#define MU_ATAN_T7 -5.83357013379057348645e-02
+#define MU_ATAN_T8 4.97687799461593236017e-02
+#define MU_ATAN_T9 -3.65315727442169155270e-02
+#define MU_ATAN_T10 1.62858201153657823623e-02
+#define MU_ATAN_B0 0.4375
+#define MU_ATAN_B1 0.6875
+#define MU_ATAN_B2 1.1875
+#define MU_ATAN_B3 2.4375
+
+extern const double mu_atan_table[8];
+
+static inline uint64_t mu_as_u64(double x) {
+  uint64_t u;
+  memcpy(&u, &x, sizeof(u));
+  return u;
+}
+
+static inline double mu_as_f64(uint64_t u) {
+  double x;
+  memcpy(&x, &u, sizeof(x));
+  return x;
+}
+
+static inline double mu_copysign_bits(double mag, double sgn) {
+  return mu_as_f64((mu_as_u64(mag) & 0x7fffffffffffffffULL) |
+                   (mu_as_u64(sgn) & 0x8000000000000000ULL));
+}
+
+/*
+ * Rounds to an integer in an _MM_FROUND_* direction with roundsd/roundss,
+ * where SSE4.1 is enabled.
+ */
+#if defined(__SSE4_1__)
+#define MU_ROUND_SD(x, mode)                                        \
+  _mm_cvtsd_f64(_mm_round_sd(_mm_setzero_pd(), _mm_set_sd(x),       \
+                             (mode) | _MM_FROUND_NO_EXC))
+#define MU_ROUND_SS(x, mode)                                        \
+  _mm_cvtss_f32(_mm_round_ss(_mm_setzero_ps(), _mm_set_ss(x),       \
+                             (mode) | _MM_FROUND_NO_EXC))
+#endif
+
+/*
+ * 2^e for a normal exponent -1022 <= e <= 1023.
+ */
+static inline double mu_pow2(int e) {
+  return mu_as_f64((uint64_t)(e + 1023) << 52);
+}
+
+/*
+ * Error-free transformation: s + e == a + b exactly, for any ordering of the
+ * magnitudes of `a` and `b`.
+ */
+static inline double mu_two_sum(double a, double b, double *e) {
+  double s = a + b;
+  double bb = s - a;
+  *e = (a - (s - bb)) + (b - bb);
+  return s;
+}
+
+/*
+ * Error-free product: p + e == a * b exactly. Uses the FMA instruction where
+ * the target has one, since the compiler may otherwise contract Dekker's
+ * algorithm; elsewhere Dekker's algorithm with a Veltkamp split.
+ */
+static inline double mu_two_prod(double a, double b, double *e) {
+  double p = a * b;
+#if defined(__FMA__) || defined(__AVX512F__)
+  *e = __builtin_fma(a, b, -p);
+#else
+  double as = a * 134217729.0;
+  double bs = b * 134217729.0;
+  double ah = as - (as - a);
+  double bh = bs - (bs - b);
+  double al = a - ah;
+  double bl = b - bh;
+  *e = ((ah * bh - p) + ah * bl + al * bh) + al * bl;
+#endif
+  return p;
+}
+
+/*
+ * Bounds of the divisor in fmod's fast path, where the error-free product of
+ * the quotient and the divisor neither overflows nor underflows.
+ */
+#define MU_FMOD_FAST_MIN 0x1p-900
+#define MU_FMOD_FAST_MAX 0x1p900
+
+/*
+ * fmod(ax, ay) for finite ax >= 0 and finite ay > 0, exactly, with the low
+ * 64 bits of the integer quotient in `q`.
+ *
+ * The mantissas are divided as integers, 11 bits of the exponent difference
+ * per step, so close exponents take a single division. Quotients between
+ * 2^11 and 2^52 take the floating-point path instead: n = trunc(ax / ay) is
+ * at most one too large, and ax - n * ay is a multiple of the unit of `ay`
+ * below `ay`, so the error-free product gives it exactly.
+ */
+static inline double mu_fmod_kernel(double ax, double ay, uint64_t *q) {
+  uint64_t ux = mu_as_u64(ax);
+  uint64_t uy = mu_as_u64(ay);
+  *q = 0;
+  if (ux < uy) {
+    return ax;
+  }
+  if ((ux >> 52) - (uy >> 52) > 11 && ay >= MU_FMOD_FAST_MIN &&
+      ay < MU_FMOD_FAST_MAX && ax < ay * 0x1p52) {
+    double v = ax / ay;
+    double n = (v + MU_TWO52) - MU_TWO52;
+    n -= (double)(n > v);
+    double e;
+    double p = mu_two_prod(n, ay, &e);
+    double r = (ax - p) - e;
+    if (r < 0.0) {
+      r += ay;
+      n -= 1.0;
+    }
+    *q = (uint64_t)n;
+    return r;
+  }
+
+  /* ax = mx * 2^(ex - 1075) and ay = my * 2^(ey - 1075), mx and my in
+   * [2^52, 2^53). */
+  int ex = (int)(ux >> 52);
+  int ey = (int)(uy >> 52);
+  uint64_t mx = (ux & 0x000fffffffffffffULL) | 0x0010000000000000ULL;
+  uint64_t my = (uy & 0x000fffffffffffffULL) | 0x0010000000000000ULL;
+  if (ex == 0) {
+    int s = __builtin_clzll(ux) - 11;
+    mx = ux << s;
+    ex = 1 - s;
+  }
+  if (ey == 0) {
+    int s = __builtin_clzll(uy) - 11;
+    my = uy << s;
+    ey = 1 - s;
+  }
+
+  uint64_t quo = 0;
+  int d = ex - ey;
+  for (; d > 11; d -= 11) {
+    uint64_t t = mx << 11;
+    quo = (quo << 11) + t / my;
+    mx = t % my;
+  }
+  uint64_t t = mx << d;
+  *q = (quo << d) + t / my;
+  mx = t % my;
+  if (mx == 0) {
+    return 0.0;
+  }
+
+  /* The remainder is a multiple of the unit of `ay`, so it fits exactly. */
+  int s = __builtin_clzll(mx) - 11;
+  mx <<= s;
+  ey -= s;
+  if (ey <= 0) {
+    return mu_as_f64(mx >> (1 - ey));
+  }
+  return mu_as_f64(((uint64_t)ey << 52) | (mx & 0x000fffffffffffffULL));
+}
+
+/**
+ * @brief Payne-Hanek reduction of a finite |x| >= MU_PIO2_MEDIUM.
+ *
+ * Computes x = n * π/2 + (hi + lo) with |hi + lo| <= π/4, using as many bits
+ * of 2/π as the exponent of `x` requires.
+ *
+ * @return Quadrant number n; only its two low bits are meaningful.
+ */
+int mu_rem_pio2_large(double x, double *hi, double *lo);
+
+/**
+ * @brief Reduces `x` to [-π/4, π/4] and returns the quadrant.
+ *
+ * Medium arguments use a four-part Cody-Waite reduction, huge arguments fall
+ * back to mu_rem_pio2_large(). `x` must be finite.
+ */
+static inline int mu_rem_pio2(double x, double *hi, double *lo) {
+  if (x > -MU_PIO2_MEDIUM && x < MU_PIO2_MEDIUM) {
+    double fn = (x * MU_INV_PIO2 + MU_ROUND_SHIFT) - MU_ROUND_SHIFT;
+    double r = x - fn * MU_PIO2_1;
+    double e1, e2;
+    double s = mu_two_sum(r, -fn * MU_PIO2_2, &e1);
+    s = mu_two_sum(s, -fn * MU_PIO2_3, &e2);
+    *hi = mu_two_sum(s, (e1 + e2) - fn * MU_PIO2_3T, lo);
+    return (int)fn;
+  }
+  return mu_rem_pio2_large(x, hi, lo);
+}
+
+/*
+ * Shorter form of mu_rem_pio2() for results that need about 60 bits: three
+ * Cody-Waite parts without the compensated sums, and no tail.
+ */
+static inline int mu_rem_pio2_short(double x, double *r) {
+  if (x > -MU_PIO2_MEDIUM && x < MU_PIO2_MEDIUM) {
+    double fn = (x * MU_INV_PIO2 + MU_ROUND_SHIFT) - MU_ROUND_SHIFT;
+    *r = ((x - fn * MU_PIO2_1) - fn * MU_PIO2_2) - fn * MU_PIO2_3;
+    return (int)fn;
+  }
+
+  double lo;
+  return mu_rem_pio2_large(x, r, &lo);
+}
+
+/*
+ * Reduces a finite ax >= 0 for the π-scaled functions: ax = n / 2 + r with
+ * |r| <= 1/4, and hi + lo = π * r. Subtracting the nearest multiple of 4,
+ * found by rounding at 2^54, is exact for every magnitude, so the product by
+ * π is the only rounding. Only the two low bits of n are meaningful.
+ */
+static inline int mu_rem_pi(double ax, double *hi, double *lo) {
+  double a = ax - ((ax + 0x1p54) - 0x1p54);
+  double fn = (2.0 * a + MU_ROUND_SHIFT) - MU_ROUND_SHIFT;
+  double r = a - 0.5 * fn;
+  *hi = mu_two_prod(r, MU_PI_HI, lo);
+  *lo += r * MU_PI_LO;
+  return (int)fn;
+}
+
+/*
+ * Degree form of mu_rem_pi(): ax = n * 90 + r with |r| <= 45, and
+ * hi + lo = r * π/180. The remainder is exact; huge arguments take it from
+ * mu_fmod_kernel().
+ */
+static inline int mu_rem_90(double ax, double *hi, double *lo) {
+  double r;
+  int n;
+  if (ax < MU_REM90_MEDIUM) {
+    double fn = (ax * (1.0 / 90.0) + MU_ROUND_SHIFT) - MU_ROUND_SHIFT;
+    r = ax - fn * 90.0;
+    n = (int)((int64_t)fn & 3);
+  } else {
+    uint64_t q;
+    r = mu_fmod_kernel(ax, 90.0, &q);
+    n = (int)(q & 3);
+    if (r > 45.0) {
+      r -= 90.0;
+      ++n;
+    }
+  }
+  *hi = mu_two_prod(r, MU_PIO180_HI, lo);
+  *lo += r * MU_PIO180_LO;
+  return n;
+}
+
+/*
+ * sin(x + y) for |x| <= π/4, where y is the tail of the reduced argument.
+ */
+static inline double mu_sin_kernel(double x, double y) {
+  double z = x * x;
+  double v = z * x;
+  double r = MU_SIN_S2 +
+             z * (MU_SIN_S3 +
+                  z * (MU_SIN_S4 + z * (MU_SIN_S5 + z * MU_SIN_S6)));
+  return x - ((z * (0.5 * y - v * r) - y) - v * MU_SIN_S1);
+}
+
+/*
+ * cos(x + y) for |x| <= π/4, where y is the tail of the reduced argument.
+ */
+static inline double mu_cos_kernel(double x, double y) {
+  double z = x * x;
+  double r =
+      z * (MU_COS_C1 +
+           z * (MU_COS_C2 +
+                z * (MU_COS_C3 +
+                     z * (MU_COS_C4 +
+                          z * (MU_COS_C5 + z * MU_COS_C6)))));
+  double hz = 0.5 * z;
+  double w = 1.0 - hz;
+  return w + (((1.0 - w) - hz) + (z * r - x * y));
+}
+
+/*
+ * tan(x + y) for |x| <= π/4, or -cot(x + y) when `odd` is set, which is the
+ * tangent in odd quadrants.
+ */
+static inline double mu_tan_kernel(double x, double y, int odd) {
+  double z = x * x;
+  double r = x * z * ((MU_TAN_P0 * z + MU_TAN_P1) * z + MU_TAN_P2) /
+             ((((z + MU_TAN_Q1) * z + MU_TAN_Q2) * z + MU_TAN_Q3) * z +
+              MU_TAN_Q4);
+  double t = x + r;
+  double w = r + y * (1.0 + t * t);
+  t = x + w;
+  if (!odd) {
+    return t;
+  }
+  double q = -1.0 / t;
+  return q + q * q * (w - (t - x));
+}
+
+/*
+ * res * 2^k for res in [1/2, 2], by adding k to the exponent bits; only results
+ * near the overflow and underflow thresholds need the two-step scaling.
+ */
+static inline double mu_exp_scale(double res, int k) {
+  if (k > -1021 && k < 1023) {
+    return mu_as_f64(mu_as_u64(res) + ((uint64_t)k << 52));
+  }
+  return res * mu_pow2(k / 2) * mu_pow2(k - k / 2);
+}
+
+/* 2^(ki / N) * e^r for |r| <= ln2/(2N). */
+static inline double mu_exp_reduced(int64_t ki, double r) {
+  int j = (int)(ki & (MU_EXP_N - 1));
+  double p =
+      r + r * r * (MU_EXP_C2 +
+                   r * (MU_EXP_C3 + r * (MU_EXP_C4 + r * MU_EXP_C5)));
+  double thi = mu_exp_table[2 * j];
+  return mu_exp_scale(thi + (thi * p + mu_exp_table[2 * j + 1]),
+                      (int)((ki - j) / MU_EXP_N));
+}
+
+/*
+ * e^(x + xtail) for MU_EXP_UNDERFLOW <= x <= MU_EXP_OVERFLOW, where `xtail` is
+ * a small correction to `x` (zero for plain exp, the low part of y * log(x)
+ * for pow).
+ */
+static inline double mu_exp_kernel(double x, double xtail) {
+  double t = x * MU_EXP_INV_LN2N + MU_ROUND_SHIFT;
+  double kd = t - MU_ROUND_SHIFT;
+  int64_t ki = (int64_t)(mu_as_u64(t) - mu_as_u64(MU_ROUND_SHIFT));
+  double r = (x - kd * MU_EXP_LN2HI_N) - kd * MU_EXP_LN2LO_N + xtail;
+
+  return mu_exp_reduced(ki, r);
+}
+
+/*
+ * 2^x for MU_EXP2_UNDERFLOW <= x <= MU_EXP2_OVERFLOW. The reduction is exact,
+ * so integral `x` gives an exact power of two.
+ */
+static inline double mu_exp2_kernel(double x) {
+  double t = x * MU_EXP_N + MU_ROUND_SHIFT;
+  double kd = t - MU_ROUND_SHIFT;
+  int64_t ki = (int64_t)(mu_as_u64(t) - mu_as_u64(MU_ROUND_SHIFT));
+
+  return mu_exp_reduced(ki, (x - kd * (1.0 / MU_EXP_N)) * MU_EXP2_LN2);
+}
+
+/*
+ * e^x - 1 for |x| < MU_EXPM1_SMALL: the Taylor series to x^10, whose
+ * truncation stays below 2^-65 relative.
+ */
+static inline double mu_expm1_small(double x) {
+  double q = MU_EXPM1_C6 +
+             x * (MU_EXPM1_C7 +
+                  x * (MU_EXPM1_C8 + x * (MU_EXPM1_C9 + x * MU_EXPM1_C10)));
+  return x + x * x *
+                 (MU_EXP_C2 +
+                  x * (MU_EXP_C3 + x * (MU_EXP_C4 + x * (MU_EXP_C5 + x * q))));
+}
+
+/*
+ * sinh(x) for |x| < 1: the odd Taylor series, whose truncation stays below
+ * 2^-70 relative.
+ */
+static inline double mu_sinh_small(double x) {
+  double z = x * x;
+  double q =
+      MU_SINH_C11 +
+      z * (MU_SINH_C13 +
+           z * (MU_SINH_C15 +
+                z * (MU_SINH_C17 + z * (MU_SINH_C19 + z * MU_SINH_C21))));
+  double p = MU_SINH_C3 +
+             z * (MU_SINH_C5 + z * (MU_SINH_C7 + z * (MU_SINH_C9 + z * q)));
+  return x + x * z * p;
+}
+
+/*
+ * e^x - 1 for MU_EXP_UNDERFLOW <= x <= MU_EXP_OVERFLOW. Below MU_EXPM1_SMALL
+ * in magnitude the result is a polynomial in `x`; the exp polynomial's error is
+ * absolute and would show in small results. Elsewhere the reduction is that of
+ * mu_exp_kernel(), with the scaled table value 2^k * 2^(j/N) kept apart from
+ * the polynomial term so that subtracting 1 from it is error-free. Above 700
+ * the 1 no longer shows and the result is e^x.
+ */
+static inline double mu_expm1_kernel(double x) {
+  if (mu_fabs_d(x) < MU_EXPM1_SMALL) {
+    return mu_expm1_small(x);
+  }
+  if (x > 700.0) {
+    return mu_exp_kernel(x, 0.0);
+  }
+  double t = x * MU_EXP_INV_LN2N + MU_ROUND_SHIFT;
+  double kd = t - MU_ROUND_SHIFT;
+  int64_t ki = (int64_t)(mu_as_u64(t) - mu_as_u64(MU_ROUND_SHIFT));
+  double r = (x - kd * MU_EXP_LN2HI_N) - kd * MU_EXP_LN2LO_N;
+
+  int j = (int)(ki & (MU_EXP_N - 1));
+  int k = (int)((ki - j) / MU_EXP_N);
+  if (k < -56) {
+    return -1.0;
+  }
+  double p =
+      r + r * r * (MU_EXP_C2 +
+                   r * (MU_EXP_C3 + r * (MU_EXP_C4 + r * MU_EXP_C5)));
+  double scale = mu_pow2(k);
+  double thi = mu_exp_table[2 * j] * scale;
+  double tail = (mu_exp_table[2 * j] * p + mu_exp_table[2 * j + 1]) * scale;
+  double e;
+  double hi = mu_two_sum(thi, -1.0, &e);
+  return hi + (tail + e);
+}
+
+/*
+ * log(1 + f) - f for |f| < 2^-5, with `f` exact.
+ */
+static inline double mu_log1p_near0_tail(double f) {
+  double s = f / (2.0 + f);
+  double z = s * s;
+  double r =
+      z * (MU_LOG_S1 + z * (MU_LOG_S2 + z * (MU_LOG_S3 + z * MU_LOG_S4)));
+  return -(s * (f - r));
+}
+
+/*
+ * log(1 + f) for |f| < 2^-5, with `f` exact.
+ */
+static inline double mu_log1p_near0(double f) {
+  return f + mu_log1p_near0_tail(f);
+}
+
+/*
+ * log(x) + c for a positive finite `x`, subnormals included, and a `c` far
+ * below log(x) or zero. `c` joins the low-order terms before the final
+ * rounding.
+ */
+static inline double mu_log_sum_kernel(double x, double c) {
+  uint64_t ix = mu_as_u64(x);
+  if (ix - MU_LOG_NEAR1_LO < MU_LOG_NEAR1_HI - MU_LOG_NEAR1_LO) {
+    return mu_log1p_near0(x - 1.0) + c;
+  }
+
+  int k_adjust = 0;
+  if (ix < 0x0010000000000000ULL) {
+    ix = mu_as_u64(x * 0x1p52);
+    k_adjust = 52;
+  }
+
+  uint64_t tmp = ix - MU_LOG_OFF;
+  int i = (int)((tmp >> (52 - MU_LOG_TABLE_BITS)) & (MU_LOG_N - 1));
+  double kd = (double)(((int64_t)tmp >> 52) - k_adjust);
+  double z = mu_as_f64(ix - (tmp & 0xfff0000000000000ULL));
+  const double *t = mu_log_table + 4 * i;
+
+  double r = (z - t[1]) * t[0];
+  double lo_w;
+  double w = mu_two_sum(kd * MU_LN2_HI, t[2], &lo_w);
+  double hi = w + r;
+  double lo = ((w - hi) + r) + lo_w;
+  double p = r * r *
+             (MU_LOG_C2 +
+              r * (MU_LOG_C3 +
+                   r * (MU_LOG_C4 +
+                        r * (MU_LOG_C5 + r * (MU_LOG_C6 + r * MU_LOG_C7)))));
+
+  return hi + (lo + (kd * MU_LN2_LO + t[3] + c) + p);
+}
+
+/*
+ * log(x) for a positive finite `x`, subnormals included. Adding -0.0 is exact
+ * for every double, so the compiler drops the term.
+ */
+static inline double mu_log_kernel(double x) {
+  return mu_log_sum_kernel(x, -0.0);
+}
+
+/*
+ * log_b(x) for a positive finite `x`, subnormals included, given
+ * log_b(2) = l2hi + l2lo and 1/ln(b) = ihi + ilo. The reduction is that of
+ * mu_log_sum_kernel(), with log(c) + r kept as a double-double before the
+ * scaling, so the cost is about one log and the error stays near half an ULP.
+ */
+static inline double mu_log_base_kernel(double x, double l2hi, double l2lo,
+                                        double ihi, double ilo) {
+  uint64_t ix = mu_as_u64(x);
+  double e;
+  if (ix - MU_LOG_NEAR1_LO < MU_LOG_NEAR1_HI - MU_LOG_NEAR1_LO) {
+    double f = x - 1.0;
+    double hi = mu_two_prod(f, ihi, &e);
+    return hi + (e + (f * ilo + mu_log1p_near0_tail(f) * ihi));
+  }
+
+  int k_adjust = 0;
+  if (ix < 0x0010000000000000ULL) {
+    ix = mu_as_u64(x * 0x1p52);
+    k_adjust = 52;
+  }
+
+  uint64_t tmp = ix - MU_LOG_OFF;
+  int i = (int)((tmp >> (52 - MU_LOG_TABLE_BITS)) & (MU_LOG_N - 1));
+  double kd = (double)(((int64_t)tmp >> 52) - k_adjust);
+  double z = mu_as_f64(ix - (tmp & 0xfff0000000000000ULL));
+  const double *t = mu_log_table + 4 * i;
+
+  double r = (z - t[1]) * t[0];
+  double lo_u;
+  double u = mu_two_sum(t[2], r, &lo_u);
+  double p = r * r *
+             (MU_LOG_C2 +
+              r * (MU_LOG_C3 +
+                   r * (MU_LOG_C4 +
+                        r * (MU_LOG_C5 + r * (MU_LOG_C6 + r * MU_LOG_C7)))));
+  double hi = mu_two_prod(u, ihi, &e);
+  double lo_s;
+  double s = mu_two_sum(kd * l2hi, hi, &lo_s);
+
+  return s + (lo_s + e + (kd * l2lo + u * ilo + (lo_u + t[3] + p) * ihi));
+}
+
+/*
+ * log(1 + x) for a finite x > -1. Small `x` goes to the near-1 polynomial
+ * directly; otherwise 1 + x is rounded and the part of `x` the rounding lost
+ * is added back as its first-order term.
+ */
+static inline double mu_log1p_kernel(double x) {
+  if (mu_fabs_d(x) < 0x1p-5) {
+    return mu_log1p_near0(x);
+  }
+  double u = 1.0 + x;
+  return mu_log_sum_kernel(u, (x - (u - 1.0)) / u);
+}
+
+/*
+ * log(x) as hi + *lo with a relative error around 2^-68, for a positive finite
+ * `x`. The reduced argument u = z / c - 1 is carried as a double-double and
+ * log1p(u) is summed with its first two terms exact.
+ */
+static inline double mu_log_dd(double x, double *lo) {
+  uint64_t ix = mu_as_u64(x);
+  int k_adjust = 0;
+  if (ix < 0x0010000000000000ULL) {
+    ix = mu_as_u64(x * 0x1p52);
+    k_adjust = 52;
+  }
+
+  uint64_t tmp = ix - MU_LOG_OFF;
+  int i = (int)((tmp >> (52 - MU_LOG_TABLE_BITS)) & (MU_LOG_N - 1));
+  double kd = (double)(((int64_t)tmp >> 52) - k_adjust);
+  double z = mu_as_f64(ix - (tmp & 0xfff0000000000000ULL));
+  const double *t = mu_log_table + 4 * i;
+  double invc = t[0], c = t[1], logc_hi = t[2], logc_lo = t[3];
+  if (i == MU_LOG_ONE_IDX || i == MU_LOG_ONE_IDX - 1) {
+    invc = c = 1.0;
+    logc_hi = logc_lo = 0.0;
+  }
+
+  double d = z - c;
+  double e;
+  double uh = d * invc;
+  double ul = ((d - mu_two_prod(uh, c, &e)) - e) * invc;
+
+  double s_lo;
+  double s = mu_two_prod(uh, uh, &s_lo);
+  double q = uh * s *
+             (MU_LOG_DD_C3 +
+              uh * (MU_LOG_DD_C4 +
+                    uh * (MU_LOG_DD_C5 +
+                          uh * (MU_LOG_DD_C6 +
+                                uh * (MU_LOG_DD_C7 +
+                                      uh * (MU_LOG_DD_C8 +
+                                            uh * (MU_LOG_DD_C9 +
+                                                  uh * MU_LOG_DD_C10)))))));
+
+  double w_lo, l1, l2;
+  double w = mu_two_sum(kd * MU_LN2_HI, logc_hi, &w_lo);
+  double h = mu_two_sum(w, uh, &l1);
+  h = mu_two_sum(h, -0.5 * s, &l2);
+  double l = (l1 + l2) + (w_lo + kd * MU_LN2_LO + logc_lo) +
+             (ul - 0.5 * s_lo - uh * ul + s * ul) + q;
+
+  double hi = h + l;
+  *lo = (h - hi) + l;
+  return hi;
+}
+
+/*
+ * Classifies `y` as MU_POW_NONINT (also for infinities), MU_POW_EVEN or
+ * MU_POW_ODD from its exponent and fraction bits.
+ */
+static inline int mu_pow_int_class(double y) {
+  uint64_t iy = mu_as_u64(y) & 0x7fffffffffffffffULL;
+  int e = (int)(iy >> 52) - 1023;
+  if (e < 0) {
+    return iy == 0 ? MU_POW_EVEN : MU_POW_NONINT;
+  }
+  if (e > 52) {
+    return iy < 0x7ff0000000000000ULL ? MU_POW_EVEN : MU_POW_NONINT;
+  }
+  if (iy & ((1ULL << (52 - e)) - 1)) {
+    return MU_POW_NONINT;
+  }
+  return ((iy >> (52 - e)) & 1) ? MU_POW_ODD : MU_POW_EVEN;
+}
+
+/*
+ * exp(y * (hi + lo)): the product is formed as a double-double and its tail
+ * is fed to mu_exp_kernel(), so the result keeps full precision for large
+ * |y * log(x)|.
+ */
+static inline double mu_pow_core(double hi, double lo, double y) {
+  double p = y * hi;
+  if (p != p) {
+    return p;
+  }
+  if (p > MU_EXP_OVERFLOW) {
+    return 1.0 / 0.0;
+  }
+  if (p < MU_EXP_UNDERFLOW) {
+    return 0.0;
+  }
+
+  double p_lo;
+  p = mu_two_prod(y, hi, &p_lo);
+  return mu_exp_kernel(p, p_lo + y * lo);
+}
+
+/*
+ * pow(x, y) for any arguments, with the special cases of C99 Annex F.
+ * `cls` is mu_pow_int_class(y), which the plan API computes only once.
+ */
+static inline double mu_pow_kernel(double x, double y, int cls) {
+  if (y == 0.0 || x == 1.0) {
+    return 1.0;
+  }
+  if (y == -1.0) {
+    /* Exact reciprocal, subnormal results included; NaN x stays NaN. */
+    return 1.0 / x;
+  }
+  if (x != x || y != y) {
+    return x + y;
+  }
+
+  double ax = mu_as_f64(mu_as_u64(x) & 0x7fffffffffffffffULL);
+  double sign = 1.0;
+  if (mu_as_u64(x) >> 63) {
+    if (cls == MU_POW_NONINT && x > -1.0 / 0.0 && x != 0.0 &&
+        y - y == 0.0) {
+      return 0.0 / 0.0;
+    }
+    if (cls == MU_POW_ODD) {
+      sign = -1.0;
+    }
+  }
+
+  int yinf = y - y != 0.0;
+  if (ax == 1.0) {
+    return yinf ? 1.0 : sign;
+  }
+  if (ax == 0.0) {
+    return y < 0 ? sign / 0.0 : sign * 0.0;
+  }
+  if (ax == 1.0 / 0.0) {
+    return y < 0 ? sign * 0.0 : sign / 0.0;
+  }
+  if (yinf) {
+    return (ax < 1.0) == (y < 0) ? 1.0 / 0.0 : 0.0;
+  }
+
+  double lo;
+  double hi = mu_log_dd(ax, &lo);
+  return sign * mu_pow_core(hi, lo, y);
+}
+
+/*
+ * sqrt(x) for a positive finite `x`, subnormals included. Uses the hardware
+ * square root where SSE2 is available; otherwise refines the bit-level seed
+ * with a fixed number of Newton steps.
+ */
+static inline double mu_sqrt_kernel(double x) {
+#if defined(__SSE2__)
+  return _mm_cvtsd_f64(_mm_sqrt_sd(_mm_setzero_pd(), _mm_set_sd(x)));
+#else
+  double scale = 1.0;
+  if (x < 0x1p-1022) {
+    x *= 0x1p54;
+    scale = 0x1p-27;
+  }
+
+  double y = mu_as_f64(MU_RSQRT_MAGIC - (mu_as_u64(x) >> 1));
+  double hx = 0.5 * x;
+  y = y * (1.5 - hx * y * y);
+  y = y * (1.5 - hx * y * y);
+  y = y * (1.5 - hx * y * y);
+
+  double s = x * y;
+  s += (x - s * s) * (0.5 * y);
+  return s * scale;
+#endif
+}
+
+/*
+ * Keeps the upper 32 bits of `x`, so that the square of the result is exact.
+ */
+static inline double mu_high_half(double x) {
+  return mu_as_f64(mu_as_u64(x) & 0xffffffff00000000ULL);
+}
+
+/*
+ * t * P(t) / Q(t) from the asin approximation, for 0 <= t <= 0.5.
+ */
+static inline double mu_asin_r(double t) {
+  double p =
+      t * (MU_ASIN_P0 +
+           t * (MU_ASIN_P1 +
+                t * (MU_ASIN_P2 +
+                     t * (MU_ASIN_P3 + t * (MU_ASIN_P4 + t * MU_ASIN_P5)))));
+  double q =
+      1.0 +
+      t * (MU_ASIN_Q1 + t * (MU_ASIN_Q2 + t * (MU_ASIN_Q3 + t * MU_ASIN_Q4)));
+  return p / q;
+}
+
+/*
+ * asin(x) for |x| <= 1. Above 0.5 it uses
+ * asin(x) = π/2 - 2 asin(sqrt((1 - |x|) / 2)), with the root split into an
+ * exact high half and a correction so that no digits are lost near 0.5.
+ */
+static inline double mu_asin_kernel(double x) {
+  double ax = x < 0 ? -x : x;
+  if (ax < 0.5) {
+    return x + x * mu_asin_r(x * x);
+  }
+
+  double t = (1.0 - ax) * 0.5;
+  double r = mu_asin_r(t);
+  double s = mu_sqrt_kernel(t);
+  double res;
+  if (ax >= MU_ASIN_NEAR1) {
+    res = MU_PIO2_HI - (2.0 * (s + s * r) - MU_PIO2_LO);
+  } else {
+    double w = mu_high_half(s);
+    double c = (t - w * w) / (s + w);
+    double p = 2.0 * s * r - (MU_PIO2_LO - 2.0 * c);
+    double q = MU_PIO4_HI - 2.0 * w;
+    res = MU_PIO4_HI - (p - q);
+  }
+  return x < 0 ? -res : res;
+}
+
+/*
+ * acos(x) for |x| <= 1, on the same reductions as mu_asin_kernel().
+ */
+static inline double mu_acos_kernel(double x) {
+  if (x == 1.0) {
+    return 0.0;
+  }
+
+  if ((x < 0 ? -x : x) < 0.5) {
+    return MU_PIO2_HI - (x - (MU_PIO2_LO - x * mu_asin_r(x * x)));
+  }
+
+  double t = (1.0 - (x < 0 ? -x : x)) * 0.5;
+  double r = mu_asin_r(t);
+  double s = mu_sqrt_kernel(t);
+  if (x < 0) {
+    return MU_PI_HI - 2.0 * (s + (r * s - MU_PIO2_LO));
+  }
+
+  double w = mu_high_half(s);
+  double c = (t - w * w) / (s + w);
+  return 2.0 * (w + (r * s + c));
+}
+
+/*
+ * x * (atan(x) / x - 1) for |x| <= 7/16, split into odd and even powers of
+ * z = x^2 to shorten the dependency chain.
+ */
+static inline double mu_atan_poly(double x) {
+  double z = x * x;
+  double w = z * z;
+  double s1 =
+      z * (MU_ATAN_T0 +
+           w * (MU_ATAN_T2 +
+                w * (MU_ATAN_T4 +
+                     w * (MU_ATAN_T6 + w * (MU_ATAN_T8 + w * MU_ATAN_T10)))));
+  double s2 =
+      w * (MU_ATAN_T1 +
+           w * (MU_ATAN_T3 +
+                w * (MU_ATAN_T5 + w * (MU_ATAN_T7 + w * MU_ATAN_T9))));
+  return x * (s1 + s2);
+}
+
+/*
+ * atan(x) for any non-NaN `x`. |x| is reduced against the nearest of
+ * 0, 1/2, 1, 3/2 and infinity, whose arctangents come from mu_atan_table.
+ */
+static inline double mu_atan_kernel(double x) {
+  double ax = x < 0 ? -x : x;
+  if (ax < MU_ATAN_B0) {
+    return ax < 0x1p-27 ? x : x - mu_atan_poly(x);
+  }
+
+  int id;
+  double xr;
+  if (ax < MU_ATAN_B1) {
+    id = 0;
+    xr = (2.0 * ax - 1.0) / (2.0 + ax);
+  } else if (ax < MU_ATAN_B2) {
+    id = 1;
+    xr = (ax - 1.0) / (ax + 1.0);
+  } else if (ax < MU_ATAN_B3) {
+    id = 2;
+    xr = (ax - 1.5) / (1.0 + 1.5 * ax);
+  } else {
+    id = 3;
+    xr = -1.0 / ax;
+  }
+
+  double res = mu_atan_table[2 * id] -
+               ((mu_atan_poly(xr) - mu_atan_table[2 * id + 1]) - xr);
+  return x < 0 ? -res : res;
+}
+
+/*
+ * atan2(y, x) for any arguments. The angle of (|x|, |y|) is reflected into the
+ * quadrant given by the sign bits, so signed zeros and infinities follow the
+ * usual conventions. Near-vertical points return ±π/2 directly, which keeps
+ * the reflection from rounding them one unit away.
+ */
+static inline double mu_atan2_kernel(double y, double x) {
+  if (x != x || y != y) {
+    return x + y;
+  }
+
+  double ax = mu_as_f64(mu_as_u64(x) & 0x7fffffffffffffffULL);
+  double ay = mu_as_f64(mu_as_u64(y) & 0x7fffffffffffffffULL);
+  double z;
+  if (ax == ay && (ax == 0.0 || ax == 1.0 / 0.0)) {
+    z = ax == 0.0 ? 0.0 : MU_PIO4_HI;
+  } else if (ay > 0x1p60 * ax) {
+    return (mu_as_u64(y) >> 63) ? -MU_PIO2_HI : MU_PIO2_HI;
+  } else {
+    z = mu_atan_kernel(ay / ax);
+  }
+
+  if (mu_as_u64(x) >> 63) {
+    z = MU_PI_HI - (z - MU_PI_LO);
+  }
+  return (mu_as_u64(y) >> 63) ? -z : z;
+}
+
+/*
+ * Single-precision kernels. Polynomials are sized for a 24-bit mantissa;
+ * argument reduction for the trigonometric functions runs in double.
+ */
+#define MU_TWO23F 8388608.0f
+#define MU_ROUND_SHIFTF 12582912.0f
+#define MU_INFF (1.0f / 0.0f)
+
+#define MU_PIO2F_HI 0x1.921fb6p+0f
+#define MU_PIO2F_LO -0x1.777a5cp-25f
+#define MU_PIO4F_HI 0x1.921fb6p-1f
+#define MU_PIO4F_LO -0x1.777a5cp-26f
+#define MU_PIF_HI 0x1.921fb6p+1f
+#define MU_PIF_LO -0x1.777a5cp-24f
+
+/* sin(x) - x and cos(x) - 1 + x^2/2 on [-π/4, π/4]. */
+#define MU_SINF_S1 -1.6666654611e-1f
+#define MU_SINF_S2 8.3321608736e-3f
+#define MU_SINF_S3 -1.9515295891e-4f
+#define MU_COSF_C1 4.166664568298827e-2f
+#define MU_COSF_C2 -1.388731625493765e-3f
+#define MU_COSF_C3 2.443315711809948e-5f
+
+/* tan(x) = x + x^3 P(x^2) on [-π/4, π/4]. */
+#define MU_TANF_T0 3.33331568548e-1f
+#define MU_TANF_T1 1.33387994085e-1f
+#define MU_TANF_T2 5.34112807005e-2f
+#define MU_TANF_T3 2.44301354525e-2f
+#define MU_TANF_T4 3.11992232697e-3f
+#define MU_TANF_T5 9.38540185543e-3f
+
+/*
+ * exp(x) = 2^n (1 + r + r^2 P(r)) with r = x - n ln2, |r| <= ln2 / 2. ln2 is
+ * split so that n * MU_LN2F_HI is exact.
+ */
+#define MU_LOG2EF 1.44269504088896341f
+#define MU_LN2F_HI 0.693359375f
+#define MU_LN2F_LO -2.12194440e-4f
+#define MU_EXPF_P0 5.0000001201e-1f
+#define MU_EXPF_P1 1.6666665459e-1f
+#define MU_EXPF_P2 4.1665795894e-2f
+#define MU_EXPF_P3 8.3334519073e-3f
+#define MU_EXPF_P4 1.3981999507e-3f
+#define MU_EXPF_P5 1.9875691500e-4f
+
+/* Largest argument with a finite result and smallest with a nonzero one. */
+#define MU_EXPF_OVERFLOW 0x1.62e42ep+6f
+#define MU_EXPF_UNDERFLOW -0x1.9fe368p+6f
+
+/*
+ * log(1 + f) = f - f^2/2 + f^3 P(f) for sqrt(1/2) <= 1 + f < sqrt(2). The
+ * mantissa is split at MU_LOGF_OFF, the bit pattern of sqrt(1/2).
+ */
+#define MU_LOGF_OFF 0x3f3504f3U
+#define MU_LOGF_P0 3.3333331174e-1f
+#define MU_LOGF_P1 -2.4999993993e-1f
+#define MU_LOGF_P2 2.0000714765e-1f
+#define MU_LOGF_P3 -1.6668057665e-1f
+#define MU_LOGF_P4 1.4249322787e-1f
+#define MU_LOGF_P5 -1.2420140846e-1f
+#define MU_LOGF_P6 1.1676998740e-1f
+#define MU_LOGF_P7 -1.1514610310e-1f
+#define MU_LOGF_P8 7.0376836292e-2f
+
+/* asin(x) = x + x^3 P(x^2) for |x| <= 0.5. */
+#define MU_ASINF_P0 1.6666752422e-1f
+#define MU_ASINF_P1 7.4953002686e-2f
+#define MU_ASINF_P2 4.5470025998e-2f
+#define MU_ASINF_P3 2.4181311049e-2f
+#define MU_ASINF_P4 4.2163199048e-2f
+
+/*
+ * atan(x) = x + x^3 P(x^2) for |x| <= tan(π/8), after reducing against π/4
+ * above MU_ATANF_B0 and against π/2 above MU_ATANF_B1.
+ */
+#define MU_ATANF_P0 -3.33329491539e-1f
+#define MU_ATANF_P1 1.99777106478e-1f
+#define MU_ATANF_P2 -1.38776856032e-1f
+#define MU_ATANF_P3 8.05374449538e-2f
+#define MU_ATANF_B0 0.4142135623730950f
+#define MU_ATANF_B1 2.414213562373095f
+
+static inline uint32_t mu_as_u32(float x) {
+  uint32_t u;
+  memcpy(&u, &x, sizeof(u));
+  return u;
+}
+
+static inline float mu_as_f32(uint32_t u) {
+  float x;
+  memcpy(&x, &u, sizeof(x));
+  return x;
+}
+
+static inline float mu_fabsf_bits(float x) {
+  return mu_as_f32(mu_as_u32(x) & 0x7fffffffU);
+}
+
+/*
+ * Reduces a finite float `x` to [-π/4, π/4] and returns the quadrant. The
+ * reduction runs in double, where it is exact to float precision.
+ */
+static inline int mu_rem_pio2f(float x, float *r) {
+  double rd;
+  int n = mu_rem_pio2_short(x, &rd);
+  *r = (float)rd;
+  return n;
+}
+
+static inline float mu_fcopysign_bits(float mag, float sgn) {
+  return mu_as_f32((mu_as_u32(mag) & 0x7fffffffU) |
+                   (mu_as_u32(sgn) & 0x80000000U));
+}
+
+/* sin(x) for |x| <= π/4; tiny arguments return `x` to keep the sign of 0. */
+static inline float mu_sinf_kernel(float x) {
+  if (mu_fabsf_bits(x) < 0x1p-12f) {
+    return x;
+  }
+  float z = x * x;
+  return x + x * z * (MU_SINF_S1 + z * (MU_SINF_S2 + z * MU_SINF_S3));
+}
+
+static inline float mu_cosf_kernel(float x) {
+  float z = x * x;
+  float r = z * z * (MU_COSF_C1 + z * (MU_COSF_C2 + z * MU_COSF_C3));
+  return (1.0f - 0.5f * z) + r;
+}
+
+/* tan(x) for |x| <= π/4, or -1 / tan(x) when `odd` is set. */
+static inline float mu_tanf_kernel(float x, int odd) {
+  float z = x * x;
+  float p =
+      MU_TANF_T0 +
+      z * (MU_TANF_T1 +
+           z * (MU_TANF_T2 +
+                z * (MU_TANF_T3 + z * (MU_TANF_T4 + z * MU_TANF_T5))));
+  float t = x + x * z * p;
+  return odd ? -1.0f / t : t;
+}
+
+/*
+ * exp(x) for MU_EXPF_UNDERFLOW <= x <= MU_EXPF_OVERFLOW. The scale 2^n is
+ * applied as two factors so that subnormal results round only once.
+ */
+static inline float mu_expf_kernel(float x) {
+  float t = x * MU_LOG2EF + MU_ROUND_SHIFTF;
+  float fn = t - MU_ROUND_SHIFTF;
+  int n = (int)(mu_as_u32(t) - mu_as_u32(MU_ROUND_SHIFTF));
+  float r = (x - fn * MU_LN2F_HI) - fn * MU_LN2F_LO;
+
+  float p =
+      MU_EXPF_P0 +
+      r * (MU_EXPF_P1 +
+           r * (MU_EXPF_P2 +
+                r * (MU_EXPF_P3 + r * (MU_EXPF_P4 + r * MU_EXPF_P5))));
+  float res = 1.0f + (r + r * r * p);
+
+  int n1 = n >> 1;
+  float s1 = mu_as_f32((uint32_t)(n1 + 127) << 23);
+  float s2 = mu_as_f32((uint32_t)(n - n1 + 127) << 23);
+  return res * s1 * s2;
+}
+
+/* log(x) for a positive finite float `x`, subnormals included. */
+static inline float mu_logf_kernel(float x) {
+  int sub = 0;
+  if (x < 0x1p-126f) {
+    x *= 0x1p23f;
+    sub = 23;
+  }
+
+  uint32_t ix = mu_as_u32(x);
+  uint32_t tmp = ix - MU_LOGF_OFF;
+  int k = ((int32_t)tmp >> 23) - sub;
+  float f = mu_as_f32(ix - (tmp & 0xff800000U)) - 1.0f;
+  float fk = (float)k;
+
+  float z = f * f;
+  float p =
+      MU_LOGF_P0 +
+      f * (MU_LOGF_P1 +
+           f * (MU_LOGF_P2 +
+                f * (MU_LOGF_P3 +
+                     f * (MU_LOGF_P4 +
+                          f * (MU_LOGF_P5 +
+                               f * (MU_LOGF_P6 +
+                                    f * (MU_LOGF_P7 + f * MU_LOGF_P8)))))));
+  float y = f * z * p + fk * MU_LN2F_LO - 0.5f * z;
+  return (f + y) + fk * MU_LN2F_HI;
+}
+
+/* s + s z P(z) with z = s^2, the asin approximation for 0 <= s <= 0.5. */
+static inline float mu_asinf_r(float s, float z) {
+  float p =
+      MU_ASINF_P0 +
+      z * (MU_ASINF_P1 +
+           z * (MU_ASINF_P2 + z * (MU_ASINF_P3 + z * MU_ASINF_P4)));
+  return s + s * z * p;
+}
+
+/*
+ * asin(x) for |x| <= 1, with asin(x) = π/2 - 2 asin(sqrt((1 - |x|) / 2))
+ * above 0.5. Below MU_ASIN_NEAR1 the root is split as in mu_asin_kernel().
+ */
+static inline float mu_asinf_kernel(float x) {
+  float ax = mu_fabsf_bits(x);
+  float res;
+  if (ax < 0.5f) {
+    res = mu_asinf_r(ax, ax * ax);
+  } else {
+    float z = (1.0f - ax) * 0.5f;
+    float s = (float)mu_sqrt_kernel(z);
+    float r = mu_asinf_r(s, z) - s;
+    if (ax >= (float)MU_ASIN_NEAR1) {
+      res = MU_PIO2F_HI - (2.0f * (s + r) - MU_PIO2F_LO);
+    } else {
+      float w = mu_as_f32(mu_as_u32(s) & 0xfffff000U);
+      float c = (z - w * w) / (s + w);
+      float p = 2.0f * r - (MU_PIO2F_LO - 2.0f * c);
+      res = MU_PIO4F_HI - (p - (MU_PIO4F_HI - 2.0f * w));
+    }
+  }
+  return mu_fcopysign_bits(res, x);
+}
+
+static inline float mu_acosf_kernel(float x) {
+  float ax = mu_fabsf_bits(x);
+  if (ax < 0.5f) {
+    return MU_PIO2F_HI - ((x < 0 ? -1.0f : 1.0f) * mu_asinf_r(ax, ax * ax) -
+                          MU_PIO2F_LO);
+  }
+
+  float z = (1.0f - ax) * 0.5f;
+  float r = 2.0f * mu_asinf_r((float)mu_sqrt_kernel(z), z);
+  return x < 0 ? MU_PIF_HI - (r - MU_PIF_LO) : r;
+}
+
+/* atan(x) for any non-NaN `x`. */
+static inline float mu_atanf_kernel(float x) {
+  float ax = mu_fabsf_bits(x);
+  float hi = 0.0f;
+  float lo = 0.0f;
+  float t = ax;
+  if (ax > MU_ATANF_B1) {
+    hi = MU_PIO2F_HI;
+    lo = MU_PIO2F_LO;
+    t = -1.0f / ax;
+  } else if (ax > MU_ATANF_B0) {
+    hi = MU_PIO4F_HI;
+    lo = MU_PIO4F_LO;
+    t = (ax - 1.0f) / (ax + 1.0f);
+  }
+
+  float z = t * t;
+  float p =
+      MU_ATANF_P0 + z * (MU_ATANF_P1 + z * (MU_ATANF_P2 + z * MU_ATANF_P3));
+  float res = hi + (t + (t * z * p + lo));
+  return mu_fcopysign_bits(res, x);
+}
+
+/* atan2(y, x) for any arguments, as mu_atan2_kernel() in single precision. */
+static inline float mu_atan2f_kernel(float y, float x) {
+  if (x != x || y != y) {
+    return x + y;
+  }
+
+  float ax = mu_fabsf_bits(x);
+  float ay = mu_fabsf_bits(y);
+  float z;
+  if (ax == ay && (ax == 0.0f || ax == 1.0f / 0.0f)) {
+    z = ax == 0.0f ? 0.0f : MU_PIO4F_HI;
+  } else if (ay > 0x1p26f * ax) {
+    return (mu_as_u32(y) >> 31) ? -MU_PIO2F_HI : MU_PIO2F_HI;
+  } else {
+    z = mu_atanf_kernel(ay / ax);
+  }
+
+  if (mu_as_u32(x) >> 31) {
+    z = MU_PIF_HI - (z - MU_PIF_LO);
+  }
+  return (mu_as_u32(y) >> 31) ? -z : z;
+}
+
+/*
+ * Reduced-accuracy tiers. sin and cos have their own fixed-degree kernels: the
+ * fast tier reuses the single-precision minimax coefficients evaluated in
+ * double, the medium tier truncated Taylor series. exp and log keep the table
+ * reductions of the full functions and shorten the polynomial instead.
+ */
+#define MU_TAYLOR_3 -1.66666666666666666667e-01
+#define MU_TAYLOR_5 8.33333333333333333333e-03
+#define MU_TAYLOR_7 -1.98412698412698412698e-04
+#define MU_TAYLOR_9 2.75573192239858906526e-06
+#define MU_TAYLOR_11 -2.50521083854417187751e-08
+#define MU_TAYLOR_2 -0.5
+#define MU_TAYLOR_4 4.16666666666666666667e-02
+#define MU_TAYLOR_6 -1.38888888888888888889e-03
+#define MU_TAYLOR_8 2.48015873015873015873e-05
+#define MU_TAYLOR_10 -2.75573192239858906526e-07
+#define MU_TAYLOR_12 2.08767569878680989792e-09
+
+/* sin(r) for |r| <= π/4 at the given tier. */
+static inline double mu_sin_tier_kernel(double r, int tier) {
+  double z = r * r;
+  double p;
+  if (tier == MU_ACCURACY_FAST) {
+    p = MU_SINF_S1 + z * (MU_SINF_S2 + z * MU_SINF_S3);
+  } else {
+    p = MU_TAYLOR_3 +
+        z * (MU_TAYLOR_5 +
+             z * (MU_TAYLOR_7 + z * (MU_TAYLOR_9 + z * MU_TAYLOR_11)));
+  }
+  return r + r * z * p;
+}
+
+/* cos(r) for |r| <= π/4 at the given tier. */
+static inline double mu_cos_tier_kernel(double r, int tier) {
+  double z = r * r;
+  double p;
+  if (tier == MU_ACCURACY_FAST) {
+    p = MU_COSF_C1 + z * (MU_COSF_C2 + z * MU_COSF_C3);
+  } else {
+    p = MU_TAYLOR_4 +
+        z * (MU_TAYLOR_6 +
+             z * (MU_TAYLOR_8 + z * (MU_TAYLOR_10 + z * MU_TAYLOR_12)));
+  }
+  return (1.0 + MU_TAYLOR_2 * z) + z * z * p;
+}
+
+/*
+ * exp(x) for MU_EXP_UNDERFLOW <= x <= MU_EXP_OVERFLOW at the given tier, on the
+ * reduction of mu_exp_kernel() without the low part of the table value. With
+ * |r| <= ln2/(2N) the medium tier stops at r^3, and the fast tier at r^2 and
+ * also drops the low part of ln2/N.
+ */
+static inline double mu_exp_tier_kernel(double x, int tier) {
+  double t = x * MU_EXP_INV_LN2N + MU_ROUND_SHIFT;
+  double kd = t - MU_ROUND_SHIFT;
+  int64_t ki = (int64_t)(mu_as_u64(t) - mu_as_u64(MU_ROUND_SHIFT));
+  double r = x - kd * MU_EXP_LN2HI_N;
+
+  double p;
+  if (tier == MU_ACCURACY_FAST) {
+    p = r + r * r * MU_EXP_C2;
+  } else {
+    r -= kd * MU_EXP_LN2LO_N;
+    p = r + r * r * (MU_EXP_C2 + r * MU_EXP_C3);
+  }
+  int j = (int)(ki & (MU_EXP_N - 1));
+  double thi = mu_exp_table[2 * j];
+  return mu_exp_scale(thi + thi * p, (int)((ki - j) / MU_EXP_N));
+}
+
+/*
+ * log(x) for a positive finite `x`, subnormals included, at the given tier, on
+ * the reductions of mu_log_sum_kernel(). Near 1 the atanh series stops at s^3
+ * for the fast tier and s^5 for the medium one; elsewhere |r| < 2^-8 and
+ * |log(x)| > 2^-6, so log1p(r) stops at r^3 and r^4.
+ */
+static inline double mu_log_tier_kernel(double x, int tier) {
+  uint64_t ix = mu_as_u64(x);
+  if (ix - MU_LOG_NEAR1_LO < MU_LOG_NEAR1_HI - MU_LOG_NEAR1_LO) {
+    double f = x - 1.0;
+    double s = f / (2.0 + f);
+    double z = s * s;
+    double q;
+    if (tier == MU_ACCURACY_FAST) {
+      q = z * MU_LOG_S1;
+    } else {
+      q = z * (MU_LOG_S1 + z * MU_LOG_S2);
+    }
+    return f - s * (f - q);
+  }
+
+  int k_adjust = 0;
+  if (ix < 0x0010000000000000ULL) {
+    ix = mu_as_u64(x * 0x1p52);
+    k_adjust = 52;
+  }
+
+  uint64_t tmp = ix - MU_LOG_OFF;
+  int i = (int)((tmp >> (52 - MU_LOG_TABLE_BITS)) & (MU_LOG_N - 1));
+  double kd = (double)(((int64_t)tmp >> 52) - k_adjust);
+  double z = mu_as_f64(ix - (tmp & 0xfff0000000000000ULL));
+  const double *t = mu_log_table + 4 * i;
+
+  double r = z * t[0] - 1.0;
+  double p;
+  if (tier == MU_ACCURACY_FAST) {
+    p = r * r * (MU_LOG_C2 + r * MU_LOG_C3);
+  } else {
+    p = r * r * (MU_LOG_C2 + r * (MU_LOG_C3 + r * MU_LOG_C4));
+  }
+  return kd * MU_LN2 + (t[2] + (r + p));
+}
+
+/*
+ * Instrumentation counters, compiled in with MU_STATS. Each thread owns a
+ * block that only it writes; mu_stats_snapshot() reads every block.
+ */
+#if defined(MU_STATS)
+#include <stdatomic.h>
+
+enum {
+  MU_STATS_SLOT_CALLS,
+  MU_STATS_SLOT_NAN,
+  MU_STATS_SLOT_INF,
+  MU_STATS_SLOT_DOMAIN,
+  MU_STATS_SLOT_RANGE,
+  MU_STATS_SLOT_SLOW,
+  MU_STATS_SLOT_MAGNITUDE,
+  MU_STATS_SLOTS = MU_STATS_SLOT_MAGNITUDE + MU_STATS_BUCKETS
+};
+
+typedef struct mu_stats_block {
+  _Atomic unsigned long long count[MU_STATS_FUNCS][MU_STATS_SLOTS];
+  struct mu_stats_block *next;
+  int registered;
+} mu_stats_block;
+
+extern _Thread_local mu_stats_block mu_stats_local;
+
+void mu_stats_register(void);
+
+/*
+ * Single-writer increment: a relaxed load and store, which compile to a
+ * plain add but stay well-defined for the readers in other threads.
+ */
+static inline void mu_stats_add(int func, int slot) {
+  if (!mu_stats_local.registered) {
+    mu_stats_register();
+  }
+  _Atomic unsigned long long *c = &mu_stats_local.count[func][slot];
+  atomic_store_explicit(c, atomic_load_explicit(c, memory_order_relaxed) + 1,
+                        memory_order_relaxed);
+}
+
+static inline void mu_stats_call(int func, double x) {
+  static const int edges[MU_STATS_BUCKETS - 1] = {
+      -64, -32, -16, -8, -4, -2, -1, 0, 1, 2, 4, 8, 16, 32, 64};
+
+  mu_stats_add(func, MU_STATS_SLOT_CALLS);
+  int e = (int)((mu_as_u64(x) >> 52) & 0x7ff) - 1023;
+  if (x != x) {
+    mu_stats_add(func, MU_STATS_SLOT_NAN);
+  } else if (e == 1024) {
+    mu_stats_add(func, MU_STATS_SLOT_INF);
+  } else {
+    int b = 0;
+    while (b < MU_STATS_BUCKETS - 1 && e >= edges[b]) {
+      ++b;
+    }
+    mu_stats_add(func, MU_STATS_SLOT_MAGNITUDE + b);
+  }
+}
+
+#define MU_STATS_CALL(func, x) mu_stats_call(func, x)
+#define MU_STATS_EVENT(func, slot) mu_stats_add(func, MU_STATS_SLOT_##slot)
+#else
+#define MU_STATS_CALL(func, x) ((void)0)
+#define MU_STATS_EVENT(func, slot) ((void)0)
+#endif
+
+/* Batch functions by mu_fn_id and mu_fn2_id, in math_utils_strided.c. */
+typedef void (*mu_unary_fn)(const double *, double *, size_t);
+typedef void (*mu_binary_fn)(const double *, const double *, double *,
+                             size_t);
+
+extern const mu_unary_fn mu_fn_table[MU_FN_COUNT];
+extern const mu_binary_fn mu_fn2_table[MU_FN2_COUNT];
+
+#endif  // MATH_MATH_UTILS_INTERNAL_H_
@@ -0,0 +1,193 @@
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include "math_utils.h"
+#include "math_utils_internal.h"
+
+/* Elements per chunk: a multiple of every vector width. */
+#define MU_PAR_CHUNK 16384
+
+/*
+ * Chunks [next, end) of one part. The owner and the threads that steal from
+ * it both take chunks from `next`. Padded to its own cache line.
+ */
+typedef struct {
+  _Atomic size_t next;
+  size_t end;
+  char pad[64 - sizeof(size_t) - sizeof(_Atomic size_t)];
+} mu_par_range;
+
+/* The pool and its current job, guarded by mu_pool_lock but for `ranges`. */
+static pthread_mutex_t mu_pool_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t mu_pool_wake = PTHREAD_COND_INITIALIZER;
+static pthread_cond_t mu_pool_done = PTHREAD_COND_INITIALIZER;
+
+static struct {
+  pthread_t *threads;
+  int workers;
+  int stop;
+  unsigned long generation;
+  int pending;
+
+  mu_unary_fn fn;
+  const double *in;
+  double *out;
+  size_t n;
+  int parts;
+  mu_par_range *ranges;
+} mu_pool;
+
+/* One job at a time; held by the submitting thread for the whole job. */
+static pthread_mutex_t mu_par_submit = PTHREAD_MUTEX_INITIALIZER;
+
+/* Runs part `self`, then steals from the other parts in turn. */
+static void mu_par_run(int self) {
+  for (int k = 0; k < mu_pool.parts; ++k) {
+    mu_par_range *r = &mu_pool.ranges[(self + k) % mu_pool.parts];
+    size_t c;
+    while ((c = atomic_fetch_add_explicit(&r->next, 1,
+                                          memory_order_relaxed)) < r->end) {
+      size_t lo = c * MU_PAR_CHUNK;
+      size_t len = mu_pool.n - lo < MU_PAR_CHUNK ? mu_pool.n - lo
+                                                 : MU_PAR_CHUNK;
+      mu_pool.fn(mu_pool.in + lo, mu_pool.out + lo, len);
+    }
+  }
+}
+
+static void *mu_par_worker(void *arg) {
+  int self = (int)(size_t)arg;
+  unsigned long seen = 0;
+
+  pthread_mutex_lock(&mu_pool_lock);
+  for (;;) {
+    while (!mu_pool.stop && mu_pool.generation == seen) {
+      pthread_cond_wait(&mu_pool_wake, &mu_pool_lock);
+    }
+    if (mu_pool.stop) {
+      break;
+    }
+    seen = mu_pool.generation;
+    if (self >= mu_pool.parts) {
+      continue;
+    }
+
+    pthread_mutex_unlock(&mu_pool_lock);
+    mu_par_run(self);
+    pthread_mutex_lock(&mu_pool_lock);
+    if (--mu_pool.pending == 0) {
+      pthread_cond_signal(&mu_pool_done);
+    }
+  }
+  pthread_mutex_unlock(&mu_pool_lock);
+  return NULL;
+}
+
+/*
+ * Grows the pool to `parts - 1` workers plus the caller and returns the
+ * number of parts it can run, fewer if threads cannot be created.
+ */
+static int mu_par_grow(int parts) {
+  if (parts - 1 <= mu_pool.workers) {
+    return parts;
+  }
+
+  pthread_t *threads =
+      realloc(mu_pool.threads, (parts - 1) * sizeof(*threads));
+  mu_par_range *ranges = aligned_alloc(64, parts * sizeof(*ranges));
+  if (threads == NULL || ranges == NULL) {
+    free(ranges);
+    if (threads) {
+      mu_pool.threads = threads;
+    }
+    return mu_pool.workers + 1;
+  }
+  mu_pool.threads = threads;
+  free(mu_pool.ranges);
+  mu_pool.ranges = ranges;
+
+  while (mu_pool.workers < parts - 1) {
+    size_t self = (size_t)mu_pool.workers + 1;
+    if (pthread_create(&mu_pool.threads[mu_pool.workers], NULL, mu_par_worker,
+                       (void *)self) != 0) {
+      break;
+    }
+    ++mu_pool.workers;
+  }
+  return mu_pool.workers + 1;
+}
+
+int mu_parallel_apply(mu_fn_id fn, const double *in, double *out, size_t n,
+                      int nthreads) {
+  if ((int)fn < 0 || fn >= MU_FN_COUNT) {
+    return -1;
+  }
+
+  if (nthreads <= 0) {
+    long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    nthreads = cpus > 0 ? (int)cpus : 1;
+  }
+  size_t chunks = (n + MU_PAR_CHUNK - 1) / MU_PAR_CHUNK;
+  int parts = chunks < (size_t)nthreads ? (int)chunks : nthreads;
+  if (parts <= 1) {
+    mu_fn_table[fn](in, out, n);
+    return 0;
+  }
+
+  pthread_mutex_lock(&mu_par_submit);
+  pthread_mutex_lock(&mu_pool_lock);
+  parts = mu_par_grow(parts);
+  if (parts <= 1) {
+    pthread_mutex_unlock(&mu_pool_lock);
+    pthread_mutex_unlock(&mu_par_submit);
+    mu_fn_table[fn](in, out, n);
+    return 0;
+  }
+
+  /* Part p owns chunks [p * chunks / parts, (p + 1) * chunks / parts). */
+  for (int p = 0; p < parts; ++p) {
+    atomic_init(&mu_pool.ranges[p].next, p * chunks / parts);
+    mu_pool.ranges[p].end = (p + 1) * chunks / parts;
+  }
+  mu_pool.fn = mu_fn_table[fn];
+  mu_pool.in = in;
+  mu_pool.out = out;
+  mu_pool.n = n;
+  mu_pool.parts = parts;
+  mu_pool.pending = parts - 1;
+  mu_pool.generation++;
+  pthread_cond_broadcast(&mu_pool_wake);
+  pthread_mutex_unlock(&mu_pool_lock);
+
+  mu_par_run(0);
+
+  pthread_mutex_lock(&mu_pool_lock);
+  while (mu_pool.pending > 0) {
+    pthread_cond_wait(&mu_pool_done, &mu_pool_lock);
+  }
+  pthread_mutex_unlock(&mu_pool_lock);
+  pthread_mutex_unlock(&mu_par_submit);
+  return 0;
+}
+
+void mu_parallel_shutdown(void) {
+  pthread_mutex_lock(&mu_par_submit);
+  pthread_mutex_lock(&mu_pool_lock);
+  mu_pool.stop = 1;
+  pthread_cond_broadcast(&mu_pool_wake);
+  pthread_mutex_unlock(&mu_pool_lock);
+
+  for (int i = 0; i < mu_pool.workers; ++i) {
+    pthread_join(mu_pool.threads[i], NULL);
+  }
+
+  free(mu_pool.threads);
+  free(mu_pool.ranges);
+  mu_pool.threads = NULL;
+  mu_pool.ranges = NULL;
+  mu_pool.workers = 0;
+  mu_pool.stop = 0;
+  pthread_mutex_unlock(&mu_par_submit);
+}
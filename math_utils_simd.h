@@ -0,0 +1,330 @@
+#ifndef MATH_MATH_UTILS_SIMD_H_
+#define MATH_MATH_UTILS_SIMD_H_
+
+#include <string.h>
+
+#if defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+/**
+ * @brief Number of double-precision lanes processed by one vector kernel call.
+ *
+ * The width follows the instruction set the translation unit is compiled for:
+ * 8 lanes for AVX-512, 4 lanes for AVX/AVX2 and 2 lanes for SSE2 (and for the
+ * generic fallback on other architectures).
+ */
+#if defined(__AVX512F__)
+#define MU_VLEN 8
+#elif defined(__AVX__)
+#define MU_VLEN 4
+#else
+#define MU_VLEN 2
+#endif
+
+/**
+ * @brief Vector of `MU_VLEN` double-precision lanes.
+ */
+typedef double mu_vf64 __attribute__((vector_size(MU_VLEN * sizeof(double))));
+
+/**
+ * @brief Vector of `MU_VLEN` signed 64-bit lanes, also used as a lane mask
+ * (all bits set for true, zero for false).
+ */
+typedef long long mu_vi64
+    __attribute__((vector_size(MU_VLEN * sizeof(long long))));
+
+#define MU_SIGN_MASK ((long long)0x8000000000000000ULL)
+#define MU_ABS_MASK 0x7fffffffffffffffLL
+
+static inline mu_vf64 mu_v_load(const double *p) {
+  mu_vf64 v;
+  memcpy(&v, p, sizeof(v));
+  return v;
+}
+
+static inline void mu_v_store(double *p, mu_vf64 v) {
+  memcpy(p, &v, sizeof(v));
+}
+
+/**
+ * @brief Loads `n < MU_VLEN` elements and fills the remaining lanes with
+ * `fill`, so tail lanes never trigger slow paths.
+ */
+static inline mu_vf64 mu_v_load_partial(const double *p, size_t n,
+                                        double fill) {
+  double buf[MU_VLEN];
+  for (size_t i = 0; i < MU_VLEN; ++i) {
+    buf[i] = (i < n) ? p[i] : fill;
+  }
+  return mu_v_load(buf);
+}
+
+static inline void mu_v_store_partial(double *p, mu_vf64 v, size_t n) {
+  double buf[MU_VLEN];
+  mu_v_store(buf, v);
+  memcpy(p, buf, n * sizeof(double));
+}
+
+static inline mu_vf64 mu_v_dup(double x) {
+  mu_vf64 v;
+  for (int i = 0; i < MU_VLEN; ++i) {
+    v[i] = x;
+  }
+  return v;
+}
+
+static inline mu_vf64 mu_v_select(mu_vi64 mask, mu_vf64 a, mu_vf64 b) {
+  return (mu_vf64)(((mu_vi64)a & mask) | ((mu_vi64)b & ~mask));
+}
+
+static inline int mu_v_any(mu_vi64 mask) {
+  long long acc = 0;
+  for (int i = 0; i < MU_VLEN; ++i) {
+    acc |= mask[i];
+  }
+  return acc != 0;
+}
+
+static inline int mu_v_all(mu_vi64 mask) {
+  long long acc = -1;
+  for (int i = 0; i < MU_VLEN; ++i) {
+    acc &= mask[i];
+  }
+  return acc != 0;
+}
+
+static inline mu_vf64 mu_v_abs(mu_vf64 x) {
+  return (mu_vf64)((mu_vi64)x & MU_ABS_MASK);
+}
+
+static inline mu_vf64 mu_v_copysign(mu_vf64 mag, mu_vf64 sgn) {
+  return (mu_vf64)(((mu_vi64)mag & MU_ABS_MASK) |
+                   ((mu_vi64)sgn & MU_SIGN_MASK));
+}
+
+static inline mu_vi64 mu_v_isnan(mu_vf64 x) { return x != x; }
+
+static inline mu_vi64 mu_v_isinf(mu_vf64 x) {
+  return mu_v_abs(x) == 1.0 / 0.0;
+}
+
+static inline mu_vf64 mu_v_two_sum(mu_vf64 a, mu_vf64 b, mu_vf64 *e) {
+  mu_vf64 s = a + b;
+  mu_vf64 bb = s - a;
+  *e = (a - (s - bb)) + (b - bb);
+  return s;
+}
+
+static inline mu_vf64 mu_v_two_prod(mu_vf64 a, mu_vf64 b, mu_vf64 *e) {
+  mu_vf64 p = a * b;
+#if defined(__AVX512F__)
+  *e = (mu_vf64)_mm512_fmsub_pd((__m512d)a, (__m512d)b, (__m512d)p);
+#elif defined(__FMA__) && defined(__AVX__)
+  *e = (mu_vf64)_mm256_fmsub_pd((__m256d)a, (__m256d)b, (__m256d)p);
+#elif defined(__FMA__)
+  *e = (mu_vf64)_mm_fmsub_pd((__m128d)a, (__m128d)b, (__m128d)p);
+#else
+  mu_vf64 as = a * 134217729.0;
+  mu_vf64 bs = b * 134217729.0;
+  mu_vf64 ah = as - (as - a);
+  mu_vf64 bh = bs - (bs - b);
+  mu_vf64 al = a - ah;
+  mu_vf64 bl = b - bh;
+  *e = ((ah * bh - p) + ah * bl + al * bh) + al * bl;
+#endif
+  return p;
+}
+
+#if defined(__FMA__) || defined(__AVX512F__)
+/* c - a * b with a single rounding; only where the target has FMA. */
+static inline mu_vf64 mu_v_fnma(mu_vf64 a, mu_vf64 b, mu_vf64 c) {
+#if defined(__AVX512F__)
+  return (mu_vf64)_mm512_fnmadd_pd((__m512d)a, (__m512d)b, (__m512d)c);
+#elif defined(__AVX__)
+  return (mu_vf64)_mm256_fnmadd_pd((__m256d)a, (__m256d)b, (__m256d)c);
+#else
+  return (mu_vf64)_mm_fnmadd_pd((__m128d)a, (__m128d)b, (__m128d)c);
+#endif
+}
+#endif
+
+/*
+ * Loads table[idx[i]] into every lane, with a hardware gather where the
+ * instruction set has one.
+ */
+static inline mu_vf64 mu_v_gather(const double *table, mu_vi64 idx) {
+#if defined(__AVX512F__)
+  return (mu_vf64)_mm512_i64gather_pd((__m512i)idx, table, 8);
+#elif defined(__AVX2__)
+  return (mu_vf64)_mm256_i64gather_pd(table, (__m256i)idx, 8);
+#else
+  mu_vf64 v;
+  for (int i = 0; i < MU_VLEN; ++i) {
+    v[i] = table[idx[i]];
+  }
+  return v;
+#endif
+}
+
+static inline mu_vf64 mu_v_sqrt(mu_vf64 x) {
+#if defined(__AVX512F__)
+  return (mu_vf64)_mm512_sqrt_pd((__m512d)x);
+#elif defined(__AVX__)
+  return (mu_vf64)_mm256_sqrt_pd((__m256d)x);
+#elif defined(__SSE2__)
+  return (mu_vf64)_mm_sqrt_pd((__m128d)x);
+#else
+  for (int i = 0; i < MU_VLEN; ++i) {
+    x[i] = __builtin_sqrt(x[i]);
+  }
+  return x;
+#endif
+}
+
+/**
+ * @brief Number of single-precision lanes in one vector: twice `MU_VLEN`, so
+ * 16 lanes for AVX-512, 8 for AVX/AVX2 and 4 for SSE2.
+ */
+#define MU_VLENF (2 * MU_VLEN)
+
+/**
+ * @brief Vector of `MU_VLENF` single-precision lanes.
+ */
+typedef float mu_vf32 __attribute__((vector_size(MU_VLENF * sizeof(float))));
+
+/**
+ * @brief Vector of `MU_VLENF` signed 32-bit lanes, also used as a lane mask.
+ */
+typedef int mu_vi32 __attribute__((vector_size(MU_VLENF * sizeof(int))));
+
+/* One half of a float vector, converted to and from a whole mu_vf64. */
+typedef float mu_vf32h __attribute__((vector_size(MU_VLEN * sizeof(float))));
+typedef int mu_vi32h __attribute__((vector_size(MU_VLEN * sizeof(int))));
+
+#define MU_SIGN_MASK_F ((int)0x80000000U)
+#define MU_ABS_MASK_F 0x7fffffff
+
+static inline mu_vf32 mu_vf_load(const float *p) {
+  mu_vf32 v;
+  memcpy(&v, p, sizeof(v));
+  return v;
+}
+
+static inline void mu_vf_store(float *p, mu_vf32 v) {
+  memcpy(p, &v, sizeof(v));
+}
+
+static inline mu_vf32 mu_vf_load_partial(const float *p, size_t n,
+                                         float fill) {
+  float buf[MU_VLENF];
+  for (size_t i = 0; i < MU_VLENF; ++i) {
+    buf[i] = (i < n) ? p[i] : fill;
+  }
+  return mu_vf_load(buf);
+}
+
+static inline void mu_vf_store_partial(float *p, mu_vf32 v, size_t n) {
+  float buf[MU_VLENF];
+  mu_vf_store(buf, v);
+  memcpy(p, buf, n * sizeof(float));
+}
+
+static inline mu_vf32 mu_vf_dup(float x) {
+  mu_vf32 v;
+  for (int i = 0; i < MU_VLENF; ++i) {
+    v[i] = x;
+  }
+  return v;
+}
+
+static inline mu_vf32 mu_vf_select(mu_vi32 mask, mu_vf32 a, mu_vf32 b) {
+  return (mu_vf32)(((mu_vi32)a & mask) | ((mu_vi32)b & ~mask));
+}
+
+static inline int mu_vf_any(mu_vi32 mask) {
+  int acc = 0;
+  for (int i = 0; i < MU_VLENF; ++i) {
+    acc |= mask[i];
+  }
+  return acc != 0;
+}
+
+static inline mu_vf32 mu_vf_abs(mu_vf32 x) {
+  return (mu_vf32)((mu_vi32)x & MU_ABS_MASK_F);
+}
+
+static inline mu_vf32 mu_vf_copysign(mu_vf32 mag, mu_vf32 sgn) {
+  return (mu_vf32)(((mu_vi32)mag & MU_ABS_MASK_F) |
+                   ((mu_vi32)sgn & MU_SIGN_MASK_F));
+}
+
+static inline mu_vi32 mu_vf_isnan(mu_vf32 x) { return x != x; }
+
+static inline mu_vi32 mu_vf_isinf(mu_vf32 x) {
+  return mu_vf_abs(x) == 1.0f / 0.0f;
+}
+
+static inline mu_vf32 mu_vf_sqrt(mu_vf32 x) {
+#if defined(__AVX512F__)
+  return (mu_vf32)_mm512_sqrt_ps((__m512)x);
+#elif defined(__AVX__)
+  return (mu_vf32)_mm256_sqrt_ps((__m256)x);
+#elif defined(__SSE2__)
+  return (mu_vf32)_mm_sqrt_ps((__m128)x);
+#else
+  for (int i = 0; i < MU_VLENF; ++i) {
+    x[i] = __builtin_sqrtf(x[i]);
+  }
+  return x;
+#endif
+}
+
+/*
+ * Rounds every lane in the `_MM_FROUND_*` direction `mode` with one
+ * instruction. Defined only where SSE4.1 or later is enabled; the kernels
+ * fall back to the 2^52 and 2^23 addition otherwise.
+ */
+#if defined(__AVX512F__)
+#define MU_V_ROUND(x, mode) \
+  ((mu_vf64)_mm512_roundscale_pd((__m512d)(x), (mode) | _MM_FROUND_NO_EXC))
+#define MU_VF_ROUND(x, mode) \
+  ((mu_vf32)_mm512_roundscale_ps((__m512)(x), (mode) | _MM_FROUND_NO_EXC))
+#elif defined(__AVX__)
+#define MU_V_ROUND(x, mode) \
+  ((mu_vf64)_mm256_round_pd((__m256d)(x), (mode) | _MM_FROUND_NO_EXC))
+#define MU_VF_ROUND(x, mode) \
+  ((mu_vf32)_mm256_round_ps((__m256)(x), (mode) | _MM_FROUND_NO_EXC))
+#elif defined(__SSE4_1__)
+#define MU_V_ROUND(x, mode) \
+  ((mu_vf64)_mm_round_pd((__m128d)(x), (mode) | _MM_FROUND_NO_EXC))
+#define MU_VF_ROUND(x, mode) \
+  ((mu_vf32)_mm_round_ps((__m128)(x), (mode) | _MM_FROUND_NO_EXC))
+#endif
+
+/* Converts the two halves of a float vector to double vectors, exactly. */
+static inline void mu_vf_widen(mu_vf32 x, mu_vf64 *lo, mu_vf64 *hi) {
+  mu_vf32h h[2];
+  memcpy(h, &x, sizeof(x));
+  *lo = __builtin_convertvector(h[0], mu_vf64);
+  *hi = __builtin_convertvector(h[1], mu_vf64);
+}
+
+/* Rounds two double vectors to the halves of one float vector. */
+static inline mu_vf32 mu_vf_narrow(mu_vf64 lo, mu_vf64 hi) {
+  mu_vf32h h[2] = {__builtin_convertvector(lo, mu_vf32h),
+                   __builtin_convertvector(hi, mu_vf32h)};
+  mu_vf32 x;
+  memcpy(&x, h, sizeof(x));
+  return x;
+}
+
+static inline mu_vi32 mu_vf_narrow_int(mu_vi64 lo, mu_vi64 hi) {
+  mu_vi32h h[2] = {__builtin_convertvector(lo, mu_vi32h),
+                   __builtin_convertvector(hi, mu_vi32h)};
+  mu_vi32 n;
+  memcpy(&n, h, sizeof(n));
+  return n;
+}
+
+#endif  // MATH_MATH_UTILS_SIMD_H_
@@ -0,0 +1,108 @@
+#include <string.h>
+
+#include "math_utils.h"
+#include "math_utils_internal.h"
+
+#if defined(MU_STATS)
+#include <pthread.h>
+
+_Thread_local mu_stats_block mu_stats_local;
+
+/*
+ * Blocks of live threads, and the sums of the threads that have exited. The
+ * list and `mu_stats_retired` are guarded by the lock.
+ */
+static pthread_mutex_t mu_stats_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_once_t mu_stats_once = PTHREAD_ONCE_INIT;
+static pthread_key_t mu_stats_key;
+static mu_stats_block *mu_stats_threads;
+static unsigned long long mu_stats_retired[MU_STATS_FUNCS][MU_STATS_SLOTS];
+
+/* Folds an exiting thread's counts into the retired sums. */
+static void mu_stats_retire(void *arg) {
+  mu_stats_block *block = arg;
+
+  pthread_mutex_lock(&mu_stats_lock);
+  for (mu_stats_block **p = &mu_stats_threads; *p; p = &(*p)->next) {
+    if (*p == block) {
+      *p = block->next;
+      break;
+    }
+  }
+  for (int f = 0; f < MU_STATS_FUNCS; ++f) {
+    for (int s = 0; s < MU_STATS_SLOTS; ++s) {
+      mu_stats_retired[f][s] +=
+          atomic_load_explicit(&block->count[f][s], memory_order_relaxed);
+    }
+  }
+  pthread_mutex_unlock(&mu_stats_lock);
+}
+
+static void mu_stats_init(void) {
+  pthread_key_create(&mu_stats_key, mu_stats_retire);
+}
+
+void mu_stats_register(void) {
+  pthread_once(&mu_stats_once, mu_stats_init);
+
+  pthread_mutex_lock(&mu_stats_lock);
+  mu_stats_local.next = mu_stats_threads;
+  mu_stats_threads = &mu_stats_local;
+  pthread_mutex_unlock(&mu_stats_lock);
+
+  pthread_setspecific(mu_stats_key, &mu_stats_local);
+  mu_stats_local.registered = 1;
+}
+
+static void mu_stats_unpack(const unsigned long long *slots,
+                            mu_stats_counters *c) {
+  c->calls = slots[MU_STATS_SLOT_CALLS];
+  c->nan = slots[MU_STATS_SLOT_NAN];
+  c->inf = slots[MU_STATS_SLOT_INF];
+  c->domain = slots[MU_STATS_SLOT_DOMAIN];
+  c->range = slots[MU_STATS_SLOT_RANGE];
+  c->slow = slots[MU_STATS_SLOT_SLOW];
+  memcpy(c->magnitude, slots + MU_STATS_SLOT_MAGNITUDE, sizeof(c->magnitude));
+}
+
+void mu_stats_snapshot(mu_stats *out) {
+  unsigned long long sum[MU_STATS_FUNCS][MU_STATS_SLOTS];
+
+  pthread_mutex_lock(&mu_stats_lock);
+  memcpy(sum, mu_stats_retired, sizeof(sum));
+  for (mu_stats_block *b = mu_stats_threads; b; b = b->next) {
+    for (int f = 0; f < MU_STATS_FUNCS; ++f) {
+      for (int s = 0; s < MU_STATS_SLOTS; ++s) {
+        sum[f][s] +=
+            atomic_load_explicit(&b->count[f][s], memory_order_relaxed);
+      }
+    }
+  }
+  pthread_mutex_unlock(&mu_stats_lock);
+
+  out->enabled = 1;
+  for (int f = 0; f < MU_STATS_FUNCS; ++f) {
+    mu_stats_unpack(sum[f], &out->func[f]);
+  }
+}
+
+void mu_stats_reset(void) {
+  pthread_mutex_lock(&mu_stats_lock);
+  memset(mu_stats_retired, 0, sizeof(mu_stats_retired));
+  for (mu_stats_block *b = mu_stats_threads; b; b = b->next) {
+    for (int f = 0; f < MU_STATS_FUNCS; ++f) {
+      for (int s = 0; s < MU_STATS_SLOTS; ++s) {
+        atomic_store_explicit(&b->count[f][s], 0, memory_order_relaxed);
+      }
+    }
+  }
+  pthread_mutex_unlock(&mu_stats_lock);
+}
+
+#else
+
+void mu_stats_snapshot(mu_stats *out) { memset(out, 0, sizeof(*out)); }
+
+void mu_stats_reset(void) {}
+
+#endif
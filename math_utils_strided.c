@@ -0,0 +1,142 @@
+#include <string.h>
+
+#include "math_utils.h"
+#include "math_utils_internal.h"
+
+/* Elements per block: the two buffers of a binary call take 4 KB of L1. */
+#define MU_STRIDE_BLOCK 256
+
+const mu_unary_fn mu_fn_table[MU_FN_COUNT] = {
+    [MU_FN_FABS] = mu_fabs_n,
+    [MU_FN_TRUNC] = mu_trunc_n,
+    [MU_FN_CEIL] = mu_ceil_n,
+    [MU_FN_FLOOR] = mu_floor_n,
+    [MU_FN_SIN] = mu_sin_n,
+    [MU_FN_COS] = mu_cos_n,
+    [MU_FN_TAN] = mu_tan_n,
+    [MU_FN_ASIN] = mu_asin_n,
+    [MU_FN_ACOS] = mu_acos_n,
+    [MU_FN_ATAN] = mu_atan_n,
+    [MU_FN_SQRT] = mu_sqrt_n,
+    [MU_FN_RSQRT] = mu_rsqrt_n,
+    [MU_FN_EXP] = mu_exp_n,
+    [MU_FN_LOG] = mu_log_n,
+    [MU_FN_SIN_FAST] = mu_sin_fast_n,
+    [MU_FN_SIN_MEDIUM] = mu_sin_medium_n,
+    [MU_FN_COS_FAST] = mu_cos_fast_n,
+    [MU_FN_COS_MEDIUM] = mu_cos_medium_n,
+    [MU_FN_EXP_FAST] = mu_exp_fast_n,
+    [MU_FN_EXP_MEDIUM] = mu_exp_medium_n,
+    [MU_FN_LOG_FAST] = mu_log_fast_n,
+    [MU_FN_LOG_MEDIUM] = mu_log_medium_n,
+    [MU_FN_ROUND] = mu_round_n,
+    [MU_FN_NEARBYINT] = mu_nearbyint_n,
+    [MU_FN_SINPI] = mu_sinpi_n,
+    [MU_FN_COSPI] = mu_cospi_n,
+    [MU_FN_TANPI] = mu_tanpi_n,
+    [MU_FN_SIND] = mu_sind_n,
+    [MU_FN_COSD] = mu_cosd_n,
+    [MU_FN_SINH] = mu_sinh_n,
+    [MU_FN_COSH] = mu_cosh_n,
+    [MU_FN_TANH] = mu_tanh_n,
+    [MU_FN_ASINH] = mu_asinh_n,
+    [MU_FN_ACOSH] = mu_acosh_n,
+    [MU_FN_ATANH] = mu_atanh_n,
+    [MU_FN_EXP2] = mu_exp2_n,
+    [MU_FN_EXP10] = mu_exp10_n,
+    [MU_FN_EXPM1] = mu_expm1_n,
+    [MU_FN_LOG2] = mu_log2_n,
+    [MU_FN_LOG10] = mu_log10_n,
+    [MU_FN_LOG1P] = mu_log1p_n,
+};
+
+const mu_binary_fn mu_fn2_table[MU_FN2_COUNT] = {
+    [MU_FN2_FMOD] = mu_fmod_n,
+    [MU_FN2_ATAN2] = mu_atan2_n,
+    [MU_FN2_POW] = mu_pow_n,
+    [MU_FN2_REMAINDER] = mu_remainder_n,
+};
+
+/*
+ * Returns the `n` elements at `p` with stride `stride` as a contiguous array:
+ * `p` itself for unit strides, otherwise `buf` filled with a copy.
+ */
+static const double *mu_gather(const double *p, ptrdiff_t stride,
+                               double *buf, size_t n) {
+  if (stride == 1) {
+    return p;
+  }
+  if (stride == 0) {
+    for (size_t i = 0; i < n; ++i) {
+      buf[i] = p[0];
+    }
+    return buf;
+  }
+  for (size_t i = 0; i < n; ++i) {
+    buf[i] = p[(ptrdiff_t)i * stride];
+  }
+  return buf;
+}
+
+static void mu_scatter(double *p, ptrdiff_t stride, const double *buf,
+                       size_t n) {
+  if (stride == 1) {
+    if (p != buf) {
+      memcpy(p, buf, n * sizeof(double));
+    }
+    return;
+  }
+  for (size_t i = 0; i < n; ++i) {
+    p[(ptrdiff_t)i * stride] = buf[i];
+  }
+}
+
+int mu_apply_strided(mu_fn_id fn, const double *in, ptrdiff_t in_stride,
+                     double *out, ptrdiff_t out_stride, size_t n) {
+  if ((int)fn < 0 || fn >= MU_FN_COUNT) {
+    return -1;
+  }
+  if (in_stride == 1 && out_stride == 1) {
+    mu_fn_table[fn](in, out, n);
+    return 0;
+  }
+
+  double buf[MU_STRIDE_BLOCK];
+  for (size_t i = 0; i < n; i += MU_STRIDE_BLOCK) {
+    size_t len = n - i < MU_STRIDE_BLOCK ? n - i : MU_STRIDE_BLOCK;
+    double *dst = out + (ptrdiff_t)i * out_stride;
+    double *res = out_stride == 1 ? dst : buf;
+    mu_fn_table[fn](mu_gather(in + (ptrdiff_t)i * in_stride, in_stride, buf,
+                              len),
+                    res, len);
+    mu_scatter(dst, out_stride, res, len);
+  }
+  return 0;
+}
+
+int mu_apply2_strided(mu_fn2_id fn, const double *x, ptrdiff_t x_stride,
+                      const double *y, ptrdiff_t y_stride, double *out,
+                      ptrdiff_t out_stride, size_t n) {
+  if ((int)fn < 0 || fn >= MU_FN2_COUNT) {
+    return -1;
+  }
+  if (x_stride == 1 && y_stride == 1 && out_stride == 1) {
+    mu_fn2_table[fn](x, y, out, n);
+    return 0;
+  }
+
+  double xbuf[MU_STRIDE_BLOCK];
+  double ybuf[MU_STRIDE_BLOCK];
+  for (size_t i = 0; i < n; i += MU_STRIDE_BLOCK) {
+    size_t len = n - i < MU_STRIDE_BLOCK ? n - i : MU_STRIDE_BLOCK;
+    double *dst = out + (ptrdiff_t)i * out_stride;
+    double *res = out_stride == 1 ? dst : xbuf;
+    const double *vx =
+        mu_gather(x + (ptrdiff_t)i * x_stride, x_stride, xbuf, len);
+    const double *vy =
+        mu_gather(y + (ptrdiff_t)i * y_stride, y_stride, ybuf, len);
+    mu_fn2_table[fn](vx, vy, res, len);
+    mu_scatter(dst, out_stride, res, len);
+  }
+  return 0;
+}
@@ -0,0 +1,81 @@
+#include "math_utils.h"
+#include "math_utils_internal.h"
+
+/*
+ * Reduced-accuracy tiers. Special values follow the `_d` functions; only the
+ * kernels differ.
+ */
+
+static inline double mu_sin_tier(double x, int tier) {
+  if (x != x || mu_fabs_d(x) == MU_INF) {
+    return MU_NAN;
+  }
+
+  double r;
+  int n = mu_rem_pio2_short(x, &r);
+  double res =
+      (n & 1) ? mu_cos_tier_kernel(r, tier) : mu_sin_tier_kernel(r, tier);
+
+  return (n & 2) ? -res : res;
+}
+
+static inline double mu_cos_tier(double x, int tier) {
+  if (x != x || mu_fabs_d(x) == MU_INF) {
+    return MU_NAN;
+  }
+
+  double r;
+  int n = mu_rem_pio2_short(x, &r);
+  double res =
+      (n & 1) ? mu_sin_tier_kernel(r, tier) : mu_cos_tier_kernel(r, tier);
+
+  return ((n + 1) & 2) ? -res : res;
+}
+
+static inline double mu_exp_tier(double x, int tier) {
+  if (x != x) {
+    return MU_NAN;
+  }
+  if (x > MU_EXP_OVERFLOW) {
+    return MU_INF;
+  }
+  if (x < MU_EXP_UNDERFLOW) {
+    return 0.0;
+  }
+
+  return mu_exp_tier_kernel(x, tier);
+}
+
+static inline double mu_log_tier(double x, int tier) {
+  /* Positive normal inputs pass one unsigned compare. */
+  if (mu_as_u64(x) - 0x0010000000000000ULL < 0x7fe0000000000000ULL) {
+    return mu_log_tier_kernel(x, tier);
+  }
+  if (x == 0.0) {
+    return -MU_INF;
+  }
+  if (x < 0 || x != x) {
+    return MU_NAN;
+  }
+  if (x == MU_INF) {
+    return MU_INF;
+  }
+
+  return mu_log_tier_kernel(x, tier);
+}
+
+double mu_sin_fast(double x) { return mu_sin_tier(x, MU_ACCURACY_FAST); }
+
+double mu_sin_medium(double x) { return mu_sin_tier(x, MU_ACCURACY_MEDIUM); }
+
+double mu_cos_fast(double x) { return mu_cos_tier(x, MU_ACCURACY_FAST); }
+
+double mu_cos_medium(double x) { return mu_cos_tier(x, MU_ACCURACY_MEDIUM); }
+
+double mu_exp_fast(double x) { return mu_exp_tier(x, MU_ACCURACY_FAST); }
+
+double mu_exp_medium(double x) { return mu_exp_tier(x, MU_ACCURACY_MEDIUM); }
+
+double mu_log_fast(double x) { return mu_log_tier(x, MU_ACCURACY_FAST); }
+
+double mu_log_medium(double x) { return mu_log_tier(x, MU_ACCURACY_MEDIUM); }
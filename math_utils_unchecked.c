@@ -0,0 +1,57 @@
+#include "math_utils.h"
+#include "math_utils_internal.h"
+
+/*
+ * Unchecked forms of the `_d` functions: the same kernels without the
+ * special-value tests and without instrumentation. Inputs outside the
+ * documented domain give unspecified results.
+ */
+
+double mu_sin_unchecked(double x) {
+  double hi, lo;
+  int n = mu_rem_pio2(x, &hi, &lo);
+  double res = (n & 1) ? mu_cos_kernel(hi, lo) : mu_sin_kernel(hi, lo);
+
+  return (n & 2) ? -res : res;
+}
+
+double mu_cos_unchecked(double x) {
+  double hi, lo;
+  int n = mu_rem_pio2(x, &hi, &lo);
+  double res = (n & 1) ? mu_sin_kernel(hi, lo) : mu_cos_kernel(hi, lo);
+
+  return ((n + 1) & 2) ? -res : res;
+}
+
+void mu_sincos_unchecked(double x, double *s, double *c) {
+  double hi, lo;
+  int n = mu_rem_pio2(x, &hi, &lo);
+  double sin_r = mu_sin_kernel(hi, lo);
+  double cos_r = mu_cos_kernel(hi, lo);
+
+  *s = (n & 1) ? cos_r : sin_r;
+  *c = (n & 1) ? sin_r : cos_r;
+  if (n & 2) {
+    *s = -*s;
+  }
+  if ((n + 1) & 2) {
+    *c = -*c;
+  }
+}
+
+double mu_tan_unchecked(double x) {
+  double hi, lo;
+  int n = mu_rem_pio2(x, &hi, &lo);
+
+  return mu_tan_kernel(hi, lo, n & 1);
+}
+
+double mu_asin_unchecked(double x) { return mu_asin_kernel(x); }
+
+double mu_acos_unchecked(double x) { return mu_acos_kernel(x); }
+
+double mu_sqrt_unchecked(double x) { return mu_sqrt_kernel(x); }
+
+double mu_exp_unchecked(double x) { return mu_exp_kernel(x, 0.0); }
+
+double mu_log_unchecked(double x) { return mu_log_kernel(x); }
@@ -1,6 +1,8 @@
 #include <check.h>
+#include <float.h>
 #include <math.h>
 #include <stdlib.h>
+#include <string.h>
 #include <time.h>
 
 #include "math_utils.h"
@@ -61,6 +63,175 @@ void run_random_tests_2args(long double (*mu_func)(double, double),
   }
 }
 
+double rsqrt(double x) { return 1.0 / sqrt(x); }
+
+float rsqrtf(float x) { return (float)(1.0 / sqrt(x)); }
+
+double sinpi_ref(double x) { return sin(MU_PI * x); }
+
+double cospi_ref(double x) { return cos(MU_PI * x); }
+
+double tanpi_ref(double x) { return tan(MU_PI * x); }
+
+double sind_ref(double x) { return sin(x * (MU_PI / 180.0)); }
+
+double cosd_ref(double x) { return cos(x * (MU_PI / 180.0)); }
+
+#define BATCH_SIZE 1001
+
+void run_batch_tests(void (*mu_batch)(const double *, double *, size_t),
+                     double (*std_func)(double), double start, double end,
+                     double tolerance) {
+  double in[BATCH_SIZE], out[BATCH_SIZE];
+  for (size_t i = 0; i < BATCH_SIZE; ++i) {
+    in[i] = start + (end - start) * (double)i / BATCH_SIZE;
+  }
+
+  mu_batch(in, out, BATCH_SIZE);
+
+  for (size_t i = 0; i < BATCH_SIZE; ++i) {
+    ck_assert_ldouble_eq_tol(out[i], std_func(in[i]), tolerance);
+  }
+}
+
+void check_batch_result(double result, long double expected) {
+  if (expected != expected) {
+    ck_assert_ldouble_nan(result);
+  } else if (expected == MU_INF || expected == -MU_INF) {
+    ck_assert_ldouble_eq(result, expected);
+  } else {
+    long double scale = (expected > 1.0 || expected < -1.0) ? expected : 1.0;
+    ck_assert_ldouble_eq_tol(result / scale, expected / scale, MU_EPS6);
+  }
+}
+
+void run_batch_special_tests(void (*mu_batch)(const double *, double *,
+                                              size_t),
+                             long double (*mu_func)(double)) {
+  double in[] = {MU_NAN, MU_INF, -MU_INF, 0.0,    -0.0,  1.0,
+                 -1.0,   0.5,    -0.5,    MU_PI, -MU_E, 10.0};
+  size_t n = sizeof(in) / sizeof(in[0]);
+  double out[sizeof(in) / sizeof(in[0])];
+
+  mu_batch(in, out, n);
+
+  for (size_t i = 0; i < n; ++i) {
+    check_batch_result(out[i], mu_func(in[i]));
+  }
+}
+
+void run_batch_tests_2args(void (*mu_batch)(const double *, const double *,
+                                            double *, size_t),
+                           long double (*mu_func)(double, double)) {
+  double values[] = {MU_NAN, MU_INF, -MU_INF, -10.0, -1.0, -0.1, 0.0,
+                     0.1,    1.0,    9.0,     10.0,  MU_PI, -MU_E};
+  size_t count = sizeof(values) / sizeof(values[0]);
+  double x[sizeof(values) / sizeof(values[0]) * sizeof(values) /
+           sizeof(values[0])];
+  double y[sizeof(x) / sizeof(x[0])], out[sizeof(x) / sizeof(x[0])];
+
+  for (size_t i = 0; i < count; ++i) {
+    for (size_t j = 0; j < count; ++j) {
+      x[i * count + j] = values[i];
+      y[i * count + j] = values[j];
+    }
+  }
+
+  mu_batch(x, y, out, count * count);
+
+  for (size_t i = 0; i < count * count; ++i) {
+    check_batch_result(out[i], mu_func(x[i], y[i]));
+  }
+}
+
+void run_double_tests(double (*mu_func_d)(double),
+                      double (*std_func)(double), double start, double end) {
+  for (size_t i = 0; i < BATCH_SIZE; ++i) {
+    double x = start + (end - start) * (double)i / BATCH_SIZE;
+    double expected = std_func(x);
+    double scale = fabs(expected) > 1.0 ? fabs(expected) : 1.0;
+    ck_assert_double_eq_tol(mu_func_d(x) / scale, expected / scale,
+                            4 * DBL_EPSILON);
+  }
+}
+
+void run_double_special_tests(double (*mu_func_d)(double),
+                              long double (*mu_func)(double)) {
+  double in[] = {MU_NAN, MU_INF, -MU_INF, 0.0,    -0.0,  1.0,
+                 -1.0,   0.5,    -0.5,    MU_PI, -MU_E, 10.0};
+
+  for (size_t i = 0; i < sizeof(in) / sizeof(in[0]); ++i) {
+    check_batch_result(mu_func_d(in[i]), mu_func(in[i]));
+  }
+}
+
+void run_float_tests(float (*mu_func_f)(float), float (*std_func)(float),
+                     float start, float end, float ulps) {
+  for (size_t i = 0; i < BATCH_SIZE; ++i) {
+    float x = start + (end - start) * (float)i / BATCH_SIZE;
+    float expected = std_func(x);
+    float scale = fabsf(expected) > 1.0f ? fabsf(expected) : 1.0f;
+    ck_assert_float_eq_tol(mu_func_f(x) / scale, expected / scale,
+                           ulps * FLT_EPSILON);
+  }
+}
+
+/*
+ * Checks a float batch function against its scalar form, which it must match
+ * bit for bit, on a range plus the special values.
+ */
+void run_float_batch_tests(void (*mu_batch)(const float *, float *, size_t),
+                           float (*mu_func_f)(float), float start,
+                           float end) {
+  float in[BATCH_SIZE], out[BATCH_SIZE];
+  for (size_t i = 0; i < BATCH_SIZE; ++i) {
+    in[i] = start + (end - start) * (float)i / BATCH_SIZE;
+  }
+  float special[] = {MU_NAN, MU_INF, -MU_INF, 0.0f, -0.0f, 1.0f, -1.0f, 0.5f};
+  memcpy(in, special, sizeof(special));
+
+  mu_batch(in, out, BATCH_SIZE);
+
+  for (size_t i = 0; i < BATCH_SIZE; ++i) {
+    float expected = mu_func_f(in[i]);
+    if (expected != expected) {
+      ck_assert_float_nan(out[i]);
+    } else {
+      ck_assert_float_eq(out[i], expected);
+      ck_assert_int_eq(!signbit(out[i]), !signbit(expected));
+    }
+  }
+}
+
+/*
+ * Checks a tiered function and its batch form against libm, with the error
+ * taken relative to max(1, |expected|), and its special values against the
+ * full-accuracy function.
+ */
+void run_tier_tests(double (*mu_func)(double),
+                    void (*mu_batch)(const double *, double *, size_t),
+                    long double (*mu_full)(double),
+                    double (*std_func)(double), double start, double end,
+                    double tolerance) {
+  double in[BATCH_SIZE], out[BATCH_SIZE];
+  for (size_t i = 0; i < BATCH_SIZE; ++i) {
+    in[i] = start + (end - start) * (double)i / BATCH_SIZE;
+  }
+
+  mu_batch(in, out, BATCH_SIZE);
+
+  for (size_t i = 0; i < BATCH_SIZE; ++i) {
+    double expected = std_func(in[i]);
+    double scale = fabs(expected) > 1.0 ? fabs(expected) : 1.0;
+    ck_assert_double_eq_tol(mu_func(in[i]) / scale, expected / scale,
+                            tolerance);
+    ck_assert_double_eq(out[i], mu_func(in[i]));
+  }
+
+  run_double_special_tests(mu_func, mu_full);
+  run_batch_special_tests(mu_batch, mu_full);
+}
+
 START_TEST(test_mu_abs) {
   for (int x = -10000; x < 10000; ++x) {
     ck_assert_int_eq(mu_abs(x), abs(x));
@@ -117,6 +288,68 @@ START_TEST(test_mu_floor) {
 }
 END_TEST
 
+START_TEST(test_mu_round) {
+  run_range_tests(mu_round, round, -1000.0, 1000.0, 0.1, MU_EPS6);
+  run_const_tests(mu_round, round, MU_EPS6);
+  run_random_tests(mu_round, round, -MU_E10, MU_E10, MU_EPS6);
+
+  double halves[] = {0.5, -0.5, 1.5, -2.5, 0.49999999999999994, 0x1p52 + 1.0};
+  for (size_t i = 0; i < sizeof(halves) / sizeof(halves[0]); ++i) {
+    ck_assert_ldouble_eq(mu_round(halves[i]), round(halves[i]));
+  }
+  ck_assert(signbit((double)mu_round(-0.25)));
+  ck_assert_ldouble_nan(mu_round(MU_NAN));
+  ck_assert_ldouble_eq(mu_round(MU_INF), round(MU_INF));
+  ck_assert_ldouble_eq(mu_round(-MU_INF), round(-MU_INF));
+}
+END_TEST
+
+START_TEST(test_mu_nearbyint) {
+  run_range_tests(mu_nearbyint, nearbyint, -1000.0, 1000.0, 0.1, MU_EPS6);
+  run_random_tests(mu_nearbyint, nearbyint, -MU_E10, MU_E10, MU_EPS6);
+
+  double halves[] = {0.5, -0.5, 1.5, -2.5, 0.49999999999999994, 0x1p52 + 1.0};
+  for (size_t i = 0; i < sizeof(halves) / sizeof(halves[0]); ++i) {
+    ck_assert_ldouble_eq(mu_nearbyint(halves[i]), nearbyint(halves[i]));
+  }
+  ck_assert(signbit((double)mu_nearbyint(-0.25)));
+  ck_assert_ldouble_nan(mu_nearbyint(MU_NAN));
+  ck_assert_ldouble_eq(mu_nearbyint(-MU_INF), -MU_INF);
+}
+END_TEST
+
+START_TEST(test_mu_modf) {
+  double values[] = {0.0, -0.0, 0.75, -0.75, 3.25, -1e10 - 0.5, 0x1p53,
+                     MU_INF, -MU_INF};
+  for (size_t i = 0; i < sizeof(values) / sizeof(values[0]); ++i) {
+    long double ipart;
+    double expected_ipart;
+    long double frac = mu_modf(values[i], &ipart);
+    double expected = modf(values[i], &expected_ipart);
+    ck_assert_ldouble_eq(frac, expected);
+    ck_assert_ldouble_eq(ipart, expected_ipart);
+    ck_assert_int_eq(signbit((double)frac), signbit(expected));
+  }
+
+  long double ipart;
+  ck_assert_ldouble_nan(mu_modf(MU_NAN, &ipart));
+  ck_assert_ldouble_nan(ipart);
+}
+END_TEST
+
+START_TEST(test_mu_lround) {
+  double values[] = {0.5, -0.5, 2.5, -2.5, 0.49999999999999994, 1e15 + 0.5,
+                     -1000.4};
+  for (size_t i = 0; i < sizeof(values) / sizeof(values[0]); ++i) {
+    ck_assert_int_eq(mu_lround(values[i]), lround(values[i]));
+  }
+  ck_assert_int_eq(mu_lround(MU_NAN), LONG_MIN);
+  ck_assert_int_eq(mu_lround(MU_INF), LONG_MIN);
+  ck_assert_int_eq(mu_lround(1e30), LONG_MIN);
+  ck_assert_int_eq(mu_lroundf(-7.5f), -8);
+}
+END_TEST
+
 START_TEST(test_mu_fmod) {
   run_const_tests_2args(mu_fmod, fmod, MU_EPS6);
   run_random_tests_2args(mu_fmod, fmod, -MU_E10, MU_E10, -MU_E10, MU_E10,
@@ -135,6 +368,43 @@ START_TEST(test_mu_fmod) {
   ck_assert_ldouble_nan(mu_fmod(0.0, 0.0));
   ck_assert_ldouble_eq(mu_fmod(1.0, MU_INF), fmod(1.0, MU_INF));
   ck_assert_ldouble_eq(mu_fmod(MU_E10, -MU_INF), fmod(MU_E10, -MU_INF));
+  ck_assert_ldouble_eq(mu_fmod(1e300, 3.0), fmod(1e300, 3.0));
+  ck_assert_ldouble_eq(mu_fmod(-1e12, 0.1), fmod(-1e12, 0.1));
+  ck_assert_ldouble_eq(mu_fmod(1.0, 0x1p-1070), fmod(1.0, 0x1p-1070));
+}
+END_TEST
+
+START_TEST(test_mu_remainder) {
+  run_const_tests_2args(mu_remainder, remainder, MU_EPS6);
+  run_random_tests_2args(mu_remainder, remainder, -MU_E10, MU_E10, -MU_E10,
+                         MU_E10, MU_EPS6);
+
+  ck_assert_ldouble_eq(mu_remainder(6.5, 2.0), remainder(6.5, 2.0));
+  ck_assert_ldouble_eq(mu_remainder(7.0, -2.0), remainder(7.0, -2.0));
+  ck_assert_ldouble_eq(mu_remainder(1e300, 3.0), remainder(1e300, 3.0));
+  ck_assert_ldouble_eq(mu_remainder(5.0, MU_INF), 5.0);
+
+  ck_assert_ldouble_nan(mu_remainder(MU_INF, 1.0));
+  ck_assert_ldouble_nan(mu_remainder(1.0, 0.0));
+  ck_assert_ldouble_nan(mu_remainder(MU_NAN, 1.0));
+}
+END_TEST
+
+START_TEST(test_mu_remquo) {
+  double x[] = {6.5, 7.0, -7.5, 1e300, 1e12, 3.0, -0.0, 0x1p-1060};
+  double y[] = {2.0, -2.0, 2.0, 3.0, -0.1, 1e-300, 1.0, 0x1p-1070};
+
+  for (size_t i = 0; i < sizeof(x) / sizeof(x[0]); ++i) {
+    int quo, expected;
+    double r = remquo(x[i], y[i], &expected);
+    ck_assert_ldouble_eq(mu_remquo(x[i], y[i], &quo), r);
+    ck_assert_int_eq(quo & 7, expected & 7);
+    ck_assert_int_eq(quo < 0, expected < 0);
+  }
+
+  int quo = 1;
+  ck_assert_ldouble_nan(mu_remquo(MU_INF, 1.0, &quo));
+  ck_assert_int_eq(quo, 0);
 }
 END_TEST
 
@@ -150,6 +420,13 @@ START_TEST(test_mu_sin) {
   ck_assert_ldouble_eq_tol(mu_sin(-MU_PI), sin(-MU_PI), MU_EPS6);
   ck_assert_ldouble_eq_tol(mu_sin(2 * MU_PI), sin(2 * MU_PI), MU_EPS6);
   ck_assert_ldouble_eq_tol(mu_sin(-2 * MU_PI), sin(-2 * MU_PI), MU_EPS6);
+  ck_assert_ldouble_eq_tol(mu_sin(1e22), sin(1e22), MU_EPS6);
+  ck_assert_ldouble_eq_tol(mu_sin(-1e300), sin(-1e300), MU_EPS6);
+  ck_assert_ldouble_eq_tol(mu_sin(0x1.6ac5b262ca1ffp+851),
+                           sin(0x1.6ac5b262ca1ffp+851), MU_EPS6);
+
+  ck_assert(signbit(mu_sin(-0.0)));
+  ck_assert(signbit(mu_sin(-0x1p-1074)));
 
   ck_assert_ldouble_nan(mu_sin(MU_NAN));
   ck_assert_ldouble_nan(mu_sin(MU_INF));
@@ -169,6 +446,10 @@ START_TEST(test_mu_cos) {
   ck_assert_ldouble_eq_tol(mu_cos(-MU_PI), cos(-MU_PI), MU_EPS6);
   ck_assert_ldouble_eq_tol(mu_cos(2 * MU_PI), cos(2 * MU_PI), MU_EPS6);
   ck_assert_ldouble_eq_tol(mu_cos(-2 * MU_PI), cos(-2 * MU_PI), MU_EPS6);
+  ck_assert_ldouble_eq_tol(mu_cos(1e22), cos(1e22), MU_EPS6);
+  ck_assert_ldouble_eq_tol(mu_cos(-1e300), cos(-1e300), MU_EPS6);
+  ck_assert_ldouble_eq_tol(mu_cos(0x1.6ac5b262ca1ffp+851),
+                           cos(0x1.6ac5b262ca1ffp+851), MU_EPS6);
 
   ck_assert_ldouble_nan(mu_cos(MU_NAN));
   ck_assert_ldouble_nan(mu_cos(MU_INF));
@@ -187,12 +468,98 @@ START_TEST(test_mu_tan) {
   ck_assert_ldouble_eq_tol(mu_tan(2 * MU_PI), tan(2 * MU_PI), MU_EPS6);
   ck_assert_ldouble_eq_tol(mu_tan(-2 * MU_PI), tan(-2 * MU_PI), MU_EPS6);
 
+  ck_assert(signbit(mu_tan(-0.0)));
+  ck_assert(signbit(mu_tan(-1e-20)));
+
   ck_assert_ldouble_nan(mu_tan(MU_NAN));
   ck_assert_ldouble_nan(mu_tan(MU_INF));
   ck_assert_ldouble_nan(mu_tan(-MU_INF));
 }
 END_TEST
 
+START_TEST(test_mu_sincos) {
+  long double s, c;
+  for (double x = -1000.0; x < 1000.0; x += 0.1) {
+    mu_sincos(x, &s, &c);
+    ck_assert_ldouble_eq_tol(s, sin(x), MU_EPS6);
+    ck_assert_ldouble_eq_tol(c, cos(x), MU_EPS6);
+  }
+
+  mu_sincos(1e22, &s, &c);
+  ck_assert_ldouble_eq_tol(s, sin(1e22), MU_EPS6);
+  ck_assert_ldouble_eq_tol(c, cos(1e22), MU_EPS6);
+
+  mu_sincos(-0.0, &s, &c);
+  ck_assert(signbit(s));
+  ck_assert_ldouble_eq(c, 1.0);
+
+  mu_sincos(MU_NAN, &s, &c);
+  ck_assert_ldouble_nan(s);
+  ck_assert_ldouble_nan(c);
+  mu_sincos(-MU_INF, &s, &c);
+  ck_assert_ldouble_nan(s);
+  ck_assert_ldouble_nan(c);
+}
+END_TEST
+
+START_TEST(test_mu_sinpi) {
+  run_range_tests(mu_sinpi, sinpi_ref, -10.0, 10.0, 0.01, MU_EPS6);
+  run_range_tests(mu_cospi, cospi_ref, -10.0, 10.0, 0.01, MU_EPS6);
+  run_range_tests(mu_tanpi, tanpi_ref, -0.45, 0.45, 0.01, MU_EPS6);
+
+  ck_assert_ldouble_eq(mu_sinpi(0.5), 1.0);
+  ck_assert_ldouble_eq(mu_sinpi(-1.5), 1.0);
+  ck_assert_ldouble_eq(mu_cospi(1.0), -1.0);
+  ck_assert_ldouble_eq(mu_cospi(0x1p52 + 1.0), -1.0);
+  ck_assert_ldouble_eq(mu_tanpi(0.25), 1.0);
+  ck_assert_ldouble_eq(mu_sinpi(1e300), 0.0);
+  ck_assert_ldouble_eq_tol(mu_sinpi(1e15 + 0.25), sqrt(0.5), MU_EPS10);
+
+  ck_assert(!signbit(mu_sinpi(3.0)));
+  ck_assert(signbit(mu_sinpi(-2.0)));
+  ck_assert(signbit(mu_sinpi(-0.0)));
+  ck_assert(!signbit(mu_cospi(-1.5)));
+  ck_assert(signbit(mu_tanpi(1.0)));
+  ck_assert_ldouble_eq(mu_tanpi(0.5), MU_INF);
+  ck_assert_ldouble_eq(mu_tanpi(1.5), -MU_INF);
+  ck_assert_ldouble_eq(mu_tanpi(-0.5), -MU_INF);
+
+  ck_assert_ldouble_nan(mu_sinpi(MU_INF));
+  ck_assert_ldouble_nan(mu_cospi(MU_NAN));
+  ck_assert_ldouble_nan(mu_tanpi(-MU_INF));
+
+  long double s, c;
+  mu_sincospi(0.75, &s, &c);
+  ck_assert_ldouble_eq(s, mu_sinpi(0.75));
+  ck_assert_ldouble_eq(c, mu_cospi(0.75));
+}
+END_TEST
+
+START_TEST(test_mu_sind) {
+  run_range_tests(mu_sind, sind_ref, -720.0, 720.0, 0.7, MU_EPS6);
+  run_range_tests(mu_cosd, cosd_ref, -720.0, 720.0, 0.7, MU_EPS6);
+
+  ck_assert_ldouble_eq(mu_sind(30.0), 0.5);
+  ck_assert_ldouble_eq(mu_cosd(60.0), 0.5);
+  ck_assert_ldouble_eq(mu_sind(-270.0), 1.0);
+  ck_assert_ldouble_eq(mu_cosd(180.0), -1.0);
+  ck_assert_ldouble_eq(mu_sind(0x1p60), mu_sind(fmod(0x1p60, 360.0)));
+  ck_assert_ldouble_eq(mu_cosd(1e300), mu_cosd(fmod(1e300, 360.0)));
+
+  ck_assert(!signbit(mu_sind(180.0)));
+  ck_assert(signbit(mu_sind(-360.0)));
+  ck_assert(!signbit(mu_cosd(-90.0)));
+
+  ck_assert_ldouble_nan(mu_sind(MU_INF));
+  ck_assert_ldouble_nan(mu_cosd(MU_NAN));
+
+  long double s, c;
+  mu_sincosd(-135.0, &s, &c);
+  ck_assert_ldouble_eq(s, mu_sind(-135.0));
+  ck_assert_ldouble_eq(c, mu_cosd(-135.0));
+}
+END_TEST
+
 START_TEST(test_mu_asin) {
   run_range_tests(mu_asin, asin, -1.0, 1.0, 0.002, MU_EPS6);
   run_random_tests(mu_asin, asin, -0.999, 0.999, MU_EPS6);
@@ -214,6 +581,11 @@ START_TEST(test_mu_asin) {
   ck_assert_ldouble_nan(mu_asin(MU_NAN));
   ck_assert_ldouble_nan(mu_asin(MU_INF));
   ck_assert_ldouble_nan(mu_asin(-MU_INF));
+
+  run_range_tests(mu_asin, asin, 0.999, 1.0, 0.000001, MU_EPS10);
+  ck_assert_ldouble_eq_tol(mu_asin(0.9999), asin(0.9999), MU_EPS20);
+  ck_assert_ldouble_eq_tol(mu_asin(-1.0), asin(-1.0), MU_EPS20);
+  ck_assert_ldouble_eq_tol(mu_asin(1e-300), 1e-300, MU_EPS20);
 }
 END_TEST
 
@@ -239,6 +611,11 @@ START_TEST(test_mu_acos) {
   ck_assert_ldouble_nan(mu_acos(MU_NAN));
   ck_assert_ldouble_nan(mu_acos(MU_INF));
   ck_assert_ldouble_nan(mu_acos(-MU_INF));
+
+  run_range_tests(mu_acos, acos, -1.0, -0.999, 0.000001, MU_EPS10);
+  ck_assert_ldouble_eq_tol(mu_acos(0.9999), acos(0.9999), MU_EPS20);
+  ck_assert_ldouble_eq(mu_acos(1.0), 0.0);
+  ck_assert_ldouble_eq_tol(mu_acos(-1.0), acos(-1.0), MU_EPS10);
 }
 END_TEST
 
@@ -258,6 +635,30 @@ START_TEST(test_mu_atan) {
   ck_assert_ldouble_nan(mu_atan(MU_NAN));
   ck_assert_ldouble_eq_tol(mu_atan(MU_INF), atan(MU_INF), MU_EPS6);
   ck_assert_ldouble_eq_tol(mu_atan(-MU_INF), atan(-MU_INF), MU_EPS6);
+
+  run_random_tests(mu_atan, atan, -1e6, 1e6, MU_EPS10);
+  ck_assert_ldouble_eq_tol(mu_atan(1e300), atan(1e300), MU_EPS20);
+  ck_assert_ldouble_eq_tol(mu_atan(0.5), atan(0.5), MU_EPS20);
+  ck_assert_ldouble_eq_tol(mu_atan(1e-300), 1e-300, MU_EPS20);
+}
+END_TEST
+
+START_TEST(test_mu_atan2) {
+  run_const_tests_2args(mu_atan2, atan2, MU_EPS10);
+  run_random_tests_2args(mu_atan2, atan2, -100, 100, -100, 100, MU_EPS10);
+
+  double values[] = {0.0, -0.0, 1.0, -1.0, MU_INF, -MU_INF};
+  size_t count = sizeof(values) / sizeof(values[0]);
+  for (size_t i = 0; i < count; ++i) {
+    for (size_t j = 0; j < count; ++j) {
+      long double res = mu_atan2(values[i], values[j]);
+      ck_assert_ldouble_eq_tol(res, atan2(values[i], values[j]), MU_EPS20);
+      ck_assert_int_eq(!signbit(res), !signbit(atan2(values[i], values[j])));
+    }
+  }
+
+  ck_assert_ldouble_nan(mu_atan2(MU_NAN, 1.0));
+  ck_assert_ldouble_nan(mu_atan2(1.0, MU_NAN));
 }
 END_TEST
 
@@ -272,6 +673,26 @@ START_TEST(test_mu_sqrt) {
   ck_assert_ldouble_nan(mu_sqrt(MU_NAN));
   ck_assert_ldouble_nan(mu_sqrt(MU_INF));
   ck_assert_ldouble_nan(mu_sqrt(-MU_INF));
+
+  ck_assert_ldouble_eq_tol(mu_sqrt(1e300) / 1e150, 1.0, MU_EPS10);
+  ck_assert_ldouble_eq_tol(mu_sqrt(1e-300) / 1e-150, 1.0, MU_EPS10);
+  ck_assert_ldouble_eq_tol(mu_sqrt(0x1p-1073) / 0x1p-537, MU_SQRT2, MU_EPS10);
+  ck_assert_ldouble_eq(mu_sqrt(4.0), 2.0);
+}
+END_TEST
+
+START_TEST(test_mu_rsqrt) {
+  run_range_tests(mu_rsqrt, rsqrt, 0.01, 10000.0, 10, MU_EPS6);
+  run_const_tests(mu_rsqrt, rsqrt, MU_EPS6);
+  run_random_tests(mu_rsqrt, rsqrt, MU_EPS6, MU_E10, MU_EPS6);
+
+  ck_assert_ldouble_eq(mu_rsqrt(0.0), MU_INF);
+  ck_assert_ldouble_eq(mu_rsqrt(-0.0), -MU_INF);
+  ck_assert_ldouble_eq(mu_rsqrt(MU_INF), 0.0);
+  ck_assert_ldouble_nan(mu_rsqrt(-MU_EPS6));
+  ck_assert_ldouble_nan(mu_rsqrt(MU_NAN));
+  ck_assert_ldouble_nan(mu_rsqrt(-MU_INF));
+  ck_assert_ldouble_eq_tol(mu_rsqrt(1e-300) / 1e150, 1.0, MU_EPS10);
 }
 END_TEST
 
@@ -392,6 +813,34 @@ START_TEST(test_mu_pow) {
   ck_assert_ldouble_nan(mu_pow(MU_NAN, 10.0));
   ck_assert_ldouble_nan(mu_pow(MU_NAN, MU_INF));
   ck_assert_ldouble_nan(mu_pow(MU_NAN, MU_NAN));
+
+  ck_assert_ldouble_eq_tol(mu_pow(2.5, 700.5) / pow(2.5, 700.5), 1.0, MU_EPS10);
+  ck_assert_ldouble_eq_tol(mu_pow(0.3, 580.25) / pow(0.3, 580.25), 1.0,
+                           MU_EPS10);
+  ck_assert_ldouble_eq_tol(mu_pow(1.0000001, 1e9) / pow(1.0000001, 1e9), 1.0,
+                           MU_EPS10);
+  ck_assert_ldouble_eq(mu_pow(-0.0, -1.0), pow(-0.0, -1.0));
+  ck_assert_ldouble_eq(mu_pow(-0.0, -2.0), pow(-0.0, -2.0));
+  ck_assert_ldouble_eq(mu_pow(-2.0, 1025.0), pow(-2.0, 1025.0));
+  ck_assert_ldouble_eq(mu_pow(-2.0, -1075.0), pow(-2.0, -1075.0));
+}
+END_TEST
+
+START_TEST(test_mu_pow_plan) {
+  double values[] = {MU_NAN, MU_INF, -MU_INF, -10.0, -1.0, -0.0, 0.0,
+                     0.5,    1.0,    2.5,     -2.5,  MU_PI, 1e300};
+  size_t count = sizeof(values) / sizeof(values[0]);
+
+  for (size_t i = 0; i < count; ++i) {
+    mu_pow_plan base_plan = mu_pow_plan_base(values[i]);
+    mu_pow_plan exp_plan = mu_pow_plan_exp(values[i]);
+    for (size_t j = 0; j < count; ++j) {
+      check_batch_result(mu_pow_apply(&base_plan, values[j]),
+                         mu_pow(values[i], values[j]));
+      check_batch_result(mu_pow_apply(&exp_plan, values[j]),
+                         mu_pow(values[j], values[i]));
+    }
+  }
 }
 END_TEST
 
@@ -399,6 +848,12 @@ START_TEST(test_mu_exp) {
   run_range_tests(mu_exp, exp, -100.0, 20.0, 0.1, MU_EPS6);
   run_const_tests(mu_exp, exp, MU_EPS6);
   run_random_tests(mu_exp, exp, -50.0, 20, MU_EPS6);
+  run_range_tests(mu_exp, exp, -750.0, -700.0, 0.5, MU_EPS6);
+
+  ck_assert_ldouble_eq_tol(mu_exp(700.0) / exp(700.0), 1.0, MU_EPS10);
+  ck_assert_ldouble_eq_tol(mu_exp(709.0) / exp(709.0), 1.0, MU_EPS10);
+  ck_assert_ldouble_eq(mu_exp(710.0), exp(710.0));
+  ck_assert_ldouble_eq(mu_exp(-746.0), exp(-746.0));
 
   ck_assert_ldouble_nan(mu_exp(MU_NAN));
   ck_assert_ldouble_eq(mu_exp(MU_INF), exp(MU_INF));
@@ -416,12 +871,1334 @@ START_TEST(test_mu_log) {
   ck_assert_ldouble_nan(mu_log(-MU_INF));
   ck_assert_ldouble_eq(mu_log(0.0), log(0.0));
   ck_assert_ldouble_eq(mu_log(MU_INF), log(MU_INF));
+
+  run_range_tests(mu_log, log, 0.96, 1.04, 0.0001, MU_EPS10);
+  ck_assert_double_eq_tol(mu_log(1e-300), log(1e-300), MU_EPS10);
+  ck_assert_double_eq_tol(mu_log(1e300), log(1e300), MU_EPS10);
+  ck_assert_double_eq_tol(mu_log(5e-324), log(5e-324), MU_EPS10);
+  ck_assert_double_eq_tol(mu_log(0x1.fffffffffffffp-1),
+                          log(0x1.fffffffffffffp-1), MU_EPS20);
+  ck_assert_ldouble_eq(mu_log(1.0), 0.0);
+}
+END_TEST
+
+START_TEST(test_mu_hyperbolic) {
+  run_range_tests(mu_sinh, sinh, -20.0, 20.0, 0.01, MU_EPS6);
+  run_range_tests(mu_cosh, cosh, -20.0, 20.0, 0.01, MU_EPS6);
+  run_range_tests(mu_tanh, tanh, -20.0, 20.0, 0.01, MU_EPS6);
+  run_range_tests(mu_asinh, asinh, -100.0, 100.0, 0.1, MU_EPS6);
+  run_range_tests(mu_acosh, acosh, 1.0, 100.0, 0.1, MU_EPS6);
+  run_range_tests(mu_atanh, atanh, -0.999, 0.999, 0.001, MU_EPS6);
+  run_random_tests(mu_sinh, sinh, -1.0, 1.0, MU_EPS10);
+  run_random_tests(mu_tanh, tanh, -1.0, 1.0, MU_EPS10);
+
+  ck_assert_ldouble_eq_tol(mu_sinh(1e-5) / sinh(1e-5), 1.0, MU_EPS10);
+  ck_assert_ldouble_eq_tol(mu_tanh(-3e-4) / tanh(-3e-4), 1.0, MU_EPS10);
+  ck_assert_ldouble_eq_tol(mu_asinh(1e-3) / asinh(1e-3), 1.0, MU_EPS10);
+  ck_assert_ldouble_eq_tol(mu_acosh(1.0 + 1e-9) / acosh(1.0 + 1e-9), 1.0,
+                           MU_EPS10);
+  ck_assert_ldouble_eq_tol(mu_atanh(2e-3) / atanh(2e-3), 1.0, MU_EPS10);
+  ck_assert_ldouble_eq_tol(mu_sinh(710.0) / sinh(710.0), 1.0, MU_EPS10);
+  ck_assert_ldouble_eq_tol(mu_cosh(-710.4) / cosh(-710.4), 1.0, MU_EPS10);
+  ck_assert_ldouble_eq_tol(mu_asinh(1e300) / asinh(1e300), 1.0, MU_EPS10);
+  ck_assert_ldouble_eq_tol(mu_acosh(1e300) / acosh(1e300), 1.0, MU_EPS10);
+
+  ck_assert_ldouble_eq(mu_sinh(711.0), MU_INF);
+  ck_assert_ldouble_eq(mu_sinh(-711.0), -MU_INF);
+  ck_assert_ldouble_eq(mu_cosh(-711.0), MU_INF);
+  ck_assert_ldouble_eq(mu_tanh(-MU_INF), -1.0);
+  ck_assert_ldouble_eq(mu_cosh(0.0), 1.0);
+  ck_assert_ldouble_eq(mu_acosh(1.0), 0.0);
+  ck_assert_ldouble_eq(mu_atanh(1.0), MU_INF);
+  ck_assert_ldouble_eq(mu_atanh(-1.0), -MU_INF);
+  ck_assert_ldouble_eq(mu_asinh(-MU_INF), -MU_INF);
+  ck_assert_ldouble_eq(mu_acosh(MU_INF), MU_INF);
+  ck_assert(signbit(mu_sinh(-0.0)));
+  ck_assert(signbit(mu_tanh(-0.0)));
+  ck_assert(signbit(mu_asinh(-0.0)));
+  ck_assert(signbit(mu_atanh(-0.0)));
+
+  ck_assert_ldouble_nan(mu_sinh(MU_NAN));
+  ck_assert_ldouble_nan(mu_cosh(MU_NAN));
+  ck_assert_ldouble_nan(mu_tanh(MU_NAN));
+  ck_assert_ldouble_nan(mu_asinh(MU_NAN));
+  ck_assert_ldouble_nan(mu_acosh(0.5));
+  ck_assert_ldouble_nan(mu_acosh(-MU_INF));
+  ck_assert_ldouble_nan(mu_atanh(1.5));
+  ck_assert_ldouble_nan(mu_atanh(MU_NAN));
+
+  long double s, c;
+  mu_sinhcosh(-2.5, &s, &c);
+  ck_assert_ldouble_eq(s, mu_sinh(-2.5));
+  ck_assert_ldouble_eq(c, mu_cosh(-2.5));
+}
+END_TEST
+
+START_TEST(test_mu_exp_log_variants) {
+  run_range_tests(mu_exp2, exp2, -100.0, 28.0, 0.1, MU_EPS6);
+  run_range_tests(mu_exp10, exp10, -30.0, 8.0, 0.01, MU_EPS6);
+  run_range_tests(mu_expm1, expm1, -20.0, 20.0, 0.01, MU_EPS6);
+  run_range_tests(mu_log2, log2, 0.01, 1000.0, 0.1, MU_EPS6);
+  run_range_tests(mu_log10, log10, 0.01, 1000.0, 0.1, MU_EPS6);
+  run_range_tests(mu_log1p, log1p, -0.999, 100.0, 0.01, MU_EPS6);
+  run_random_tests(mu_expm1, expm1, -1.0, 1.0, MU_EPS10);
+  run_random_tests(mu_log1p, log1p, -0.5, 1.0, MU_EPS10);
+
+  ck_assert_ldouble_eq_tol(mu_expm1(1e-10) / expm1(1e-10), 1.0, MU_EPS10);
+  ck_assert_ldouble_eq_tol(mu_expm1(-3e-4) / expm1(-3e-4), 1.0, MU_EPS10);
+  ck_assert_ldouble_eq_tol(mu_log1p(1e-10) / log1p(1e-10), 1.0, MU_EPS10);
+  ck_assert_ldouble_eq_tol(mu_log1p(-2e-3) / log1p(-2e-3), 1.0, MU_EPS10);
+  ck_assert_ldouble_eq_tol(mu_log2(1.0 + 1e-9) / log2(1.0 + 1e-9), 1.0,
+                           MU_EPS10);
+  ck_assert_ldouble_eq_tol(mu_log10(1.0 - 1e-9) / log10(1.0 - 1e-9), 1.0,
+                           MU_EPS10);
+  ck_assert_ldouble_eq_tol(mu_exp10(-300.0) / exp10(-300.0), 1.0, MU_EPS10);
+
+  ck_assert_ldouble_eq(mu_exp2(3.0), 8.0);
+  ck_assert_ldouble_eq(mu_exp2(-1074.0), 0x1p-1074);
+  ck_assert_ldouble_eq(mu_exp2(1024.0), MU_INF);
+  ck_assert_ldouble_eq(mu_exp2(-1076.0), 0.0);
+  ck_assert_ldouble_eq(mu_exp10(2.0), 100.0);
+  ck_assert_ldouble_eq(mu_exp10(309.0), MU_INF);
+  ck_assert_ldouble_eq(mu_expm1(-800.0), -1.0);
+  ck_assert_ldouble_eq(mu_expm1(710.0), MU_INF);
+  ck_assert_ldouble_eq(mu_log2(0x1p-1074), -1074.0);
+  ck_assert_ldouble_eq(mu_log2(1024.0), 10.0);
+  ck_assert_ldouble_eq(mu_log10(1000.0), 3.0);
+  ck_assert_ldouble_eq(mu_log10(0.0), -MU_INF);
+  ck_assert_ldouble_eq(mu_log1p(-1.0), -MU_INF);
+  ck_assert_ldouble_eq(mu_log1p(MU_INF), MU_INF);
+  ck_assert(signbit(mu_expm1(-0.0)));
+  ck_assert(signbit(mu_log1p(-0.0)));
+
+  ck_assert_ldouble_nan(mu_exp2(MU_NAN));
+  ck_assert_ldouble_nan(mu_expm1(MU_NAN));
+  ck_assert_ldouble_nan(mu_log2(-1.0));
+  ck_assert_ldouble_nan(mu_log10(-MU_INF));
+  ck_assert_ldouble_nan(mu_log1p(-2.0));
+
+  ck_assert_int_eq(mu_ilogb(1.0), 0);
+  ck_assert_int_eq(mu_ilogb(-0x1.fp1023), 1023);
+  ck_assert_int_eq(mu_ilogb(0x1p-1074), -1074);
+  ck_assert_int_eq(mu_ilogb(0x1.8p-1030), -1030);
+  ck_assert_int_eq(mu_ilogb(0.0), MU_FP_ILOGB0);
+  ck_assert_int_eq(mu_ilogb(MU_NAN), MU_FP_ILOGBNAN);
+  ck_assert_int_eq(mu_ilogb(-MU_INF), INT_MAX);
+
+  ck_assert_ldouble_eq(mu_ldexp(0.75, 4), 12.0);
+  ck_assert_ldouble_eq(mu_ldexp(1.0, -1074), 0x1p-1074);
+  ck_assert_ldouble_eq(mu_ldexp(1.0, -1076), 0.0);
+  ck_assert_ldouble_eq(mu_ldexp(0x1p-1074, 2097), 0x1p1023);
+  ck_assert_ldouble_eq(mu_ldexp(-1.0, 1024), -MU_INF);
+  ck_assert_ldouble_eq(mu_ldexp(0x1.8p-1073, -1), 0x1p-1073);
+}
+END_TEST
+START_TEST(test_mu_stats) {
+  mu_stats stats;
+  mu_stats_reset();
+  mu_sin(1.0);
+  mu_sin_d(1e300);
+  mu_sin(NAN);
+  mu_asin(2.0);
+  mu_sqrt(-1.0);
+  mu_exp(1000.0);
+  mu_exp_d(-720.0);
+  mu_log(0.0);
+  mu_log_d(INFINITY);
+  mu_stats_snapshot(&stats);
+
+  if (!stats.enabled) {
+    ck_assert_int_eq(stats.func[MU_STATS_SIN].calls, 0);
+    return;
+  }
+
+  const mu_stats_counters *sin_c = &stats.func[MU_STATS_SIN];
+  ck_assert_int_eq(sin_c->calls, 3);
+  ck_assert_int_eq(sin_c->nan, 1);
+  ck_assert_int_eq(sin_c->slow, 1);
+  ck_assert_int_eq(sin_c->magnitude[8], 1);
+  ck_assert_int_eq(sin_c->magnitude[15], 1);
+  ck_assert_int_eq(stats.func[MU_STATS_ASIN].domain, 1);
+  ck_assert_int_eq(stats.func[MU_STATS_SQRT].domain, 1);
+  ck_assert_int_eq(stats.func[MU_STATS_EXP].range, 1);
+  ck_assert_int_eq(stats.func[MU_STATS_EXP].slow, 1);
+  ck_assert_int_eq(stats.func[MU_STATS_LOG].range, 1);
+  ck_assert_int_eq(stats.func[MU_STATS_LOG].inf, 1);
+  ck_assert_int_eq(stats.func[MU_STATS_COS].calls, 0);
+
+  mu_stats_reset();
+  mu_stats_snapshot(&stats);
+  ck_assert_int_eq(stats.func[MU_STATS_SIN].calls, 0);
+}
+END_TEST
+
+START_TEST(test_mu_abs_n) {
+  int in[BATCH_SIZE];
+  long int out[BATCH_SIZE];
+  for (int i = 0; i < BATCH_SIZE; ++i) {
+    in[i] = (i - BATCH_SIZE / 2) * 12345;
+  }
+  in[0] = INT_MIN + 1;
+
+  mu_abs_n(in, out, BATCH_SIZE);
+
+  for (int i = 0; i < BATCH_SIZE; ++i) {
+    ck_assert_int_eq(out[i], mu_abs(in[i]));
+  }
+}
+END_TEST
+
+START_TEST(test_mu_fabs_n) {
+  run_batch_tests(mu_fabs_n, fabs, -1000.0, 1000.0, MU_EPS6);
+  run_batch_special_tests(mu_fabs_n, mu_fabs);
+}
+END_TEST
+
+START_TEST(test_mu_trunc_n) {
+  run_batch_tests(mu_trunc_n, trunc, -1000.0, 1000.0, MU_EPS6);
+  run_batch_special_tests(mu_trunc_n, mu_trunc);
+}
+END_TEST
+
+START_TEST(test_mu_ceil_n) {
+  run_batch_tests(mu_ceil_n, ceil, -1000.0, 1000.0, MU_EPS6);
+  run_batch_special_tests(mu_ceil_n, mu_ceil);
+}
+END_TEST
+
+START_TEST(test_mu_floor_n) {
+  run_batch_tests(mu_floor_n, floor, -1000.0, 1000.0, MU_EPS6);
+  run_batch_special_tests(mu_floor_n, mu_floor);
+}
+END_TEST
+
+START_TEST(test_mu_round_n) {
+  run_batch_tests(mu_round_n, round, -1000.0, 1000.0, MU_EPS6);
+  run_batch_special_tests(mu_round_n, mu_round);
+}
+END_TEST
+
+START_TEST(test_mu_nearbyint_n) {
+  run_batch_tests(mu_nearbyint_n, nearbyint, -1000.0, 1000.0, MU_EPS6);
+  run_batch_special_tests(mu_nearbyint_n, mu_nearbyint);
+}
+END_TEST
+
+START_TEST(test_mu_modf_n) {
+  double in[BATCH_SIZE], frac[BATCH_SIZE], ipart[BATCH_SIZE];
+  long int out[BATCH_SIZE];
+  for (size_t i = 0; i < BATCH_SIZE; ++i) {
+    in[i] = -100.0 + 200.0 * (double)i / BATCH_SIZE;
+  }
+  in[0] = MU_INF;
+  in[1] = -0.0;
+  in[2] = 1e300;
+  in[3] = MU_NAN;
+
+  mu_modf_n(in, frac, ipart, BATCH_SIZE);
+  mu_lround_n(in, out, BATCH_SIZE);
+  for (size_t i = 0; i < BATCH_SIZE; ++i) {
+    double expected_ipart;
+    double expected = mu_modf_d(in[i], &expected_ipart);
+    ck_assert_mem_eq(&frac[i], &expected, sizeof(double));
+    ck_assert_mem_eq(&ipart[i], &expected_ipart, sizeof(double));
+    ck_assert_int_eq(out[i], mu_lround(in[i]));
+  }
+}
+END_TEST
+
+START_TEST(test_mu_fmod_n) { run_batch_tests_2args(mu_fmod_n, mu_fmod); }
+END_TEST
+
+START_TEST(test_mu_remainder_n) {
+  run_batch_tests_2args(mu_remainder_n, mu_remainder);
+
+  double x[] = {6.5, 7.0, -7.5, 1e300, 1e12, MU_INF, 5.0, -0.0, 0x1p-1060};
+  double y[] = {2.0, -2.0, 2.0, 3.0, -0.1, 1.0, MU_INF, 1.0, 0x1p-1070};
+  size_t n = sizeof(x) / sizeof(x[0]);
+  double out[sizeof(x) / sizeof(x[0])];
+  int quo[sizeof(x) / sizeof(x[0])];
+
+  mu_remquo_n(x, y, out, quo, n);
+
+  for (size_t i = 0; i < n; ++i) {
+    int expected;
+    check_batch_result(out[i], mu_remquo_d(x[i], y[i], &expected));
+    ck_assert_int_eq(quo[i], expected);
+  }
+}
+END_TEST
+
+START_TEST(test_mu_sin_n) {
+  run_batch_tests(mu_sin_n, sin, -1000.0, 1000.0, MU_EPS6);
+  run_batch_tests(mu_sin_n, sin, -1e300, 1e300, MU_EPS6);
+  run_batch_special_tests(mu_sin_n, mu_sin);
+}
+END_TEST
+
+START_TEST(test_mu_cos_n) {
+  run_batch_tests(mu_cos_n, cos, -1000.0, 1000.0, MU_EPS6);
+  run_batch_tests(mu_cos_n, cos, -1e300, 1e300, MU_EPS6);
+  run_batch_special_tests(mu_cos_n, mu_cos);
+}
+END_TEST
+
+START_TEST(test_mu_tan_n) {
+  run_batch_tests(mu_tan_n, tan, -1.0, 1.0, MU_EPS6);
+  run_batch_tests(mu_tan_n, tan, -1e300, 1e300, MU_EPS6);
+  run_batch_special_tests(mu_tan_n, mu_tan);
+}
+END_TEST
+
+START_TEST(test_mu_sincos_n) {
+  double in[BATCH_SIZE], s[BATCH_SIZE], c[BATCH_SIZE];
+  for (size_t i = 0; i < BATCH_SIZE; ++i) {
+    in[i] = -1000.0 + 2000.0 * (double)i / BATCH_SIZE;
+  }
+  in[0] = MU_NAN;
+  in[1] = MU_INF;
+  in[2] = -0.0;
+
+  mu_sincos_n(in, s, c, BATCH_SIZE);
+
+  ck_assert_ldouble_nan(s[0]);
+  ck_assert_ldouble_nan(c[1]);
+  ck_assert(signbit(s[2]));
+  for (size_t i = 2; i < BATCH_SIZE; ++i) {
+    ck_assert_ldouble_eq_tol(s[i], sin(in[i]), MU_EPS6);
+    ck_assert_ldouble_eq_tol(c[i], cos(in[i]), MU_EPS6);
+  }
+
+  /* Whole blocks of zeros, with no other special value among them. */
+  for (size_t i = 0; i < BATCH_SIZE; ++i) {
+    in[i] = -0.0;
+  }
+  mu_sincos_n(in, s, c, BATCH_SIZE);
+  for (size_t i = 0; i < BATCH_SIZE; ++i) {
+    ck_assert(signbit(s[i]));
+  }
+  mu_sin_n(in, s, BATCH_SIZE);
+  mu_tan_n(in, c, BATCH_SIZE);
+  for (size_t i = 0; i < BATCH_SIZE; ++i) {
+    ck_assert(signbit(s[i]) && signbit(c[i]));
+  }
+}
+END_TEST
+
+START_TEST(test_mu_sinpi_n) {
+  run_batch_tests(mu_sinpi_n, sinpi_ref, -10.0, 10.0, MU_EPS6);
+  run_batch_tests(mu_cospi_n, cospi_ref, -10.0, 10.0, MU_EPS6);
+  run_batch_tests(mu_tanpi_n, tanpi_ref, -0.45, 0.45, MU_EPS6);
+  run_batch_tests(mu_sind_n, sind_ref, -720.0, 720.0, MU_EPS6);
+  run_batch_tests(mu_cosd_n, cosd_ref, -720.0, 720.0, MU_EPS6);
+  run_batch_special_tests(mu_sinpi_n, mu_sinpi);
+  run_batch_special_tests(mu_cospi_n, mu_cospi);
+  run_batch_special_tests(mu_tanpi_n, mu_tanpi);
+  run_batch_special_tests(mu_sind_n, mu_sind);
+  run_batch_special_tests(mu_cosd_n, mu_cosd);
+
+  double in[BATCH_SIZE], s[BATCH_SIZE], c[BATCH_SIZE];
+  for (size_t i = 0; i < BATCH_SIZE; ++i) {
+    in[i] = -1e18 + 2e18 * (double)i / BATCH_SIZE;
+  }
+  in[0] = 0x1p60;
+  in[1] = -90.0;
+
+  mu_sincosd_n(in, s, c, BATCH_SIZE);
+  for (size_t i = 0; i < BATCH_SIZE; ++i) {
+    ck_assert_double_eq(s[i], mu_sind_d(in[i]));
+    ck_assert_double_eq(c[i], mu_cosd_d(in[i]));
+  }
+
+  mu_sincospi_n(in, s, c, BATCH_SIZE);
+  for (size_t i = 0; i < BATCH_SIZE; ++i) {
+    ck_assert_double_eq(s[i], mu_sinpi_d(in[i]));
+    ck_assert_double_eq(c[i], mu_cospi_d(in[i]));
+  }
+
+  /* Subnormal and tiny arguments, on every ISA. */
+  const char *isas[] = {"sse2", "avx2", "avx512"};
+  double t[BATCH_SIZE];
+  for (size_t i = 0; i < BATCH_SIZE; ++i) {
+    in[i] = ldexp(1.0 + (double)i / BATCH_SIZE, -1074 + (int)(i % 130));
+    in[i] = (i & 1) ? -in[i] : in[i];
+  }
+  for (size_t k = 0; k < sizeof(isas) / sizeof(isas[0]); ++k) {
+    if (mu_batch_set_isa(isas[k]) != 0) {
+      continue;
+    }
+    mu_sincosd_n(in, s, c, BATCH_SIZE);
+    mu_sinpi_n(in, t, BATCH_SIZE);
+    for (size_t i = 0; i < BATCH_SIZE; ++i) {
+      ck_assert_double_eq(s[i], mu_sind_d(in[i]));
+      ck_assert_double_eq(t[i], mu_sinpi_d(in[i]));
+    }
+    mu_tanpi_n(in, t, BATCH_SIZE);
+    for (size_t i = 0; i < BATCH_SIZE; ++i) {
+      ck_assert_double_eq(t[i], mu_tanpi_d(in[i]));
+    }
+  }
+  mu_batch_set_isa(NULL);
+
+  /* Within 0.8 ULP of x * π/180 in the subnormal range too. */
+  for (size_t i = 0; i < BATCH_SIZE; ++i) {
+    double x = fabs(in[i]);
+    long double ref = (long double)x * (3.14159265358979323846264338L / 180);
+    double res = mu_sind_d(x);
+    ck_assert(fabsl(res - ref) <= 0.8L * (nextafter(res, 1.0) - res));
+  }
+  ck_assert_double_eq(mu_sind_d(-0x1p-1074), -0.0);
+}
+END_TEST
+
+START_TEST(test_mu_asin_n) {
+  run_batch_tests(mu_asin_n, asin, -0.999, 0.999, MU_EPS6);
+  run_batch_tests(mu_asin_n, asin, 0.999, 1.0, MU_EPS10);
+  run_batch_special_tests(mu_asin_n, mu_asin);
+}
+END_TEST
+
+START_TEST(test_mu_acos_n) {
+  run_batch_tests(mu_acos_n, acos, -0.999, 0.999, MU_EPS6);
+  run_batch_special_tests(mu_acos_n, mu_acos);
+}
+END_TEST
+
+START_TEST(test_mu_atan_n) {
+  run_batch_tests(mu_atan_n, atan, -10.0, 10.0, MU_EPS6);
+  run_batch_special_tests(mu_atan_n, mu_atan);
+}
+END_TEST
+
+START_TEST(test_mu_atan2_n) { run_batch_tests_2args(mu_atan2_n, mu_atan2); }
+END_TEST
+
+START_TEST(test_mu_sqrt_n) {
+  run_batch_tests(mu_sqrt_n, sqrt, 0.0, 10000.0, MU_EPS6);
+  run_batch_special_tests(mu_sqrt_n, mu_sqrt);
+}
+END_TEST
+
+START_TEST(test_mu_rsqrt_n) {
+  run_batch_tests(mu_rsqrt_n, rsqrt, 0.01, 10000.0, MU_EPS6);
+  run_batch_special_tests(mu_rsqrt_n, mu_rsqrt);
+
+  /* Rescaled huge and tiny lanes must match the scalar form on every ISA. */
+  const char *isas[] = {"sse2", "avx2", "avx512"};
+  double in[] = {DBL_MAX, nextafter(DBL_MAX, 0.0), 0x1p1021, 0x1p1020,
+                 0x1p-1074, 0x1p-969, 1.0, 2.0};
+  double out[sizeof(in) / sizeof(in[0])];
+  for (size_t k = 0; k < sizeof(isas) / sizeof(isas[0]); ++k) {
+    if (mu_batch_set_isa(isas[k]) != 0) {
+      continue;
+    }
+    mu_rsqrt_n(in, out, sizeof(in) / sizeof(in[0]));
+    for (size_t i = 0; i < sizeof(in) / sizeof(in[0]); ++i) {
+      ck_assert_double_eq(out[i], mu_rsqrt_d(in[i]));
+    }
+  }
+  mu_batch_set_isa(NULL);
+}
+END_TEST
+
+START_TEST(test_mu_pow_n) { run_batch_tests_2args(mu_pow_n, mu_pow); }
+END_TEST
+
+START_TEST(test_mu_pow_apply_n) {
+  double in[BATCH_SIZE], out[BATCH_SIZE];
+  for (size_t i = 0; i < BATCH_SIZE; ++i) {
+    in[i] = -50.0 + 100.0 * (double)i / BATCH_SIZE;
+  }
+
+  mu_pow_plan base_plan = mu_pow_plan_base(-1.7);
+  mu_pow_apply_n(&base_plan, in, out, BATCH_SIZE);
+  for (size_t i = 0; i < BATCH_SIZE; ++i) {
+    check_batch_result(out[i], mu_pow(-1.7, in[i]));
+  }
+
+  mu_pow_plan exp_plan = mu_pow_plan_exp(3.0);
+  mu_pow_apply_n(&exp_plan, in, out, BATCH_SIZE);
+  for (size_t i = 0; i < BATCH_SIZE; ++i) {
+    check_batch_result(out[i], mu_pow(in[i], 3.0));
+  }
+}
+END_TEST
+
+START_TEST(test_mu_exp_n) {
+  run_batch_tests(mu_exp_n, exp, -100.0, 20.0, MU_EPS6);
+  run_batch_tests(mu_exp_n, exp, -750.0, -700.0, MU_EPS6);
+  run_batch_special_tests(mu_exp_n, mu_exp);
+}
+END_TEST
+
+START_TEST(test_mu_log_n) {
+  run_batch_tests(mu_log_n, log, 0.01, 1000.0, MU_EPS6);
+  run_batch_tests(mu_log_n, log, 0.96, 1.04, MU_EPS10);
+  run_batch_tests(mu_log_n, log, 1e-310, 1e-300, MU_EPS10);
+  run_batch_special_tests(mu_log_n, mu_log);
+}
+END_TEST
+
+START_TEST(test_mu_hyperbolic_n) {
+  run_batch_tests(mu_sinh_n, sinh, -20.0, 20.0, MU_EPS6);
+  run_batch_tests(mu_cosh_n, cosh, -20.0, 20.0, MU_EPS6);
+  run_batch_tests(mu_tanh_n, tanh, -20.0, 20.0, MU_EPS6);
+  run_batch_tests(mu_asinh_n, asinh, -100.0, 100.0, MU_EPS6);
+  run_batch_tests(mu_acosh_n, acosh, 1.0, 100.0, MU_EPS6);
+  run_batch_tests(mu_atanh_n, atanh, -0.999, 0.999, MU_EPS6);
+  run_batch_special_tests(mu_sinh_n, mu_sinh);
+  run_batch_special_tests(mu_cosh_n, mu_cosh);
+  run_batch_special_tests(mu_tanh_n, mu_tanh);
+  run_batch_special_tests(mu_asinh_n, mu_asinh);
+  run_batch_special_tests(mu_acosh_n, mu_acosh);
+  run_batch_special_tests(mu_atanh_n, mu_atanh);
+
+  /* Every branch of the scalar functions, which the lanes must match. */
+  double in[BATCH_SIZE], s[BATCH_SIZE], c[BATCH_SIZE];
+  for (size_t i = 0; i < BATCH_SIZE; ++i) {
+    double t = (double)i / BATCH_SIZE;
+    in[i] = (i & 1 ? -1.0 : 1.0) * pow(10.0, -12.0 + 15.0 * t);
+  }
+  in[0] = 710.4;
+  in[1] = 1e300;
+  in[2] = 1.0;
+  in[3] = -0.99999;
+
+  double (*scalar[])(double) = {mu_sinh_d,  mu_cosh_d,  mu_tanh_d,
+                                mu_asinh_d, mu_acosh_d, mu_atanh_d};
+  void (*batch[])(const double *, double *, size_t) = {
+      mu_sinh_n, mu_cosh_n, mu_tanh_n, mu_asinh_n, mu_acosh_n, mu_atanh_n};
+  for (size_t f = 0; f < 6; ++f) {
+    batch[f](in, s, BATCH_SIZE);
+    for (size_t i = 0; i < BATCH_SIZE; ++i) {
+      double expected = scalar[f](in[i]);
+      if (expected != expected) {
+        ck_assert_double_nan(s[i]);
+      } else {
+        ck_assert_mem_eq(&s[i], &expected, sizeof(double));
+      }
+    }
+  }
+
+  mu_sinhcosh_n(in, s, c, BATCH_SIZE);
+  for (size_t i = 0; i < BATCH_SIZE; ++i) {
+    double expected_s = mu_sinh_d(in[i]);
+    double expected_c = mu_cosh_d(in[i]);
+    ck_assert_mem_eq(&s[i], &expected_s, sizeof(double));
+    ck_assert_mem_eq(&c[i], &expected_c, sizeof(double));
+  }
+}
+END_TEST
+
+START_TEST(test_mu_exp_log_variants_n) {
+  run_batch_tests(mu_exp2_n, exp2, -100.0, 28.0, MU_EPS6);
+  run_batch_tests(mu_exp10_n, exp10, -30.0, 8.0, MU_EPS6);
+  run_batch_tests(mu_expm1_n, expm1, -20.0, 20.0, MU_EPS6);
+  run_batch_tests(mu_log2_n, log2, 1e-3, 1e3, MU_EPS6);
+  run_batch_tests(mu_log10_n, log10, 1e-3, 1e3, MU_EPS6);
+  run_batch_tests(mu_log1p_n, log1p, -0.999, 100.0, MU_EPS6);
+  run_batch_special_tests(mu_exp2_n, mu_exp2);
+  run_batch_special_tests(mu_exp10_n, mu_exp10);
+  run_batch_special_tests(mu_expm1_n, mu_expm1);
+  run_batch_special_tests(mu_log2_n, mu_log2);
+  run_batch_special_tests(mu_log10_n, mu_log10);
+  run_batch_special_tests(mu_log1p_n, mu_log1p);
+
+  /* Every branch of the scalar functions, which the lanes must match. */
+  double in[BATCH_SIZE], out[BATCH_SIZE];
+  for (size_t i = 0; i < BATCH_SIZE; ++i) {
+    double t = (double)i / BATCH_SIZE;
+    in[i] = (i & 1 ? -1.0 : 1.0) * pow(10.0, -20.0 + 23.0 * t);
+  }
+  in[0] = 1023.5;
+  in[1] = -1074.5;
+  in[2] = 1.0;
+  in[3] = -0.99999;
+  in[4] = 0x1p-1060;
+  in[5] = 1e300;
+
+  double (*scalar[])(double) = {mu_exp2_d, mu_exp10_d, mu_expm1_d,
+                                mu_log2_d, mu_log10_d, mu_log1p_d};
+  void (*batch[])(const double *, double *, size_t) = {
+      mu_exp2_n, mu_exp10_n, mu_expm1_n, mu_log2_n, mu_log10_n, mu_log1p_n};
+  for (size_t f = 0; f < 6; ++f) {
+    batch[f](in, out, BATCH_SIZE);
+    for (size_t i = 0; i < BATCH_SIZE; ++i) {
+      double expected = scalar[f](in[i]);
+      if (expected != expected) {
+        ck_assert_double_nan(out[i]);
+      } else {
+        ck_assert_mem_eq(&out[i], &expected, sizeof(double));
+      }
+    }
+  }
+
+  int e[BATCH_SIZE], logb[BATCH_SIZE];
+  for (size_t i = 0; i < BATCH_SIZE; ++i) {
+    e[i] = (int)(i % 4200) - 2100;
+  }
+  in[6] = MU_INF;
+  in[7] = MU_NAN;
+  in[8] = 0.0;
+  in[9] = -0x1p-1074;
+  mu_ilogb_n(in, logb, BATCH_SIZE);
+  mu_ldexp_n(in, e, out, BATCH_SIZE);
+  for (size_t i = 0; i < BATCH_SIZE; ++i) {
+    double expected = mu_ldexp_d(in[i], e[i]);
+    ck_assert_int_eq(logb[i], mu_ilogb(in[i]));
+    if (expected != expected) {
+      ck_assert_double_nan(out[i]);
+    } else {
+      ck_assert_mem_eq(&out[i], &expected, sizeof(double));
+    }
+  }
+}
+END_TEST
+START_TEST(test_mu_progression) {
+  size_t sizes[] = {0, 1, 3, 1001, 5000};
+  double *s = malloc(5000 * sizeof(double));
+  double *c = malloc(5000 * sizeof(double));
+
+  for (size_t t = 0; t < sizeof(sizes) / sizeof(sizes[0]); ++t) {
+    size_t n = sizes[t];
+    mu_sincos_progression(0.5, 0.1, s, c, n);
+    for (size_t k = 0; k < n; ++k) {
+      long double x = 0.5L + (long double)k * 0.1;
+      ck_assert_ldouble_eq_tol(s[k], sinl(x), 1e-15);
+      ck_assert_ldouble_eq_tol(c[k], cosl(x), 1e-15);
+    }
+    mu_exp_progression(-20.0, 0.01, s, n);
+    for (size_t k = 0; k < n; ++k) {
+      long double e = expl(-20.0L + (long double)k * 0.01);
+      ck_assert_ldouble_eq_tol(s[k] / e, 1.0L, 4 * DBL_EPSILON);
+    }
+  }
+
+  /* Rows without a table keep the exact argument too, on every ISA. */
+  for (size_t n = 1; n <= 40; ++n) {
+    mu_sincos_progression(-700.0, 0.1, s, c, n);
+    for (size_t k = 0; k < n; ++k) {
+      long double x = -700.0L + (long double)k * 0.1;
+      ck_assert_ldouble_eq_tol(s[k], sinl(x), 1e-15);
+      ck_assert_ldouble_eq_tol(c[k], cosl(x), 1e-15);
+    }
+  }
+
+  /* Blocks that leave the finite or normal range are evaluated directly. */
+  mu_exp_progression(-800.0, 1.0, s, 1001);
+  for (size_t k = 0; k < 1001; ++k) {
+    check_batch_result(s[k], expl(-800.0L + (long double)k));
+  }
+  mu_sincos_progression(1.0, 1e307, s, c, 100);
+  ck_assert_ldouble_eq_tol(s[0], sin(1.0), MU_EPS6);
+  ck_assert_ldouble_nan(s[99]);
+  mu_sincos_progression(MU_NAN, 0.1, s, c, 1001);
+  ck_assert_ldouble_nan(s[500]);
+  ck_assert_ldouble_nan(c[1000]);
+  free(s);
+  free(c);
+}
+END_TEST
+
+START_TEST(test_mu_batch_blocks) {
+  size_t n = 1001;
+  double *in = malloc(n * sizeof(double));
+  double *out = malloc(n * sizeof(double));
+  double *c = malloc(n * sizeof(double));
+  double special[] = {MU_NAN, MU_INF, -MU_INF, 1e300, 0.0, -1.0, 4e-320};
+  for (size_t i = 0; i < n; ++i) {
+    in[i] = 0.5 + 0.37 * (double)i;
+  }
+  /* Whole clean blocks, then blocks with one special lane each. */
+  for (size_t k = 0; k < sizeof(special) / sizeof(special[0]); ++k) {
+    in[300 + 97 * k] = special[k];
+  }
+
+  void (*funcs[])(const double *, double *, size_t) = {
+      mu_sin_n, mu_cos_n, mu_tan_n, mu_exp_n, mu_log_n};
+  for (size_t f = 0; f < sizeof(funcs) / sizeof(funcs[0]); ++f) {
+    funcs[f](in, out, n);
+    for (size_t i = 0; i < n; ++i) {
+      double expected;
+      funcs[f](&in[i], &expected, 1);
+      ck_assert_int_eq(memcmp(&out[i], &expected, sizeof(double)), 0);
+    }
+  }
+
+  mu_sincos_n(in, out, c, n);
+  for (size_t i = 0; i < n; ++i) {
+    double s1, c1;
+    mu_sincos_n(&in[i], &s1, &c1, 1);
+    ck_assert_int_eq(memcmp(&out[i], &s1, sizeof(double)), 0);
+    ck_assert_int_eq(memcmp(&c[i], &c1, sizeof(double)), 0);
+  }
+
+  free(in);
+  free(out);
+  free(c);
+}
+END_TEST
+
+START_TEST(test_mu_batch_isa) {
+  const char *isas[] = {"sse2", "avx2", "avx512", "native"};
+  static double sin_out[2][BATCH_SIZE], pow_out[2][BATCH_SIZE];
+  static float exp_out[2][BATCH_SIZE];
+  double in[BATCH_SIZE], y[BATCH_SIZE];
+  float inf[BATCH_SIZE];
+  for (size_t i = 0; i < BATCH_SIZE; ++i) {
+    in[i] = -50.0 + 100.0 * (double)i / BATCH_SIZE;
+    y[i] = 0.5 + (double)i / 100.0;
+    inf[i] = (float)in[i];
+  }
+
+  /* Every variant must produce the same bits as the first supported one. */
+  int found = 0;
+  for (size_t k = 0; k < sizeof(isas) / sizeof(isas[0]); ++k) {
+    if (mu_batch_set_isa(isas[k]) != 0) {
+      continue;
+    }
+    ck_assert_str_eq(mu_batch_isa(), isas[k]);
+
+    mu_sin_n(in, sin_out[found], BATCH_SIZE);
+    mu_pow_n(y, in, pow_out[found], BATCH_SIZE);
+    mu_expf_n(inf, exp_out[found], BATCH_SIZE);
+    if (found) {
+      ck_assert_int_eq(memcmp(sin_out[0], sin_out[1], sizeof(sin_out[0])), 0);
+      ck_assert_int_eq(memcmp(pow_out[0], pow_out[1], sizeof(pow_out[0])), 0);
+      ck_assert_int_eq(memcmp(exp_out[0], exp_out[1], sizeof(exp_out[0])), 0);
+    }
+    found = 1;
+  }
+
+  ck_assert_int_eq(found, 1);
+  ck_assert_int_eq(mu_batch_set_isa("mmx"), -1);
+  ck_assert_int_eq(mu_batch_set_isa(NULL), 0);
+}
+END_TEST
+
+START_TEST(test_mu_parallel_apply) {
+  size_t n = 100003;
+  double *in = malloc(n * sizeof(double));
+  double *serial = malloc(n * sizeof(double));
+  double *out = malloc(n * sizeof(double));
+  for (size_t i = 0; i < n; ++i) {
+    in[i] = -1000.0 + 2000.0 * (double)i / (double)n;
+  }
+
+  int threads[] = {1, 2, 3, 8, 0};
+  mu_fn_id fns[] = {MU_FN_SIN, MU_FN_EXP, MU_FN_LOG_FAST};
+  for (size_t f = 0; f < sizeof(fns) / sizeof(fns[0]); ++f) {
+    for (size_t t = 0; t < sizeof(threads) / sizeof(threads[0]); ++t) {
+      ck_assert_int_eq(mu_parallel_apply(fns[f], in, out, n, threads[t]), 0);
+      ck_assert_int_eq(mu_parallel_apply(fns[f], in, serial, n, 1), 0);
+      ck_assert_int_eq(memcmp(out, serial, n * sizeof(double)), 0);
+    }
+  }
+
+  mu_sin_n(in, serial, n);
+  mu_parallel_shutdown();
+  memcpy(out, in, n * sizeof(double));
+  ck_assert_int_eq(mu_parallel_apply(MU_FN_SIN, out, out, n, 4), 0);
+  ck_assert_int_eq(memcmp(out, serial, n * sizeof(double)), 0);
+  ck_assert_int_eq(mu_parallel_apply(MU_FN_COUNT, in, out, n, 4), -1);
+  mu_parallel_shutdown();
+
+  free(in);
+  free(serial);
+  free(out);
+}
+END_TEST
+
+START_TEST(test_mu_apply_strided) {
+  typedef struct {
+    double angle;
+    double mag;
+    double result;
+  } item;
+  size_t n = 1003;
+  item *p = malloc(n * sizeof(item));
+  double *angle = malloc(n * sizeof(double));
+  double *mag = malloc(n * sizeof(double));
+  double *expect = malloc(n * sizeof(double));
+  double *out = malloc(n * sizeof(double));
+  for (size_t i = 0; i < n; ++i) {
+    p[i].angle = angle[i] = -50.0 + 0.1 * (double)i;
+    p[i].mag = mag[i] = 0.25 + 0.01 * (double)i;
+  }
+  ptrdiff_t stride = sizeof(item) / sizeof(double);
+
+  mu_sin_n(angle, expect, n);
+  ck_assert_int_eq(
+      mu_apply_strided(MU_FN_SIN, &p[0].angle, stride, &p[0].result, stride, n),
+      0);
+  for (size_t i = 0; i < n; ++i) {
+    ck_assert(p[i].result == expect[i]);
+  }
+  ck_assert_int_eq(
+      mu_apply_strided(MU_FN_SIN, &p[0].angle, stride, out, 1, n), 0);
+  ck_assert_int_eq(memcmp(out, expect, n * sizeof(double)), 0);
+  ck_assert_int_eq(
+      mu_apply_strided(MU_FN_SIN, &p[n - 1].angle, -stride, &out[n - 1], -1,
+                       n),
+      0);
+  ck_assert_int_eq(memcmp(out, expect, n * sizeof(double)), 0);
+
+  mu_atan2_n(angle, mag, expect, n);
+  ck_assert_int_eq(mu_apply2_strided(MU_FN2_ATAN2, &p[0].angle, stride,
+                                     &p[0].mag, stride, &p[0].mag, stride, n),
+                   0);
+  for (size_t i = 0; i < n; ++i) {
+    ck_assert(p[i].mag == expect[i]);
+  }
+
+  double e = 1.5;
+  for (size_t i = 0; i < n; ++i) {
+    out[i] = e;
+  }
+  mu_pow_n(mag, out, expect, n);
+  ck_assert_int_eq(
+      mu_apply2_strided(MU_FN2_POW, mag, 1, &e, 0, &p[0].result, stride, n),
+      0);
+  for (size_t i = 0; i < n; ++i) {
+    ck_assert(p[i].result == expect[i]);
+  }
+
+  ck_assert_int_eq(mu_apply_strided(MU_FN_COUNT, angle, 2, out, 1, 10), -1);
+  ck_assert_int_eq(
+      mu_apply2_strided(MU_FN2_COUNT, angle, 1, mag, 1, out, 1, 10), -1);
+
+  free(p);
+  free(angle);
+  free(mag);
+  free(expect);
+  free(out);
+}
+END_TEST
+
+START_TEST(test_mu_rounding_d) {
+  run_double_tests(mu_fabs_d, fabs, -1000.0, 1000.0);
+  run_double_tests(mu_trunc_d, trunc, -1000.0, 1000.0);
+  run_double_tests(mu_ceil_d, ceil, -1000.0, 1000.0);
+  run_double_tests(mu_floor_d, floor, -1000.0, 1000.0);
+  run_double_tests(mu_round_d, round, -1000.0, 1000.0);
+  run_double_tests(mu_nearbyint_d, nearbyint, -1000.0, 1000.0);
+  run_double_special_tests(mu_trunc_d, mu_trunc);
+  run_double_special_tests(mu_floor_d, mu_floor);
+  run_double_special_tests(mu_round_d, mu_round);
+
+  ck_assert(signbit(mu_trunc_d(-0.5)));
+  ck_assert(signbit(mu_ceil_d(-0.5)));
+  ck_assert_double_eq(mu_round_d(-2.5), -3.0);
+  ck_assert_double_eq(mu_nearbyint_d(-2.5), -2.0);
+  ck_assert_double_eq(mu_trunc_d(0x1p52 + 1.0), 0x1p52 + 1.0);
+  ck_assert_double_eq(mu_fmod_d(7.5, 2.0), fmod(7.5, 2.0));
+  ck_assert_double_eq(mu_fmod_d(-7.5, 2.0), fmod(-7.5, 2.0));
+  ck_assert_double_nan(mu_fmod_d(MU_INF, 2.0));
+  ck_assert_double_eq(mu_fmod_d(0x1p1000, 3.0), fmod(0x1p1000, 3.0));
+  ck_assert_double_eq(mu_remainder_d(7.5, 2.0), remainder(7.5, 2.0));
+  ck_assert_double_eq(mu_remainder_d(-1e20, 7.0), remainder(-1e20, 7.0));
+}
+END_TEST
+
+START_TEST(test_mu_trig_d) {
+  run_double_tests(mu_sin_d, sin, -1000.0, 1000.0);
+  run_double_tests(mu_cos_d, cos, -1000.0, 1000.0);
+  run_double_tests(mu_tan_d, tan, -1.5, 1.5);
+  run_double_tests(mu_sin_d, sin, -1e300, 1e300);
+  run_double_special_tests(mu_sin_d, mu_sin);
+  run_double_special_tests(mu_cos_d, mu_cos);
+  run_double_special_tests(mu_tan_d, mu_tan);
+
+  double s, c;
+  mu_sincos_d(MU_PI / 3, &s, &c);
+  ck_assert_double_eq(s, mu_sin_d(MU_PI / 3));
+  ck_assert_double_eq(c, mu_cos_d(MU_PI / 3));
+  mu_sincos_d(-0.0, &s, &c);
+  ck_assert(signbit(s));
+  ck_assert(signbit(mu_sin_d(-0.0)));
+  ck_assert(signbit(mu_tan_d(-0.0)));
+  ck_assert(!signbit(mu_sin_d(0.0)));
+
+  run_double_special_tests(mu_sinpi_d, mu_sinpi);
+  run_double_special_tests(mu_cospi_d, mu_cospi);
+  run_double_special_tests(mu_tanpi_d, mu_tanpi);
+  run_double_special_tests(mu_sind_d, mu_sind);
+  run_double_special_tests(mu_cosd_d, mu_cosd);
+  ck_assert_double_eq(mu_sinpi_d(1.0 / 6.0), 0.5);
+  mu_sincosd_d(45.0, &s, &c);
+  ck_assert_double_eq(s, c);
+}
+END_TEST
+
+START_TEST(test_mu_inverse_trig_d) {
+  run_double_tests(mu_asin_d, asin, -1.0, 1.0);
+  run_double_tests(mu_acos_d, acos, -1.0, 1.0);
+  run_double_tests(mu_atan_d, atan, -100.0, 100.0);
+  run_double_special_tests(mu_asin_d, mu_asin);
+  run_double_special_tests(mu_acos_d, mu_acos);
+  run_double_special_tests(mu_atan_d, mu_atan);
+
+  ck_assert_double_eq_tol(mu_atan2_d(1.0, -1.0), atan2(1.0, -1.0), MU_EPS10);
+  ck_assert(signbit(mu_atan2_d(-0.0, 1.0)));
+}
+END_TEST
+
+START_TEST(test_mu_sqrt_d) {
+  run_double_tests(mu_sqrt_d, sqrt, 0.0, 10000.0);
+  run_double_tests(mu_rsqrt_d, rsqrt, 0.01, 10000.0);
+  run_double_special_tests(mu_sqrt_d, mu_sqrt);
+  run_double_special_tests(mu_rsqrt_d, mu_rsqrt);
+
+  ck_assert_double_eq(mu_rsqrt_d(0x1p-1074), 0x1p537);
+  ck_assert_double_eq(mu_rsqrt_d(0x1p-1022), 0x1p511);
+  ck_assert_double_eq(mu_rsqrt_d(DBL_MAX), 0x1p-512);
+  ck_assert_double_eq(mu_rsqrt_d(nextafter(DBL_MAX, 0.0)),
+                      0x1.0000000000001p-512);
+
+  /* Only sqrt and rsqrt keep an extended-precision step. */
+  if (LDBL_MANT_DIG > DBL_MANT_DIG) {
+    ck_assert_ldouble_eq_tol(mu_sqrt(2.0), sqrtl(2.0L), 4 * LDBL_EPSILON);
+    ck_assert(mu_sqrt(2.0) != mu_sqrt_d(2.0));
+  }
+}
+END_TEST
+
+START_TEST(test_mu_exp_log_d) {
+  run_double_tests(mu_exp_d, exp, -700.0, 700.0);
+  run_double_tests(mu_log_d, log, 1e-300, 1e300);
+  run_double_tests(mu_log_d, log, 0.96, 1.04);
+  run_double_special_tests(mu_exp_d, mu_exp);
+  run_double_special_tests(mu_log_d, mu_log);
+
+  /* The long double forms widen the double result. */
+  ck_assert_ldouble_eq(mu_exp(1.0), mu_exp_d(1.0));
+  ck_assert_ldouble_eq(mu_log(MU_PI), mu_log_d(MU_PI));
+
+  ck_assert_double_eq_tol(mu_pow_d(MU_PI, 2.5), pow(MU_PI, 2.5), MU_EPS10);
+  ck_assert_double_eq(mu_pow_d(-2.0, 3.0), -8.0);
+
+  mu_pow_plan plan = mu_pow_plan_base(2.0);
+  ck_assert_double_eq(mu_pow_apply_d(&plan, 10.0), 1024.0);
+
+  /* x^-1 is the exact reciprocal, subnormal results included. */
+  double in[BATCH_SIZE], y[BATCH_SIZE], out[BATCH_SIZE];
+  for (size_t i = 0; i < BATCH_SIZE; ++i) {
+    in[i] = ldexp(1.0 + (double)i / BATCH_SIZE, 1020 + (int)(i % 4));
+    in[i] = (i & 1) ? -in[i] : in[i];
+    y[i] = -1.0;
+  }
+  in[0] = DBL_MAX;
+  mu_pow_plan recip = mu_pow_plan_exp(-1.0);
+  mu_pow_n(in, y, out, BATCH_SIZE);
+  for (size_t i = 0; i < BATCH_SIZE; ++i) {
+    ck_assert_double_eq(mu_pow_d(in[i], -1.0), 1.0 / in[i]);
+    ck_assert_double_eq(mu_pow_apply_d(&recip, in[i]), 1.0 / in[i]);
+    ck_assert_double_eq(out[i], 1.0 / in[i]);
+    plan = mu_pow_plan_base(in[i]);
+    ck_assert_double_eq(mu_pow_apply_d(&plan, -1.0), 1.0 / in[i]);
+  }
+  mu_pow_apply_n(&recip, in, out, BATCH_SIZE);
+  for (size_t i = 0; i < BATCH_SIZE; ++i) {
+    ck_assert_double_eq(out[i], 1.0 / in[i]);
+  }
+  plan = mu_pow_plan_base(DBL_MAX);
+  mu_pow_apply_n(&plan, y, out, BATCH_SIZE);
+  ck_assert_double_eq(out[0], 1.0 / DBL_MAX);
+}
+END_TEST
+
+START_TEST(test_mu_hyperbolic_d) {
+  run_double_tests(mu_sinh_d, sinh, -700.0, 700.0);
+  run_double_tests(mu_sinh_d, sinh, -1.5, 1.5);
+  run_double_tests(mu_cosh_d, cosh, -700.0, 700.0);
+  run_double_tests(mu_cosh_d, cosh, -1.5, 1.5);
+  run_double_tests(mu_tanh_d, tanh, -25.0, 25.0);
+  run_double_tests(mu_asinh_d, asinh, -1e6, 1e6);
+  run_double_tests(mu_asinh_d, asinh, -3.0, 3.0);
+  run_double_tests(mu_acosh_d, acosh, 1.0, 1e6);
+  run_double_tests(mu_acosh_d, acosh, 1.0, 3.0);
+  run_double_tests(mu_atanh_d, atanh, -0.9999, 0.9999);
+  run_double_special_tests(mu_sinh_d, mu_sinh);
+  run_double_special_tests(mu_cosh_d, mu_cosh);
+  run_double_special_tests(mu_tanh_d, mu_tanh);
+  run_double_special_tests(mu_asinh_d, mu_asinh);
+  run_double_special_tests(mu_acosh_d, mu_acosh);
+  run_double_special_tests(mu_atanh_d, mu_atanh);
+
+  double s, c;
+  mu_sinhcosh_d(0.3, &s, &c);
+  ck_assert_double_eq(s, mu_sinh_d(0.3));
+  ck_assert_double_eq(c, mu_cosh_d(0.3));
+}
+END_TEST
+
+START_TEST(test_mu_exp_log_variants_d) {
+  run_double_tests(mu_exp2_d, exp2, -1000.0, 1000.0);
+  run_double_tests(mu_exp2_d, exp2, -1.5, 1.5);
+  run_double_tests(mu_exp10_d, exp10, -300.0, 300.0);
+  run_double_tests(mu_exp10_d, exp10, -1.5, 1.5);
+  run_double_tests(mu_expm1_d, expm1, -700.0, 700.0);
+  run_double_tests(mu_expm1_d, expm1, -1.5, 1.5);
+  run_double_tests(mu_log2_d, log2, 1e-300, 1e300);
+  run_double_tests(mu_log2_d, log2, 0.5, 2.0);
+  run_double_tests(mu_log10_d, log10, 1e-300, 1e300);
+  run_double_tests(mu_log10_d, log10, 0.5, 2.0);
+  run_double_tests(mu_log1p_d, log1p, -0.9999, 1e6);
+  run_double_tests(mu_log1p_d, log1p, -0.5, 0.5);
+  run_double_special_tests(mu_exp2_d, mu_exp2);
+  run_double_special_tests(mu_exp10_d, mu_exp10);
+  run_double_special_tests(mu_expm1_d, mu_expm1);
+  run_double_special_tests(mu_log2_d, mu_log2);
+  run_double_special_tests(mu_log10_d, mu_log10);
+  run_double_special_tests(mu_log1p_d, mu_log1p);
+
+  for (int k = -1074; k <= 1023; ++k) {
+    ck_assert_double_eq(mu_exp2_d(k), ldexp(1.0, k));
+    ck_assert_double_eq(mu_log2_d(ldexp(1.0, k)), k);
+  }
+  double p = 1.0;
+  for (int k = 0; k <= 22; ++k, p *= 10.0) {
+    ck_assert_double_eq(mu_exp10_d(k), p);
+    ck_assert_double_eq(mu_log10_d(p), k);
+  }
+
+  /* ldexp rounds once, at the end, like the C library. */
+  double x[] = {0x1.fffffffffffffp0, 0x1.0000000000001p0, 3.0, -0x1.8p-3,
+                MU_INF,              MU_NAN,              -0.0, 0x1p-1074};
+  int e[] = {-1074, -1023, -1075, 2000, -5, 3, 10, 2097};
+  for (size_t i = 0; i < sizeof(x) / sizeof(x[0]); ++i) {
+    for (size_t j = 0; j < sizeof(e) / sizeof(e[0]); ++j) {
+      double expected = ldexp(x[i], e[j]);
+      double result = mu_ldexp_d(x[i], e[j]);
+      if (expected != expected) {
+        ck_assert_double_nan(result);
+      } else {
+        ck_assert_mem_eq(&result, &expected, sizeof(double));
+      }
+    }
+  }
+}
+END_TEST
+START_TEST(test_mu_unchecked_d) {
+  for (size_t i = 0; i < BATCH_SIZE; ++i) {
+    double t = (double)i / BATCH_SIZE;
+    double x = -1000.0 + 2000.0 * t;
+    double s, c;
+    mu_sincos_unchecked(x, &s, &c);
+    ck_assert_double_eq(mu_sin_unchecked(x), mu_sin_d(x));
+    ck_assert_double_eq(mu_cos_unchecked(x), mu_cos_d(x));
+    ck_assert_double_eq(mu_tan_unchecked(x), mu_tan_d(x));
+    ck_assert_double_eq(s, mu_sin_d(x));
+    ck_assert_double_eq(c, mu_cos_d(x));
+    ck_assert_double_eq(mu_asin_unchecked(x / 1000.0), mu_asin_d(x / 1000.0));
+    ck_assert_double_eq(mu_acos_unchecked(x / 1000.0), mu_acos_d(x / 1000.0));
+    ck_assert_double_eq(mu_sqrt_unchecked(1000.0 * t), mu_sqrt_d(1000.0 * t));
+    ck_assert_double_eq(mu_exp_unchecked(0.7 * x), mu_exp_d(0.7 * x));
+    ck_assert_double_eq(mu_log_unchecked(x + 1000.5), mu_log_d(x + 1000.5));
+  }
+
+  ck_assert_double_eq(mu_sin_unchecked(1e300), mu_sin_d(1e300));
+  ck_assert_double_eq(mu_exp_unchecked(-745.0), mu_exp_d(-745.0));
+  ck_assert_double_eq(mu_log_unchecked(4e-320), mu_log_d(4e-320));
+  ck_assert_double_eq(mu_acos_unchecked(1.0), 0.0);
+}
+END_TEST
+
+START_TEST(test_mu_rounding_f) {
+  run_float_tests(mu_fabsf, fabsf, -1000.0f, 1000.0f, 0.5f);
+  run_float_tests(mu_truncf, truncf, -1000.0f, 1000.0f, 0.5f);
+  run_float_tests(mu_ceilf, ceilf, -1000.0f, 1000.0f, 0.5f);
+  run_float_tests(mu_floorf, floorf, -1000.0f, 1000.0f, 0.5f);
+
+  run_float_tests(mu_roundf, roundf, -1000.0f, 1000.0f, 0.5f);
+  run_float_tests(mu_nearbyintf, nearbyintf, -1000.0f, 1000.0f, 0.5f);
+
+  ck_assert(signbit(mu_truncf(-0.5f)));
+  ck_assert_float_eq(mu_roundf(0.49999997f), 0.0f);
+  ck_assert_float_eq(mu_nearbyintf(2.5f), 2.0f);
+  float ipart;
+  ck_assert_float_eq(mu_modff(-3.25f, &ipart), -0.25f);
+  ck_assert_float_eq(ipart, -3.0f);
+  ck_assert_float_eq(mu_truncf(0x1p30f), 0x1p30f);
+  ck_assert_float_eq(mu_fmodf(7.5f, 2.0f), fmodf(7.5f, 2.0f));
+  ck_assert_float_eq(mu_fmodf(-1e7f, 3.0f), fmodf(-1e7f, 3.0f));
+  ck_assert_float_nan(mu_fmodf(MU_INF, 2.0f));
+  ck_assert_float_eq(mu_remainderf(7.5f, 2.0f), remainderf(7.5f, 2.0f));
+  ck_assert_float_eq(mu_remainderf(-1e7f, 3.0f), remainderf(-1e7f, 3.0f));
+  int quo;
+  ck_assert_float_eq(mu_remquof(-6.5f, 2.0f, &quo), -0.5f);
+  ck_assert_int_eq(quo, -3);
+}
+END_TEST
+
+START_TEST(test_mu_trig_f) {
+  run_float_tests(mu_sinf, sinf, -1000.0f, 1000.0f, 2.0f);
+  run_float_tests(mu_cosf, cosf, -1000.0f, 1000.0f, 2.0f);
+  run_float_tests(mu_tanf, tanf, -1.5f, 1.5f, 3.0f);
+  run_float_tests(mu_sinf, sinf, -1e30f, 1e30f, 2.0f);
+
+  ck_assert_float_nan(mu_sinf(MU_INF));
+  ck_assert_float_nan(mu_cosf(MU_NAN));
+  ck_assert_float_nan(mu_tanf(-MU_INF));
+  ck_assert(signbit(mu_sinf(-0.0f)));
+
+  float s, c;
+  mu_sincosf(2.5f, &s, &c);
+  ck_assert_float_eq(s, mu_sinf(2.5f));
+  ck_assert_float_eq(c, mu_cosf(2.5f));
+
+  ck_assert_float_eq(mu_sinpif(0.5f), 1.0f);
+  ck_assert_float_eq(mu_cospif(0x1p23f + 1.0f), -1.0f);
+  ck_assert_float_eq(mu_tanpif(-0.25f), -1.0f);
+  ck_assert_float_eq(mu_sindf(-30.0f), -0.5f);
+  ck_assert_float_eq(mu_cosdf(1e30f), (float)mu_cosd_d(1e30f));
+  ck_assert_float_nan(mu_sinpif(MU_INF));
+  mu_sincospif(0.1f, &s, &c);
+  ck_assert_float_eq(s, mu_sinpif(0.1f));
+  ck_assert_float_eq(c, mu_cospif(0.1f));
+  mu_sincosdf(100.0f, &s, &c);
+  ck_assert_float_eq(s, mu_sindf(100.0f));
+  ck_assert_float_eq(c, mu_cosdf(100.0f));
+}
+END_TEST
+
+START_TEST(test_mu_inverse_trig_f) {
+  run_float_tests(mu_asinf, asinf, -1.0f, 1.0f, 2.0f);
+  run_float_tests(mu_acosf, acosf, -1.0f, 1.0f, 2.0f);
+  run_float_tests(mu_atanf, atanf, -100.0f, 100.0f, 2.0f);
+
+  ck_assert_float_nan(mu_asinf(1.5f));
+  ck_assert_float_nan(mu_acosf(MU_NAN));
+  ck_assert_float_eq_tol(mu_atanf(MU_INF), atanf(MU_INF), FLT_EPSILON);
+  ck_assert_float_eq_tol(mu_atan2f(1.0f, -1.0f), atan2f(1.0f, -1.0f),
+                         2 * FLT_EPSILON);
+  ck_assert_float_eq_tol(mu_atan2f(-3.0f, -0.0f), atan2f(-3.0f, -0.0f),
+                         2 * FLT_EPSILON);
+  ck_assert(signbit(mu_atan2f(-0.0f, 1.0f)));
+}
+END_TEST
+
+START_TEST(test_mu_sqrt_f) {
+  run_float_tests(mu_sqrtf, sqrtf, 0.0f, 10000.0f, 0.5f);
+  run_float_tests(mu_rsqrtf, rsqrtf, 0.01f, 10000.0f, 2.0f);
+
+  ck_assert_float_nan(mu_sqrtf(-1.0f));
+  ck_assert(signbit(mu_sqrtf(-0.0f)));
+  ck_assert_float_eq(mu_sqrtf(0x1p-148f), 0x1p-74f);
+  ck_assert_float_eq(mu_rsqrtf(0.0f), MU_INF);
+  ck_assert_float_eq(mu_rsqrtf(MU_INF), 0.0f);
+}
+END_TEST
+
+START_TEST(test_mu_exp_log_f) {
+  run_float_tests(mu_expf, expf, -80.0f, 80.0f, 2.0f);
+  run_float_tests(mu_logf, logf, 1e-30f, 1e30f, 2.0f);
+  run_float_tests(mu_logf, logf, 0.96f, 1.04f, 2.0f);
+
+  ck_assert_float_eq(mu_expf(89.0f), MU_INF);
+  ck_assert_float_eq(mu_expf(-104.0f), 0.0f);
+  ck_assert_float_eq_tol(mu_expf(-100.0f) / expf(-100.0f), 1.0f, 1e-3f);
+  ck_assert_float_eq(mu_logf(0.0f), -MU_INF);
+  ck_assert_float_nan(mu_logf(-1.0f));
+  ck_assert_float_eq_tol(mu_logf(0x1p-149f), logf(0x1p-149f), 1e-5f);
+
+  ck_assert_float_eq_tol(mu_powf(MU_PI, 2.5f), powf(MU_PI, 2.5f), 1e-5f);
+  ck_assert_float_eq(mu_powf(-2.0f, 3.0f), -8.0f);
+  ck_assert_float_eq(mu_powf(10.0f, 40.0f), MU_INF);
+}
+END_TEST
+
+START_TEST(test_mu_hyperbolic_f) {
+  run_float_tests(mu_sinhf, sinhf, -80.0f, 80.0f, 2.0f);
+  run_float_tests(mu_coshf, coshf, -80.0f, 80.0f, 2.0f);
+  run_float_tests(mu_tanhf, tanhf, -10.0f, 10.0f, 2.0f);
+  run_float_tests(mu_asinhf, asinhf, -1e30f, 1e30f, 2.0f);
+  run_float_tests(mu_acoshf, acoshf, 1.0f, 1e30f, 2.0f);
+  run_float_tests(mu_atanhf, atanhf, -0.999f, 0.999f, 2.0f);
+
+  ck_assert_float_eq(mu_sinhf(90.0f), MU_INF);
+  ck_assert_float_eq(mu_coshf(-90.0f), MU_INF);
+  ck_assert_float_eq(mu_atanhf(-1.0f), -MU_INF);
+  ck_assert_float_nan(mu_acoshf(0.0f));
+
+  float s, c;
+  mu_sinhcoshf(1.5f, &s, &c);
+  ck_assert_float_eq(s, mu_sinhf(1.5f));
+  ck_assert_float_eq(c, mu_coshf(1.5f));
+}
+END_TEST
+
+START_TEST(test_mu_exp_log_variants_f) {
+  run_float_tests(mu_exp2f, exp2f, -140.0f, 120.0f, 2.0f);
+  run_float_tests(mu_exp10f, exp10f, -40.0f, 35.0f, 2.0f);
+  run_float_tests(mu_expm1f, expm1f, -20.0f, 20.0f, 2.0f);
+  run_float_tests(mu_log2f, log2f, 1e-30f, 1e30f, 2.0f);
+  run_float_tests(mu_log10f, log10f, 1e-30f, 1e30f, 2.0f);
+  run_float_tests(mu_log1pf, log1pf, -0.999f, 1000.0f, 2.0f);
+
+  ck_assert_float_eq(mu_exp2f(-149.0f), 0x1p-149f);
+  ck_assert_float_eq(mu_exp2f(128.0f), MU_INF);
+  ck_assert_float_eq(mu_log1pf(-1.0f), -MU_INF);
+  ck_assert_int_eq(mu_ilogbf(0x1p-149f), -149);
+  ck_assert_float_eq(mu_ldexpf(1.5f, -149), 0x1p-148f);
+  ck_assert_float_eq(mu_ldexpf(1.0f, 128), MU_INF);
+}
+END_TEST
+START_TEST(test_mu_float_n) {
+  run_float_batch_tests(mu_fabsf_n, mu_fabsf, -1000.0f, 1000.0f);
+  run_float_batch_tests(mu_truncf_n, mu_truncf, -1000.0f, 1000.0f);
+  run_float_batch_tests(mu_ceilf_n, mu_ceilf, -1000.0f, 1000.0f);
+  run_float_batch_tests(mu_floorf_n, mu_floorf, -1000.0f, 1000.0f);
+  run_float_batch_tests(mu_roundf_n, mu_roundf, -1000.0f, 1000.0f);
+  run_float_batch_tests(mu_nearbyintf_n, mu_nearbyintf, -1000.0f, 1000.0f);
+  run_float_batch_tests(mu_sinf_n, mu_sinf, -1e30f, 1e30f);
+  run_float_batch_tests(mu_cosf_n, mu_cosf, -1000.0f, 1000.0f);
+  run_float_batch_tests(mu_tanf_n, mu_tanf, -1000.0f, 1000.0f);
+  run_float_batch_tests(mu_sinpif_n, mu_sinpif, -1e10f, 1e10f);
+  run_float_batch_tests(mu_cospif_n, mu_cospif, -100.0f, 100.0f);
+  run_float_batch_tests(mu_tanpif_n, mu_tanpif, -100.0f, 100.0f);
+  run_float_batch_tests(mu_sindf_n, mu_sindf, -1e30f, 1e30f);
+  run_float_batch_tests(mu_cosdf_n, mu_cosdf, -1000.0f, 1000.0f);
+  run_float_batch_tests(mu_asinf_n, mu_asinf, -1.1f, 1.1f);
+  run_float_batch_tests(mu_acosf_n, mu_acosf, -1.1f, 1.1f);
+  run_float_batch_tests(mu_atanf_n, mu_atanf, -100.0f, 100.0f);
+  run_float_batch_tests(mu_sqrtf_n, mu_sqrtf, -1.0f, 10000.0f);
+  run_float_batch_tests(mu_rsqrtf_n, mu_rsqrtf, -1.0f, 10000.0f);
+  run_float_batch_tests(mu_expf_n, mu_expf, -110.0f, 90.0f);
+  run_float_batch_tests(mu_logf_n, mu_logf, -1.0f, 1000.0f);
+  run_float_batch_tests(mu_exp2f_n, mu_exp2f, -160.0f, 130.0f);
+  run_float_batch_tests(mu_exp10f_n, mu_exp10f, -50.0f, 40.0f);
+  run_float_batch_tests(mu_expm1f_n, mu_expm1f, -110.0f, 90.0f);
+  run_float_batch_tests(mu_log2f_n, mu_log2f, -1.0f, 1000.0f);
+  run_float_batch_tests(mu_log10f_n, mu_log10f, -1.0f, 1000.0f);
+  run_float_batch_tests(mu_log1pf_n, mu_log1pf, -1.5f, 1000.0f);
+  run_float_batch_tests(mu_sinhf_n, mu_sinhf, -100.0f, 100.0f);
+  run_float_batch_tests(mu_coshf_n, mu_coshf, -100.0f, 100.0f);
+  run_float_batch_tests(mu_tanhf_n, mu_tanhf, -20.0f, 20.0f);
+  run_float_batch_tests(mu_asinhf_n, mu_asinhf, -1e30f, 1e30f);
+  run_float_batch_tests(mu_acoshf_n, mu_acoshf, 0.0f, 1000.0f);
+  run_float_batch_tests(mu_atanhf_n, mu_atanhf, -1.1f, 1.1f);
+
+  float in[BATCH_SIZE], s[BATCH_SIZE], c[BATCH_SIZE];
+  for (size_t i = 0; i < BATCH_SIZE; ++i) {
+    in[i] = -100.0f + 200.0f * (float)i / BATCH_SIZE;
+  }
+  mu_sincosf_n(in, s, c, BATCH_SIZE);
+  for (size_t i = 0; i < BATCH_SIZE; ++i) {
+    ck_assert_float_eq(s[i], mu_sinf(in[i]));
+    ck_assert_float_eq(c[i], mu_cosf(in[i]));
+  }
+
+  mu_sincospif_n(in, s, c, BATCH_SIZE);
+  for (size_t i = 0; i < BATCH_SIZE; ++i) {
+    ck_assert_float_eq(s[i], mu_sinpif(in[i]));
+    ck_assert_float_eq(c[i], mu_cospif(in[i]));
+  }
+
+  mu_sincosdf_n(in, s, c, BATCH_SIZE);
+  for (size_t i = 0; i < BATCH_SIZE; ++i) {
+    ck_assert_float_eq(s[i], mu_sindf(in[i]));
+    ck_assert_float_eq(c[i], mu_cosdf(in[i]));
+  }
+
+  mu_sinhcoshf_n(in, s, c, BATCH_SIZE);
+  for (size_t i = 0; i < BATCH_SIZE; ++i) {
+    ck_assert_float_eq(s[i], mu_sinhf(in[i]));
+    ck_assert_float_eq(c[i], mu_coshf(in[i]));
+  }
+
+  mu_modff_n(in, s, c, BATCH_SIZE);
+  for (size_t i = 0; i < BATCH_SIZE; ++i) {
+    float ipart;
+    ck_assert_float_eq(s[i], mu_modff(in[i], &ipart));
+    ck_assert_float_eq(c[i], ipart);
+  }
+}
+END_TEST
+
+START_TEST(test_mu_float_2args_n) {
+  float values[] = {MU_NAN, MU_INF, -MU_INF, -10.0f, -1.0f, -0.1f, 0.0f,
+                    0.1f,   1.0f,   9.0f,    10.0f,  -0.0f, 3.5f};
+  size_t count = sizeof(values) / sizeof(values[0]);
+  float x[sizeof(values) / sizeof(values[0]) * sizeof(values) /
+          sizeof(values[0])];
+  float y[sizeof(x) / sizeof(x[0])], out[sizeof(x) / sizeof(x[0])];
+
+  for (size_t i = 0; i < count; ++i) {
+    for (size_t j = 0; j < count; ++j) {
+      x[i * count + j] = values[i];
+      y[i * count + j] = values[j];
+    }
+  }
+
+  float (*scalar[])(float, float) = {mu_fmodf, mu_atan2f, mu_powf,
+                                     mu_remainderf};
+  void (*batch[])(const float *, const float *, float *, size_t) = {
+      mu_fmodf_n, mu_atan2f_n, mu_powf_n, mu_remainderf_n};
+  for (size_t f = 0; f < 4; ++f) {
+    batch[f](x, y, out, count * count);
+    for (size_t i = 0; i < count * count; ++i) {
+      float expected = scalar[f](x[i], y[i]);
+      if (expected != expected) {
+        ck_assert_float_nan(out[i]);
+      } else {
+        ck_assert_float_eq(out[i], expected);
+      }
+    }
+  }
+}
+END_TEST
+
+START_TEST(test_mu_sin_tiers) {
+  run_tier_tests(mu_sin_fast, mu_sin_fast_n, mu_sin, sin, -1e4, 1e4, MU_EPS6);
+  run_tier_tests(mu_sin_medium, mu_sin_medium_n, mu_sin, sin, -1e4, 1e4,
+                 MU_EPS10);
+  run_tier_tests(mu_sin_fast, mu_sin_fast_n, mu_sin, sin, -1e300, 1e300,
+                 MU_EPS6);
+  ck_assert_double_eq(MU_TIER(mu_sin)(0.5), mu_sin_d(0.5));
+}
+END_TEST
+
+START_TEST(test_mu_cos_tiers) {
+  run_tier_tests(mu_cos_fast, mu_cos_fast_n, mu_cos, cos, -1e4, 1e4, MU_EPS6);
+  run_tier_tests(mu_cos_medium, mu_cos_medium_n, mu_cos, cos, -1e4, 1e4,
+                 MU_EPS10);
+}
+END_TEST
+
+START_TEST(test_mu_exp_tiers) {
+  run_tier_tests(mu_exp_fast, mu_exp_fast_n, mu_exp, exp, -700.0, 700.0,
+                 MU_EPS6);
+  run_tier_tests(mu_exp_medium, mu_exp_medium_n, mu_exp, exp, -700.0, 700.0,
+                 MU_EPS10);
+  ck_assert_double_eq(mu_exp_fast(710.0), MU_INF);
+  ck_assert_double_eq(mu_exp_medium(-746.0), 0.0);
+}
+END_TEST
+
+START_TEST(test_mu_log_tiers) {
+  run_tier_tests(mu_log_fast, mu_log_fast_n, mu_log, log, 1e-3, 1e3, MU_EPS6);
+  run_tier_tests(mu_log_medium, mu_log_medium_n, mu_log, log, 1e-3, 1e3,
+                 MU_EPS10);
+  run_tier_tests(mu_log_fast, mu_log_fast_n, mu_log, log, 0.9, 1.1, MU_EPS6);
+  run_tier_tests(mu_log_medium, mu_log_medium_n, mu_log, log, 0.9, 1.1,
+                 MU_EPS10);
+  ck_assert_double_eq_tol(mu_log_fast(5e-324), log(5e-324), MU_EPS6);
+  ck_assert_double_eq_tol(mu_log_medium(1e300), log(1e300), MU_EPS10);
+  ck_assert_double_eq_tol(mu_log_fast(1.0 + 0x1p-30) / log1p(0x1p-30), 1.0,
+                          MU_EPS6);
+  ck_assert_double_eq_tol(mu_log_medium(1.0 - 0x1p-30) / log1p(-0x1p-30), 1.0,
+                          MU_EPS10);
 }
 END_TEST
 
 Suite *math_utils_suite(void) {
   Suite *suite;
   TCase *core;
+  TCase *batch;
+  TCase *double_tier;
+  TCase *float_tier;
+  TCase *tiers;
 
   suite = suite_create("math_utils");
   core = tcase_create("Core");
@@ -431,20 +2208,108 @@ Suite *math_utils_suite(void) {
   tcase_add_test(core, test_mu_trunc);
   tcase_add_test(core, test_mu_ceil);
   tcase_add_test(core, test_mu_floor);
+  tcase_add_test(core, test_mu_round);
+  tcase_add_test(core, test_mu_nearbyint);
+  tcase_add_test(core, test_mu_modf);
+  tcase_add_test(core, test_mu_lround);
   tcase_add_test(core, test_mu_fmod);
+  tcase_add_test(core, test_mu_remainder);
+  tcase_add_test(core, test_mu_remquo);
   tcase_add_test(core, test_mu_sin);
   tcase_add_test(core, test_mu_cos);
   tcase_add_test(core, test_mu_tan);
+  tcase_add_test(core, test_mu_sincos);
+  tcase_add_test(core, test_mu_sinpi);
+  tcase_add_test(core, test_mu_sind);
   tcase_add_test(core, test_mu_asin);
   tcase_add_test(core, test_mu_acos);
   tcase_add_test(core, test_mu_atan);
+  tcase_add_test(core, test_mu_atan2);
   tcase_add_test(core, test_mu_sqrt);
+  tcase_add_test(core, test_mu_rsqrt);
   tcase_add_test(core, test_mu_pow);
+  tcase_add_test(core, test_mu_pow_plan);
   tcase_add_test(core, test_mu_exp);
   tcase_add_test(core, test_mu_log);
+  tcase_add_test(core, test_mu_hyperbolic);
+  tcase_add_test(core, test_mu_exp_log_variants);
+  tcase_add_test(core, test_mu_stats);
 
   suite_add_tcase(suite, core);
 
+  batch = tcase_create("Batch");
+
+  tcase_add_test(batch, test_mu_abs_n);
+  tcase_add_test(batch, test_mu_fabs_n);
+  tcase_add_test(batch, test_mu_trunc_n);
+  tcase_add_test(batch, test_mu_ceil_n);
+  tcase_add_test(batch, test_mu_floor_n);
+  tcase_add_test(batch, test_mu_round_n);
+  tcase_add_test(batch, test_mu_nearbyint_n);
+  tcase_add_test(batch, test_mu_modf_n);
+  tcase_add_test(batch, test_mu_fmod_n);
+  tcase_add_test(batch, test_mu_remainder_n);
+  tcase_add_test(batch, test_mu_sin_n);
+  tcase_add_test(batch, test_mu_cos_n);
+  tcase_add_test(batch, test_mu_tan_n);
+  tcase_add_test(batch, test_mu_sincos_n);
+  tcase_add_test(batch, test_mu_sinpi_n);
+  tcase_add_test(batch, test_mu_asin_n);
+  tcase_add_test(batch, test_mu_acos_n);
+  tcase_add_test(batch, test_mu_atan_n);
+  tcase_add_test(batch, test_mu_atan2_n);
+  tcase_add_test(batch, test_mu_sqrt_n);
+  tcase_add_test(batch, test_mu_rsqrt_n);
+  tcase_add_test(batch, test_mu_pow_n);
+  tcase_add_test(batch, test_mu_pow_apply_n);
+  tcase_add_test(batch, test_mu_exp_n);
+  tcase_add_test(batch, test_mu_log_n);
+  tcase_add_test(batch, test_mu_hyperbolic_n);
+  tcase_add_test(batch, test_mu_exp_log_variants_n);
+  tcase_add_test(batch, test_mu_progression);
+  tcase_add_test(batch, test_mu_batch_blocks);
+  tcase_add_test(batch, test_mu_batch_isa);
+  tcase_add_test(batch, test_mu_parallel_apply);
+  tcase_add_test(batch, test_mu_apply_strided);
+
+  suite_add_tcase(suite, batch);
+
+  double_tier = tcase_create("Double");
+
+  tcase_add_test(double_tier, test_mu_rounding_d);
+  tcase_add_test(double_tier, test_mu_trig_d);
+  tcase_add_test(double_tier, test_mu_inverse_trig_d);
+  tcase_add_test(double_tier, test_mu_sqrt_d);
+  tcase_add_test(double_tier, test_mu_exp_log_d);
+  tcase_add_test(double_tier, test_mu_hyperbolic_d);
+  tcase_add_test(double_tier, test_mu_exp_log_variants_d);
+  tcase_add_test(double_tier, test_mu_unchecked_d);
+
+  suite_add_tcase(suite, double_tier);
+
+  float_tier = tcase_create("Float");
+
+  tcase_add_test(float_tier, test_mu_rounding_f);
+  tcase_add_test(float_tier, test_mu_trig_f);
+  tcase_add_test(float_tier, test_mu_inverse_trig_f);
+  tcase_add_test(float_tier, test_mu_sqrt_f);
+  tcase_add_test(float_tier, test_mu_exp_log_f);
+  tcase_add_test(float_tier, test_mu_hyperbolic_f);
+  tcase_add_test(float_tier, test_mu_exp_log_variants_f);
+  tcase_add_test(float_tier, test_mu_float_n);
+  tcase_add_test(float_tier, test_mu_float_2args_n);
+
+  suite_add_tcase(suite, float_tier);
+
+  tiers = tcase_create("Tiers");
+
+  tcase_add_test(tiers, test_mu_sin_tiers);
+  tcase_add_test(tiers, test_mu_cos_tiers);
+  tcase_add_test(tiers, test_mu_exp_tiers);
+  tcase_add_test(tiers, test_mu_log_tiers);
+
+  suite_add_tcase(suite, tiers);
+
   return (suite);
 }
 
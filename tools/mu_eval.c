@@ -0,0 +1,319 @@
+#include <errno.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "math_utils.h"
+
+/*
+ * Default elements per block: 256 KB, so that a chain of functions runs on a
+ * block that stays in L2. Blocks are whole pages, which O_DIRECT and
+ * madvise() need.
+ */
+#define EVAL_BLOCK 32768
+#define EVAL_PAGE 4096
+#define EVAL_PAGE_ELEMS (EVAL_PAGE / sizeof(double))
+#define EVAL_MAX_CHAIN 16
+
+typedef struct {
+  const char *name;
+  mu_fn_id id;
+} eval_func;
+
+static const eval_func eval_funcs[] = {
+    {"fabs", MU_FN_FABS},
+    {"trunc", MU_FN_TRUNC},
+    {"ceil", MU_FN_CEIL},
+    {"floor", MU_FN_FLOOR},
+    {"sin", MU_FN_SIN},
+    {"cos", MU_FN_COS},
+    {"tan", MU_FN_TAN},
+    {"asin", MU_FN_ASIN},
+    {"acos", MU_FN_ACOS},
+    {"atan", MU_FN_ATAN},
+    {"sqrt", MU_FN_SQRT},
+    {"rsqrt", MU_FN_RSQRT},
+    {"exp", MU_FN_EXP},
+    {"log", MU_FN_LOG},
+    {"sin_fast", MU_FN_SIN_FAST},
+    {"sin_medium", MU_FN_SIN_MEDIUM},
+    {"cos_fast", MU_FN_COS_FAST},
+    {"cos_medium", MU_FN_COS_MEDIUM},
+    {"exp_fast", MU_FN_EXP_FAST},
+    {"exp_medium", MU_FN_EXP_MEDIUM},
+    {"log_fast", MU_FN_LOG_FAST},
+    {"log_medium", MU_FN_LOG_MEDIUM},
+    {"round", MU_FN_ROUND},
+    {"nearbyint", MU_FN_NEARBYINT},
+    {"sinpi", MU_FN_SINPI},
+    {"cospi", MU_FN_COSPI},
+    {"tanpi", MU_FN_TANPI},
+    {"sind", MU_FN_SIND},
+    {"cosd", MU_FN_COSD},
+    {"sinh", MU_FN_SINH},
+    {"cosh", MU_FN_COSH},
+    {"tanh", MU_FN_TANH},
+    {"asinh", MU_FN_ASINH},
+    {"acosh", MU_FN_ACOSH},
+    {"atanh", MU_FN_ATANH},
+    {"exp2", MU_FN_EXP2},
+    {"exp10", MU_FN_EXP10},
+    {"expm1", MU_FN_EXPM1},
+    {"log2", MU_FN_LOG2},
+    {"log10", MU_FN_LOG10},
+    {"log1p", MU_FN_LOG1P},
+};
+
+#define EVAL_FUNCS (sizeof(eval_funcs) / sizeof(eval_funcs[0]))
+
+/* One run over the input, shared by all threads. */
+typedef struct {
+  const double *in;
+  size_t n;
+  size_t block;
+  int fd;
+  int direct;
+  mu_fn_id chain[EVAL_MAX_CHAIN];
+  int chain_len;
+  _Atomic size_t next;
+  _Atomic int failed;
+} eval_job;
+
+/* Writes all of `buf` at `offset`, retrying short and interrupted writes. */
+static int eval_write(int fd, const char *buf, size_t len, off_t offset) {
+  while (len > 0) {
+    ssize_t done = pwrite(fd, buf, len, offset);
+    if (done < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      return -1;
+    }
+    buf += done;
+    len -= (size_t)done;
+    offset += done;
+  }
+  return 0;
+}
+
+/* Takes blocks from the job until none are left or a write fails. */
+static void *eval_worker(void *arg) {
+  eval_job *job = arg;
+  double *buf = aligned_alloc(EVAL_PAGE, job->block * sizeof(double));
+  if (buf == NULL) {
+    atomic_store(&job->failed, ENOMEM);
+    return NULL;
+  }
+
+  while (!atomic_load_explicit(&job->failed, memory_order_relaxed)) {
+    size_t lo = atomic_fetch_add_explicit(&job->next, 1, memory_order_relaxed) *
+                job->block;
+    if (lo >= job->n) {
+      break;
+    }
+    size_t len = job->n - lo < job->block ? job->n - lo : job->block;
+
+    mu_apply_strided(job->chain[0], job->in + lo, 1, buf, 1, len);
+    for (int k = 1; k < job->chain_len; ++k) {
+      mu_apply_strided(job->chain[k], buf, 1, buf, 1, len);
+    }
+
+    /* O_DIRECT writes whole pages; the file is cut back to size at the end. */
+    size_t bytes = len * sizeof(double);
+    if (job->direct) {
+      bytes = (bytes + EVAL_PAGE - 1) / EVAL_PAGE * EVAL_PAGE;
+    }
+    if (eval_write(job->fd, (const char *)buf, bytes,
+                   (off_t)(lo * sizeof(double))) != 0) {
+      atomic_store(&job->failed, errno);
+      break;
+    }
+    /* Drops the consumed input so memory use does not grow with the file. */
+    madvise((void *)(job->in + lo), len * sizeof(double), MADV_DONTNEED);
+  }
+
+  free(buf);
+  return NULL;
+}
+
+static int eval_parse_chain(char *list, eval_job *job) {
+  for (char *name = strtok(list, ","); name; name = strtok(NULL, ",")) {
+    size_t f = 0;
+    while (f < EVAL_FUNCS && strcmp(name, eval_funcs[f].name) != 0) {
+      ++f;
+    }
+    if (f == EVAL_FUNCS) {
+      fprintf(stderr, "unknown function: %s\n", name);
+      return -1;
+    }
+    if (job->chain_len == EVAL_MAX_CHAIN) {
+      fprintf(stderr, "at most %d functions can be chained\n", EVAL_MAX_CHAIN);
+      return -1;
+    }
+    job->chain[job->chain_len++] = eval_funcs[f].id;
+  }
+  return job->chain_len > 0 ? 0 : -1;
+}
+
+static void eval_usage(const char *prog) {
+  fprintf(stderr,
+          "usage: %s -f FUNCTION[,FUNCTION...] [-j THREADS] [-b ELEMENTS] "
+          "[-d] INPUT OUTPUT\n"
+          "  -f FUNCTIONS  functions to apply in order, e.g. sin or log,sqrt\n"
+          "  -j THREADS    worker threads (default: one per online CPU)\n"
+          "  -b ELEMENTS   elements per block, a multiple of %zu "
+          "(default %d)\n"
+          "  -d            write the output with O_DIRECT\n"
+          "INPUT and OUTPUT hold native-endian doubles and must be different "
+          "files.\n"
+          "functions:",
+          prog, EVAL_PAGE_ELEMS, EVAL_BLOCK);
+  for (size_t f = 0; f < EVAL_FUNCS; ++f) {
+    fprintf(stderr, " %s", eval_funcs[f].name);
+  }
+  fprintf(stderr, "\n");
+}
+
+int main(int argc, char **argv) {
+  static eval_job job;
+  char *chain = NULL;
+  const char *paths[2] = {NULL, NULL};
+  int npaths = 0;
+  long threads = 0;
+  long block = EVAL_BLOCK;
+  for (int i = 1; i < argc; ++i) {
+    if (strcmp(argv[i], "-f") == 0 && i + 1 < argc) {
+      chain = argv[++i];
+    } else if (strcmp(argv[i], "-j") == 0 && i + 1 < argc) {
+      threads = atol(argv[++i]);
+    } else if (strcmp(argv[i], "-b") == 0 && i + 1 < argc) {
+      block = atol(argv[++i]);
+    } else if (strcmp(argv[i], "-d") == 0) {
+      job.direct = 1;
+    } else if (argv[i][0] != '-' && npaths < 2) {
+      paths[npaths++] = argv[i];
+    } else {
+      eval_usage(argv[0]);
+      return 2;
+    }
+  }
+  if (chain == NULL || npaths != 2 || block <= 0 ||
+      block % EVAL_PAGE_ELEMS != 0 || eval_parse_chain(chain, &job) != 0) {
+    eval_usage(argv[0]);
+    return 2;
+  }
+  if (threads <= 0) {
+    threads = sysconf(_SC_NPROCESSORS_ONLN);
+    threads = threads > 0 ? threads : 1;
+  }
+  job.block = (size_t)block;
+
+  int in_fd = open(paths[0], O_RDONLY);
+  struct stat st;
+  if (in_fd < 0 || fstat(in_fd, &st) != 0) {
+    perror(paths[0]);
+    return 1;
+  }
+  if (st.st_size % sizeof(double) != 0) {
+    fprintf(stderr, "%s: size is not a multiple of %zu bytes\n", paths[0],
+            sizeof(double));
+    return 1;
+  }
+  job.n = (size_t)st.st_size / sizeof(double);
+
+  /* Not O_TRUNC: the output is checked against the input first. */
+  int flags = O_WRONLY | O_CREAT;
+  if (job.direct) {
+#if defined(O_DIRECT)
+    job.fd = open(paths[1], flags | O_DIRECT, 0644);
+    if (job.fd < 0 && errno == EINVAL) {
+      fprintf(stderr, "%s: O_DIRECT not supported, writing through the cache\n",
+              paths[1]);
+      job.direct = 0;
+    }
+#else
+    fprintf(stderr, "O_DIRECT not available, writing through the cache\n");
+    job.direct = 0;
+#endif
+  }
+  if (!job.direct) {
+    job.fd = open(paths[1], flags, 0644);
+  }
+  struct stat out_st;
+  if (job.fd < 0 || fstat(job.fd, &out_st) != 0) {
+    perror(paths[1]);
+    return 1;
+  }
+  if (out_st.st_dev == st.st_dev && out_st.st_ino == st.st_ino) {
+    fprintf(stderr, "%s: output is the input file\n", paths[1]);
+    return 1;
+  }
+  if (ftruncate(job.fd, 0) != 0 || ftruncate(job.fd, st.st_size) != 0) {
+    perror(paths[1]);
+    return 1;
+  }
+
+  if (job.n > 0) {
+    void *map =
+        mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, in_fd, 0);
+    if (map == MAP_FAILED) {
+      perror(paths[0]);
+      return 1;
+    }
+    madvise(map, (size_t)st.st_size, MADV_SEQUENTIAL);
+    job.in = map;
+  }
+
+  struct timespec t0, t1;
+  clock_gettime(CLOCK_MONOTONIC, &t0);
+
+  size_t blocks = (job.n + job.block - 1) / job.block;
+  if ((size_t)threads > blocks) {
+    threads = blocks > 0 ? (long)blocks : 1;
+  }
+  pthread_t *workers = malloc((size_t)threads * sizeof(*workers));
+  long started = 0;
+  while (workers && started < threads - 1 &&
+         pthread_create(&workers[started], NULL, eval_worker, &job) == 0) {
+    ++started;
+  }
+  eval_worker(&job);
+  for (long t = 0; t < started; ++t) {
+    pthread_join(workers[t], NULL);
+  }
+  free(workers);
+
+  int err = atomic_load(&job.failed);
+  if (err == 0 && job.direct && ftruncate(job.fd, st.st_size) != 0) {
+    err = errno;
+  }
+  if (err == 0 && close(job.fd) != 0) {
+    err = errno;
+  }
+  if (err != 0) {
+    fprintf(stderr, "%s: %s\n", paths[1], strerror(err));
+    return 1;
+  }
+
+  clock_gettime(CLOCK_MONOTONIC, &t1);
+  double seconds = (double)(t1.tv_sec - t0.tv_sec) +
+                   1e-9 * (double)(t1.tv_nsec - t0.tv_nsec);
+  fprintf(stderr,
+          "%zu elements in %.3f s with %ld threads: %.2f GB/s read, "
+          "%.2f GB/s read+write\n",
+          job.n, seconds, started + 1, (double)st.st_size / seconds * 1e-9,
+          2.0 * (double)st.st_size / seconds * 1e-9);
+
+  if (job.n > 0) {
+    munmap((void *)job.in, (size_t)st.st_size);
+  }
+  close(in_fd);
+  return 0;
+}